@@ -0,0 +1,173 @@
+#include <array>
+#include <chrono>
+#include <cstdlib>
+#include <fmt/format.h>
+#include <string>
+#include <thread>
+
+#include <asio.hpp>
+
+#include "arkanoid.pb.h"
+
+#include "allocation_counter.hpp"
+#include "arkanoid_elements.hpp"
+#include "connection.hpp"
+#include "delta.hpp"
+#include "framing.hpp"
+#include "match.hpp"
+#include "spectator.hpp"
+#include "update_arena.hpp"
+#include "utils.hpp"
+
+namespace {
+
+int constexpr warmup_ticks{ 40 };
+int constexpr ticks{ 2000 };
+int constexpr port{ connection::default_port + 11 };
+
+// Misst Allokationen und Zeit pro Frame für build(match, frame), nachdem der Puffer aufgewärmt wurde.
+template<typename Build>//
+void measure(char const *name, Build &&build)
+{
+  bench::Match match;
+  std::string frame;
+
+  for (int tick{ 0 }; tick < warmup_ticks; ++tick) {
+    (void)match.advance();
+    frame.clear();
+    build(match, frame);
+  }
+
+  std::size_t allocations{ 0 }, bytes{ 0 };
+  std::chrono::steady_clock::duration elapsed{};
+  for (int tick{ 0 }; tick < ticks; ++tick) {
+    (void)match.advance();
+
+    frame.clear();
+    auto const allocations_before = allocation_counter::thread_allocations();
+    auto const start = std::chrono::steady_clock::now();
+    build(match, frame);
+    elapsed += std::chrono::steady_clock::now() - start;
+    allocations += allocation_counter::thread_allocations() - allocations_before;
+    bytes += frame.size();
+  }
+
+  fmt::print("{:<44} {:>6.1f} Allokationen/Frame, {:>6.2f} us/Frame, {:>5} Bytes/Frame\n",
+    name,
+    static_cast<double>(allocations) / ticks,
+    std::chrono::duration<double, std::micro>(elapsed).count() / ticks,
+    bytes / ticks);
+}
+
+// Wie main.cpp: Das Spiel füllt jeden Frame ein Update aus dem Vorrat der Connection, deren I/O-Thread es über TCP
+// schreibt und zurückgibt. Gezählt wird im ganzen Prozess, ohne die Simulation. Die Gegenseite liest nur und
+// bestätigt nichts, daher gehen die Elemente ohne Delta.
+void measure_connection(char const *name)
+{
+  connection::Connection host{ connection::Transport::TCP, arkanoid::wire_quantization() };
+  std::thread accepting{ [&host]() { host.wait_for_connection(port); } };
+
+  asio::io_context io_context;
+  asio::ip::tcp::socket reader{ io_context };
+  asio::error_code ec;
+  for (int attempt{ 0 }; attempt < 100; ++attempt) {
+    reader.connect({ asio::ip::make_address(connection::default_host), port }, ec);
+    if (!ec) { break; }
+    reader.close();
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  accepting.join();
+  if (ec) {
+    fmt::print(stderr, "{:<44} keine Verbindung: {}\n", name, ec.message());
+    return;
+  }
+
+  std::thread reading{ [&reader]() {
+    std::array<char, 1 << 16> buffer{};
+    asio::error_code read_error;
+    while (!read_error) { (void)reader.read_some(asio::buffer(buffer), read_error); }
+  } };
+
+  bench::Match match;
+  std::size_t simulation_allocations{ 0 }, allocations_before{ 0 }, bytes_before{ 0 };
+  for (int tick{ 0 }; tick < warmup_ticks + ticks; ++tick) {
+    if (tick == warmup_ticks) {
+      allocations_before = allocation_counter::total_allocations();
+      bytes_before = host.bytes_sent();
+    }
+
+    auto const simulation_before = allocation_counter::thread_allocations();
+    (void)match.advance();
+    if (tick >= warmup_ticks) { simulation_allocations += allocation_counter::thread_allocations() - simulation_before; }
+
+    auto pooled = host.take_update();
+    auto &update = pooled->update();
+    update.set_tick(match.tick);
+    arkanoid::fill_game_update(&update, match.updated_elements);
+    host.send(std::move(pooled), true);
+    while (host.send_queue_depth() > 0) { std::this_thread::yield(); }
+  }
+  auto const allocations = allocation_counter::total_allocations() - allocations_before - simulation_allocations;
+  auto const bytes = host.bytes_sent() - bytes_before;
+
+  host.close();
+  reading.join();
+
+  fmt::print("{:<44} {:>6.1f} Allokationen/Frame, {:>16} {:>5} Bytes/Frame\n",
+    name,
+    static_cast<double>(allocations) / ticks,
+    "",
+    bytes / ticks);
+}
+
+}// namespace
+
+int main()
+{
+  // Alle Elemente pro Frame, damit die Größe des Updates konstant ist.
+  measure("Heap, neues GameUpdate", [](bench::Match const &match, std::string &frame) {
+    GameUpdate update;
+    arkanoid::fill_game_update(&update, match.element_map.values());
+    connection::append_frame(update, frame);
+  });
+
+  connection::UpdateArena arena;
+  measure("Arena, wiederverwendeter Block", [&arena](bench::Match const &match, std::string &frame) {
+    auto &update = arena.create();
+    arkanoid::fill_game_update(&update, match.element_map.values());
+    connection::append_frame(update, frame);
+  });
+
+  std::vector<arkanoid::Element *> elements;
+  measure("Arena, ohne values()", [&arena, &elements](bench::Match const &match, std::string &frame) {
+    elements.clear();
+    match.element_map.for_each([&elements](arkanoid::Element &element) { elements.push_back(&element); });
+
+    auto &update = arena.create();
+    arkanoid::fill_game_update(&update, elements);
+    connection::append_frame(update, frame);
+  });
+
+  measure("Zuschauer-Snapshot (Arena, geteilter Frame)", [&arena](bench::Match const &match, std::string &frame) {
+    auto &update = arena.create();
+    arkanoid::fill_game_update(&update, match.element_map.values());
+    frame = *connection::encode_snapshot(update, arkanoid::wire_quantization());
+  });
+
+  // Wie Connection beim Senden: geänderte Elemente, Delta-Kodierung und Packen.
+  connection::DeltaEncoder encoder{ arkanoid::wire_quantization() };
+  measure("Senden geänderter Elemente mit Delta", [&arena, &encoder](bench::Match const &match, std::string &frame) {
+    auto &update = arena.create();
+    update.set_tick(match.tick);
+    arkanoid::fill_game_update(&update, match.updated_elements);
+    encoder.encode(update, 0);
+    encoder.acknowledge(update.sequence());
+    connection::append_frame(update, frame);
+  });
+
+  measure_connection("Connection über TCP (Vorrat, I/O-Thread)");
+
+  google::protobuf::ShutdownProtobufLibrary();
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,184 @@
+#include <chrono>
+#include <cstdlib>
+#include <fmt/format.h>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "arkanoid.pb.h"
+#include "box2d-incl/box2d/b2_world.h"
+
+#include "allocation_counter.hpp"
+#include "arkanoid_elements.hpp"
+#include "codec.hpp"
+#include "connection.hpp"
+#include "match.hpp"
+#include "utils.hpp"
+
+namespace {
+
+int constexpr repetitions{ 2000 };
+int constexpr port{ connection::default_port + 14 };
+int constexpr states_sent{ 50 };
+
+struct Result
+{
+  double encode_ns{ 0 }, decode_ns{ 0 }, apply_ns{ 0 };// je Element
+  double bytes{ 0 }, allocations{ 0 };// je Update, Kodieren und Dekodieren
+  bool round_trip_ok{ true };
+};
+
+[[nodiscard]] bool same_state(arkanoid::ElementState const &a, arkanoid::ElementState const &b)
+{
+  return a.id == b.id && a.type == b.type && a.x == b.x && a.y == b.y && a.velocity_x == b.velocity_x
+         && a.velocity_y == b.velocity_y && a.duration == b.duration && a.score == b.score;
+}
+
+template<arkanoid::Codec StateCodec>//
+[[nodiscard]] Result measure(StateCodec &codec, bench::Match &match, std::vector<arkanoid::Element *> const &elements)
+{
+  Result result;
+  std::string buffer;
+  std::int64_t tick{ 0 };
+  float checksum{ 0.0F };
+  auto const element_count = static_cast<double>(elements.size() * repetitions);
+
+  // Aufwärmen, damit Puffer und Arenen ihre endgültige Größe haben.
+  codec.encode(match.tick, elements, buffer);
+  (void)codec.decode(buffer, tick, [](arkanoid::ElementState const &) {});
+
+  auto const allocations_before = allocation_counter::thread_allocations();
+  auto start = std::chrono::steady_clock::now();
+  for (int i{ 0 }; i < repetitions; ++i) { codec.encode(match.tick, elements, buffer); }
+  result.encode_ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+  start = std::chrono::steady_clock::now();
+  for (int i{ 0 }; i < repetitions; ++i) {
+    (void)codec.decode(buffer, tick, [&checksum](arkanoid::ElementState const &state) { checksum += state.x; });
+  }
+  result.decode_ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+  result.allocations =
+    static_cast<double>(allocation_counter::thread_allocations() - allocations_before) / (2.0 * repetitions);
+
+  // Gegenstelle mit eigener Welt, in die das Update übernommen wird.
+  b2World world{ { 0, 0 } };
+  arkanoid::ElementStore received;
+  (void)arkanoid::apply_update(codec, buffer, received, &world);
+
+  start = std::chrono::steady_clock::now();
+  for (int i{ 0 }; i < repetitions; ++i) { (void)arkanoid::apply_update(codec, buffer, received, &world); }
+  result.apply_ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+  for (auto const *element : elements) {
+    auto const *found = received.find(element->id());
+    result.round_trip_ok = result.round_trip_ok && found != nullptr
+                           && same_state(
+                             arkanoid::capture_element_state(element), arkanoid::capture_element_state(found));
+  }
+
+  result.encode_ns /= element_count;
+  result.decode_ns /= element_count;
+  result.apply_ns /= element_count;
+  result.bytes = static_cast<double>(buffer.size());
+  if (checksum == 0.0F) { result.round_trip_ok = false; }
+
+  return result;
+}
+
+// Sendet den Zustand über eine Connection mit dem Codec und prüft, was die Gegenstelle daraus übernimmt. Liefert die
+// gesendeten Bytes je Zustand, 0 bei einem Fehler.
+template<arkanoid::Codec StateCodec>//
+[[nodiscard]] double send_over_connection(StateCodec &codec,
+  bench::Match &match,
+  std::vector<arkanoid::Element *> const &elements)
+{
+  connection::Connection sender;
+  connection::Connection receiver;
+  std::thread accepting{ [&receiver]() { receiver.wait_for_connection(port); } };
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  sender.connect_to(connection::default_host, port);
+  accepting.join();
+  if (!sender.has_connected() || !receiver.has_connected()) { return 0.0; }
+
+  auto const bytes_before = sender.bytes_sent();
+  for (int i{ 0 }; i < states_sent; ++i) { sender.send_state(codec, match.tick, elements, true); }
+
+  b2World world{ { 0, 0 } };
+  arkanoid::ElementStore received;
+  int states{ 0 };
+  bool decoded{ true };
+  auto const deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+  while (states < states_sent && std::chrono::steady_clock::now() < deadline) {
+    (void)receiver.drain_received([&](GameUpdate const &update) {
+      decoded = decoded && arkanoid::apply_update(codec, update.state(), received, &world);
+      ++states;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+
+  for (auto const *element : elements) {
+    auto const *found = received.find(element->id());
+    decoded = decoded && found != nullptr
+              && same_state(arkanoid::capture_element_state(element), arkanoid::capture_element_state(found));
+  }
+  if (states != states_sent || !decoded) { return 0.0; }
+
+  // Auch die Pings der Verbindung zählen mit; sie machen nur wenige Bytes aus.
+  return static_cast<double>(sender.bytes_sent() - bytes_before) / states_sent;
+}
+
+void print(char const *name, Result const &result)
+{
+  fmt::print("  {:<9} kodieren {:>6.1f} ns, lesen {:>6.1f} ns, übernehmen {:>6.1f} ns je Element, "
+             "{:>5.0f} Bytes, {:.1f} Allokationen je Update, {}\n",
+    name,
+    result.encode_ns,
+    result.decode_ns,
+    result.apply_ns,
+    result.bytes,
+    result.allocations,
+    result.round_trip_ok ? "ok" : "FEHLER");
+}
+
+}// namespace
+
+int main()
+{
+  bench::Match match;
+  for (int i{ 0 }; i < 400; ++i) { (void)match.advance(); }
+
+  arkanoid::ProtobufCodec protobuf;
+  arkanoid::FlatCodec flat;
+  bool ok{ true };
+
+  auto compare = [&](char const *name, std::vector<arkanoid::Element *> const &elements) {
+    fmt::print("{} ({} Elemente):\n", name, elements.size());
+    auto const protobuf_result = measure(protobuf, match, elements);
+    auto const flat_result = measure(flat, match, elements);
+    print("protobuf", protobuf_result);
+    print("flach", flat_result);
+    ok = ok && protobuf_result.round_trip_ok && flat_result.round_trip_ok;
+  };
+
+  compare("Vollständiger Zustand", match.element_map.values());
+
+  std::vector<arkanoid::Element *> moving;
+  match.element_map.for_each([&moving](arkanoid::Element &element) {
+    if (element.get_type() != arkanoid::BRICK) { moving.push_back(&element); }
+  });
+  compare("Bälle und Schläger", moving);
+
+  auto const all = match.element_map.values();
+  fmt::print("Über Connection ({} Zustände mit {} Elementen):\n", states_sent, all.size());
+  auto report = [&ok](char const *name, double const bytes) {
+    fmt::print("  {:<9} {:>5.0f} Bytes je Zustand, {}\n", name, bytes, bytes > 0.0 ? "ok" : "FEHLER");
+    ok = ok && bytes > 0.0;
+  };
+  report("protobuf", send_over_connection(protobuf, match, all));
+  report("flach", send_over_connection(flat, match, all));
+
+  google::protobuf::ShutdownProtobufLibrary();
+
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
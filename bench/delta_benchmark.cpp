@@ -0,0 +1,138 @@
+#include <cstdlib>
+#include <deque>
+#include <fmt/format.h>
+#include <string>
+#include <utility>
+
+#include "arkanoid.pb.h"
+
+#include "arkanoid_elements.hpp"
+#include "delta.hpp"
+#include "match.hpp"
+#include "utils.hpp"
+
+namespace {
+
+long constexpr match_ticks{ 60 * bench::frame_rate };
+
+// Bytes der Elemente einer Nachricht samt Feldkennung und Länge; der Rest sind Tick, Sequenznummer und Ack.
+[[nodiscard]] std::size_t elements_size(GameUpdate const &update)
+{
+  GameUpdate header{ update };
+  header.clear_element();
+  return update.ByteSizeLong() - header.ByteSizeLong();
+}
+
+// Eine Gegenstelle, deren Acks ack_delay_ticks später beim Sender eintreffen.
+struct Link
+{
+  connection::Quantization quantization;
+  connection::DeltaEncoder encoder{ quantization };
+  connection::DeltaDecoder decoder{ quantization };
+  std::deque<std::pair<long, std::uint32_t>> acks_in_flight{};
+  std::size_t bytes{ 0 }, element_bytes{ 0 };
+  int mismatches{ 0 };
+
+  void transmit(GameUpdate const &update, long const tick, long const ack_delay_ticks)
+  {
+    GameUpdate encoded{ update };
+    encoder.encode(encoded, 0);
+    bytes += encoded.ByteSizeLong();
+    element_bytes += elements_size(encoded);
+
+    GameUpdate received;
+    received.ParseFromString(encoded.SerializeAsString());
+    decoder.decode(received);
+    acks_in_flight.emplace_back(tick + ack_delay_ticks, decoder.ack());
+
+    for (auto original : update.element()) {
+      connection::snap_element(original, quantization);
+      bool const found = std::any_of(received.element().begin(), received.element().end(), [&](auto const &element) {
+        return element.SerializeAsString() == original.SerializeAsString();
+      });
+      if (!found) { ++mismatches; }
+    }
+  }
+
+  void deliver_acks(long const tick)
+  {
+    while (!acks_in_flight.empty() && acks_in_flight.front().first <= tick) {
+      encoder.acknowledge(acks_in_flight.front().second);
+      acks_in_flight.pop_front();
+    }
+  }
+};
+
+// Simuliert eine Partie und überträgt jedes Update vollständig, delta-kodiert und zusätzlich quantisiert.
+void compare(long const ack_delay_ticks)
+{
+  bench::Match match;
+  Link delta;
+  Link packed{ arkanoid::wire_quantization() };
+  std::size_t full_bytes{ 0 }, full_element_bytes{ 0 };
+  int updates{ 0 };
+
+  auto transmit = [&](GameUpdate const &update) {
+    full_bytes += update.ByteSizeLong();
+    full_element_bytes += elements_size(update);
+    delta.transmit(update, match.tick, ack_delay_ticks);
+    packed.transmit(update, match.tick, ack_delay_ticks);
+    ++updates;
+  };
+
+  GameUpdate initial_sync;
+  arkanoid::fill_game_update(&initial_sync, match.element_map.values());
+  transmit(initial_sync);
+
+  while (match.tick < match_ticks) {
+    (void)match.advance();
+
+    delta.deliver_acks(match.tick);
+    packed.deliver_acks(match.tick);
+
+    if (match.updated_elements.empty()) { continue; }
+
+    GameUpdate update;
+    update.set_tick(match.tick);
+    arkanoid::fill_game_update(&update, match.updated_elements);
+    transmit(update);
+  }
+
+  double const seconds = static_cast<double>(match_ticks) / bench::frame_rate;
+  auto const ratio = [full_bytes](Link const &link) {
+    return static_cast<double>(full_bytes) / static_cast<double>(link.bytes);
+  };
+  fmt::print("Ack nach {:>2} Ticks: {:>5} Updates, vollständig {:>5.0f} B/s, Delta {:>5.0f} B/s ({:.2f}x), "
+             "Delta gepackt {:>5.0f} B/s ({:.2f}x), {} fehlerhaft\n",
+    ack_delay_ticks,
+    updates,
+    static_cast<double>(full_bytes) / seconds,
+    static_cast<double>(delta.bytes) / seconds,
+    ratio(delta),
+    static_cast<double>(packed.bytes) / seconds,
+    ratio(packed),
+    delta.mismatches + packed.mismatches);
+
+  // Fast jedes Update enthält nur den eigenen Schläger, dessen x sich jeden Tick ändert. Unveränderte Felder kosten
+  // schon nichts; was bleibt, ist dieser eine Wert und der Kopf der Nachricht.
+  auto const per_update = [updates](std::size_t const value) {
+    return static_cast<double>(value) / static_cast<double>(updates);
+  };
+  fmt::print("               je Update: vollständig {:>4.1f} B Elemente + {:>4.1f} B Kopf, Delta gepackt {:>4.1f} B "
+             "Elemente + {:>4.1f} B Kopf\n",
+    per_update(full_element_bytes),
+    per_update(full_bytes - full_element_bytes),
+    per_update(packed.element_bytes),
+    per_update(packed.bytes - packed.element_bytes));
+}
+
+}// namespace
+
+int main()
+{
+  for (long const ack_delay_ticks : { 1, 4, 12 }) { compare(ack_delay_ticks); }
+
+  google::protobuf::ShutdownProtobufLibrary();
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,74 @@
+#include <chrono>
+#include <cstdlib>
+#include <fmt/format.h>
+
+#include "arkanoid.pb.h"
+
+#include "arkanoid_elements.hpp"
+#include "match.hpp"
+#include "state_hash.hpp"
+
+namespace {
+
+long constexpr ticks{ 2000 };
+long constexpr tampered_tick{ 1500 };
+
+// Wie state_hash, aber mit allen Steinen je Tick statt des nachgeführten Werts.
+[[nodiscard]] std::uint64_t full_state_hash(arkanoid::ElementStore const &elements)
+{
+  std::uint64_t bricks{ 0 };
+  elements.bricks().for_each([&bricks](arkanoid::Brick &brick) { bricks ^= brick.state_hash(); });
+  return arkanoid::hash_combine(arkanoid::state_hash(elements) ^ elements.bricks_hash(), bricks);
+}
+
+}// namespace
+
+int main()
+{
+  using namespace arkanoid;
+
+  // Zwei Partien mit denselben ids und Haltbarkeiten, wie Host und Gegenstelle nach dem ersten Update.
+  bench::Match local;
+  bench::Match remote;
+  for (std::size_t i{ 0 }; i < local.element_map.bricks().size(); ++i) {
+    remote.element_map.bricks()[i].set_duration(local.element_map.bricks()[i].duration());
+  }
+
+  DesyncDetector detector;
+  double hash_ns{ 0 }, full_hash_ns{ 0 };
+  std::uint64_t checksum{ 0 };
+
+  for (long tick{ 0 }; tick < ticks; ++tick) {
+    // Ab hier weicht die Gegenstelle ab, als wäre ein Treffer nur auf einer Seite gezählt worden.
+    if (tick == tampered_tick) { remote.element_map.bricks()[0].set_duration(0); }
+
+    (void)local.advance();
+    (void)remote.advance();
+
+    auto start = std::chrono::steady_clock::now();
+    auto const local_hash = state_hash(local.element_map);
+    hash_ns += std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+    start = std::chrono::steady_clock::now();
+    checksum ^= full_state_hash(local.element_map);
+    full_hash_ns += std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+    detector.record_local(tick, local_hash);
+    detector.record_remote(tick, state_hash(remote.element_map));
+  }
+
+  bool const detected = detector.first_desync_tick() == tampered_tick && detector.matched() == tampered_tick;
+
+  fmt::print("{} Ticks, {} Elemente:\n", ticks, local.element_map.size());
+  fmt::print("  Prüfsumme nachgeführt {:>7.1f} ns je Tick\n", hash_ns / ticks);
+  fmt::print("  Prüfsumme vollständig {:>7.1f} ns je Tick\n", full_hash_ns / ticks);
+  fmt::print("  Gleich bis Tick {}, Abweichung erkannt ab Tick {} {}\n",
+    detector.matched(),
+    detector.first_desync_tick(),
+    detected ? "(wie erwartet)" : "FEHLER: erwartet ab Tick " + std::to_string(tampered_tick));
+  fmt::print("(Prüfsumme {:x})\n", checksum);
+
+  google::protobuf::ShutdownProtobufLibrary();
+
+  return detected ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,189 @@
+#include <chrono>
+#include <cstdlib>
+#include <fmt/format.h>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include "arkanoid.pb.h"
+#include "box2d-incl/box2d/b2_body.h"
+#include "box2d-incl/box2d/b2_fixture.h"
+
+#include "arkanoid_elements.hpp"
+#include "match.hpp"
+#include "utils.hpp"
+
+namespace {
+
+int constexpr repetitions{ 20000 };
+
+// Die bisherige Umsetzung mit dynamic_cast, zum Vergleich.
+template<typename T1, typename T2>//
+[[nodiscard]] T1 dynamic_multiple_cast(T2 t2_1, T2 t2_2)
+{
+  auto t1_1 = dynamic_cast<T1>(t2_1);
+  auto t1_2 = dynamic_cast<T1>(t2_2);
+
+  if (t1_1 == nullptr) { return t1_2; }
+  return t1_1;
+}
+
+void fill_game_element_rtti(GameElement *const &game_element, arkanoid::Element const *element)
+{
+  using namespace arkanoid;
+  auto *position = game_element->mutable_element_position();
+  auto const pos = element->center_position();
+  position->set_x(pos.x);
+  position->set_y(pos.y);
+  game_element->set_id(element->id());
+
+  if (element->get_type() == BALL) {
+    auto const vel = dynamic_cast<const Ball *>(element)->velocity();
+    game_element->mutable_ball()->set_velocity_x(vel.x);
+    game_element->mutable_ball()->set_velocity_y(vel.y);
+  } else if (element->get_type() == BRICK) {
+    game_element->mutable_brick()->set_duration(dynamic_cast<const Brick *>(element)->duration());
+  } else if (element->get_type() == PADDLE) {
+    auto const *paddle = dynamic_cast<const Paddle *>(element);
+    game_element->mutable_paddle()->set_controlled_by_sender(paddle->is_controlled_by_this_game_instance());
+    game_element->mutable_paddle()->set_score(paddle->score());
+  }
+}
+
+void parse_game_element_rtti(arkanoid::Element *element, GameElement const &net_element)
+{
+  using namespace arkanoid;
+  element->set_position({ net_element.element_position().x(), net_element.element_position().y() });
+
+  if (element->get_type() == BALL && net_element.has_ball()) {
+    dynamic_cast<Ball *>(element)->set_velocity({ net_element.ball().velocity_x(), net_element.ball().velocity_y() });
+  } else if (element->get_type() == BRICK && net_element.has_brick()) {
+    dynamic_cast<Brick *>(element)->set_duration(net_element.brick().duration());
+  } else if (element->get_type() == PADDLE && net_element.has_paddle()) {
+    auto *paddle = dynamic_cast<Paddle *>(element);
+    paddle->set_is_controlled_by_this_game_instance(!net_element.paddle().controlled_by_sender());
+    paddle->set_score(net_element.paddle().score());
+  }
+}
+
+template<typename Function>//
+[[nodiscard]] double measure_ns(std::size_t const operations, Function &&function)
+{
+  function();// aufwärmen
+
+  auto const start = std::chrono::steady_clock::now();
+  for (int i{ 0 }; i < repetitions; ++i) { function(); }
+  auto const elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+  return elapsed / static_cast<double>(operations * repetitions);
+}
+
+void print(char const *name,
+  double const before,
+  double const after,
+  char const *before_label = "dynamic_cast",
+  char const *after_label = "Art im Element")
+{
+  fmt::print("  {:<22} {:<12} {:>6.1f} ns, {:<14} {:>6.1f} ns ({:.1f}x)\n",
+    name,
+    before_label,
+    before,
+    after_label,
+    after,
+    after > 0.0 ? before / after : 0.0);
+}
+
+}// namespace
+
+int main()
+{
+  using namespace arkanoid;
+  bench::Match match;
+  (void)match.advance();
+
+  auto const elements = match.element_map.values();
+
+  // Alle Paare aus Ball und einem anderen Element, wie sie als Kontakte auftreten.
+  std::vector<std::pair<Element *, Element *>> contacts;
+  for (auto *first : elements) {
+    if (first->get_type() != BALL) { continue; }
+    for (auto *second : elements) {
+      if (second != first) { contacts.emplace_back(first, second); }
+    }
+  }
+
+  // Die Fixtures der Elemente, wie sie in b2Contact auftreten, und die frühere Zuordnung über eine map.
+  std::map<b2Fixture *, Element *> fixture_map;
+  std::vector<std::pair<b2Fixture *, b2Fixture *>> fixture_contacts;
+  for (auto *body = match.world.GetBodyList(); body != nullptr; body = body->GetNext()) {
+    for (auto *fixture = body->GetFixtureList(); fixture != nullptr; fixture = fixture->GetNext()) {
+      fixture_map[fixture] = element_of(fixture);
+    }
+  }
+  for (auto const &[first, first_element] : fixture_map) {
+    if (element_cast<Ball>(first_element) == nullptr) { continue; }
+    for (auto const &[second, second_element] : fixture_map) {
+      if (second != first) { fixture_contacts.emplace_back(first, second); }
+    }
+  }
+
+  long checksum{ 0 };
+
+  auto const lookup_before = measure_ns(fixture_contacts.size(), [&]() {
+    for (auto const &[first, second] : fixture_contacts) {
+      if (fixture_map.contains(first) && fixture_map.contains(second)) {
+        checksum += (fixture_map.find(first)->second != nullptr) + (fixture_map.find(second)->second != nullptr);
+      }
+    }
+  });
+  auto const lookup_after = measure_ns(fixture_contacts.size(), [&]() {
+    for (auto const &[first, second] : fixture_contacts) {
+      checksum += (element_of(first) != nullptr) + (element_of(second) != nullptr);
+    }
+  });
+
+  auto const classify_before = measure_ns(contacts.size(), [&]() {
+    for (auto const &[first, second] : contacts) {
+      auto *brick = dynamic_multiple_cast<Brick *>(first, second);
+      auto *ball = dynamic_multiple_cast<Ball *>(first, second);
+      auto *paddle = dynamic_multiple_cast<Paddle *>(first, second);
+      checksum += (brick != nullptr) + (ball != nullptr) + (paddle != nullptr);
+    }
+  });
+  auto const classify_after = measure_ns(contacts.size(), [&]() {
+    for (auto const &[first, second] : contacts) {
+      auto *brick = element_cast_either<Brick>(first, second);
+      auto *ball = element_cast_either<Ball>(first, second);
+      auto *paddle = element_cast_either<Paddle>(first, second);
+      checksum += (brick != nullptr) + (ball != nullptr) + (paddle != nullptr);
+    }
+  });
+
+  GameElement net_element;
+  auto const fill_before = measure_ns(elements.size(), [&]() {
+    for (auto const *element : elements) { fill_game_element_rtti(&net_element, element); }
+  });
+  auto const fill_after = measure_ns(elements.size(), [&]() {
+    for (auto const *element : elements) { fill_game_element(&net_element, element); }
+  });
+
+  GameUpdate update;
+  fill_game_update(&update, elements);
+  auto const parse_before = measure_ns(elements.size(), [&]() {
+    for (std::size_t i{ 0 }; auto const &element : update.element()) { parse_game_element_rtti(elements[i++], element); }
+  });
+  auto const parse_after = measure_ns(elements.size(), [&]() {
+    for (std::size_t i{ 0 }; auto const &element : update.element()) { parse_game_element(elements[i++], element); }
+  });
+
+  fmt::print("{} Elemente, {} Kontaktpaare, je Element bzw. Kontakt:\n", elements.size(), contacts.size());
+  print("Fixture zuordnen", lookup_before, lookup_after, "std::map", "userData");
+  print("Kontakt einordnen", classify_before, classify_after);
+  print("fill_game_element", fill_before, fill_after);
+  print("parse_game_element", parse_before, parse_after);
+  fmt::print("(Prüfsumme {})\n", checksum);
+
+  google::protobuf::ShutdownProtobufLibrary();
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,191 @@
+#include <chrono>
+#include <cstdlib>
+#include <fmt/format.h>
+#include <map>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include "arkanoid.pb.h"
+#include "box2d-incl/box2d/b2_world.h"
+
+#include "arkanoid_elements.hpp"
+#include "delta.hpp"
+#include "events.hpp"
+#include "match.hpp"
+#include "utils.hpp"
+
+namespace {
+
+int constexpr ticks{ 2000 };
+
+// Punkte der Schläger und Haltbarkeit der Steine, nach id.
+[[nodiscard]] std::map<int, int> scores_and_durations(arkanoid::ElementStore const &elements)
+{
+  std::map<int, int> values;
+  elements.for_each(overloaded{
+    [&values](arkanoid::Paddle &paddle) { values[paddle.id()] = paddle.score(); },
+    [&values](arkanoid::Brick &brick) { values[brick.id()] = brick.duration(); },
+    [](arkanoid::Ball &) {},
+  });
+  return values;
+}
+
+// Bytes einer Ereignisart und der ganzen Elemente, die sie ersetzt, jeweils für sich gezählt.
+struct KindBytes
+{
+  std::size_t count{ 0 }, event_bytes{ 0 }, state_bytes{ 0 };
+};
+
+// Gegenstelle mit eigener Welt, die nur empfangene Updates übernimmt.
+struct Receiver
+{
+  b2World world{ { 0, 0 } };
+  arkanoid::ElementStore element_map;
+  arkanoid::EventLog events;
+
+  explicit Receiver(GameUpdate const &initial)
+  {
+    arkanoid::parse_game_update(element_map, initial, &world);
+  }
+};
+
+}// namespace
+
+int main()
+{
+  bench::Match match;
+  arkanoid::EventLog events;
+  match.listener.set_event_log(&events);
+  (void)match.advance();
+
+  GameUpdate initial;
+  arkanoid::fill_game_update(&initial, match.element_map.values());
+  Receiver once{ initial };
+  Receiver twice{ initial };
+  Receiver reordered{ initial };
+  std::vector<GameUpdate> received_updates;
+
+  // Bälle legen in der Welt nur Bruchteile eines Feldes je Tick zurück. Damit in wenigen Ticks echte Kontakte
+  // entstehen, wird ein Ball abwechselnd auf einen Stein oder den eigenen Schläger und wieder zurück gesetzt.
+  auto *ball = &match.element_map.balls()[0];
+  std::vector<arkanoid::Brick *> bricks;
+  match.element_map.bricks().for_each([&bricks](arkanoid::Brick &brick) { bricks.push_back(&brick); });
+  ball->set_last_paddle(match.paddle_ptrs[0]);
+  auto const home = ball->center_position();
+  std::size_t next_brick{ 0 };
+
+  // Beide Varianten wie auf der Leitung: quantisiert und bitgepackt. Ohne Bestätigungen gibt es keine Deltas.
+  connection::DeltaEncoder event_encoder{ arkanoid::wire_quantization() };
+  connection::DeltaEncoder state_encoder{ arkanoid::wire_quantization() };
+  connection::DeltaDecoder event_decoder{ arkanoid::wire_quantization() };
+
+  std::size_t event_count{ 0 }, event_bytes{ 0 }, state_bytes{ 0 }, updates{ 0 };
+  KindBytes hits, scores;
+  double apply_ns{ 0 };
+
+  for (int i{ 0 }; i < ticks; ++i) {
+    if (i % 2 == 1) {
+      ball->set_position(home);
+    } else if (i % 8 == 0) {
+      ball->set_position(match.paddle_ptrs[0]->center_position());
+    } else {
+      for (std::size_t tries{ 0 }; tries < bricks.size() && bricks[next_brick]->duration() <= 0; ++tries) {
+        next_brick = (next_brick + 1) % bricks.size();
+      }
+      ball->set_position(bricks[next_brick]->center_position());
+    }
+
+    (void)match.advance();
+    if (!events.has_pending()) { continue; }
+
+    GameUpdate update;
+    update.set_tick(match.tick);
+    events.flush(update);
+
+    // Dasselbe ohne Ereignisse: alle betroffenen Elemente vollständig.
+    std::set<int> ids;
+    for (auto const &event : update.event()) {
+      if (event.has_brick_hit()) {
+        ids.insert(event.brick_hit().id());
+        ids.insert(event.brick_hit().paddle_id());
+      }
+      if (event.has_score_delta()) { ids.insert(event.score_delta().paddle_id()); }
+    }
+    std::vector<arkanoid::Element *> affected;
+    for (auto const id : ids) { affected.push_back(match.element_map.find(id)); }
+    GameUpdate states;
+    states.set_tick(match.tick);
+    arkanoid::fill_game_update(&states, affected);
+
+    event_encoder.encode(update, 0);
+    state_encoder.encode(states, 0);
+    ++updates;
+    event_count += static_cast<std::size_t>(update.event_size());
+    event_bytes += update.ByteSizeLong();
+    state_bytes += states.ByteSizeLong();
+
+    std::map<int, std::size_t> element_bytes;
+    for (auto const &element : states.element()) { element_bytes[element.id()] = element.ByteSizeLong(); }
+    for (auto const &event : update.event()) {
+      auto &kind = event.has_brick_hit() ? hits : scores;
+      ++kind.count;
+      kind.event_bytes += event.ByteSizeLong();
+      if (event.has_brick_hit()) {
+        kind.state_bytes += element_bytes[event.brick_hit().id()] + element_bytes[event.brick_hit().paddle_id()];
+      } else {
+        kind.state_bytes += element_bytes[event.score_delta().paddle_id()];
+      }
+    }
+    event_decoder.decode(update);
+
+    auto const start = std::chrono::steady_clock::now();
+    once.events.apply(update, once.element_map, true);
+    apply_ns += std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+    // Doppelt zugestellt, wie bei einer Wiederholung, deren Bestätigung verloren ging.
+    twice.events.apply(update, twice.element_map, true);
+    twice.events.apply(update, twice.element_map, true);
+    received_updates.push_back(update);
+  }
+
+  // Benachbarte Updates vertauscht, wie bei einem Treffer, dessen Wiederholung nach dem nächsten ankommt.
+  for (std::size_t i{ 0 }; i + 1 < received_updates.size(); i += 2) {
+    std::swap(received_updates[i], received_updates[i + 1]);
+  }
+  for (auto const &update : received_updates) { reordered.events.apply(update, reordered.element_map, true); }
+
+  auto const received = scores_and_durations(once.element_map);
+  bool const idempotent = received == scores_and_durations(twice.element_map);
+  bool const consistent = received == scores_and_durations(match.element_map);
+  bool const order_independent = received == scores_and_durations(reordered.element_map);
+  auto const per_update = [updates](std::size_t const value) {
+    return updates == 0 ? 0.0 : static_cast<double>(value) / static_cast<double>(updates);
+  };
+
+  fmt::print("{} Ticks, {} Updates mit {} Ereignissen:\n", ticks, updates, event_count);
+  fmt::print("  Ereignisse        {:>6.1f} Bytes je Update\n", per_update(event_bytes));
+  fmt::print("  Ganze Elemente    {:>6.1f} Bytes je Update\n", per_update(state_bytes));
+  auto const print_kind = [](char const *name, KindBytes const &kind) {
+    if (kind.count == 0) { return; }
+    auto const per_event = [&kind](std::size_t const value) {
+      return static_cast<double>(value) / static_cast<double>(kind.count);
+    };
+    fmt::print("    {:<15} {:>5.1f} statt {:>5.1f} Bytes je Ereignis, {} Ereignisse\n",
+      name,
+      per_event(kind.event_bytes),
+      per_event(kind.state_bytes),
+      kind.count);
+  };
+  print_kind("Treffer", hits);
+  print_kind("Punkte", scores);
+  fmt::print("  Übernehmen        {:>6.1f} ns je Ereignis\n",
+    event_count == 0 ? 0.0 : apply_ns / static_cast<double>(event_count));
+  fmt::print("  Empfänger          {}\n", consistent ? "wie Sender" : "FEHLER: weicht vom Sender ab");
+  fmt::print("  Doppelt zugestellt {}\n", idempotent ? "ohne Auswirkung" : "FEHLER: Zustand weicht ab");
+  fmt::print("  Vertauscht         {}\n", order_independent ? "ohne Auswirkung" : "FEHLER: Zustand weicht ab");
+
+  google::protobuf::ShutdownProtobufLibrary();
+
+  return idempotent && consistent && order_independent ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,170 @@
+#include <chrono>
+#include <cstdlib>
+#include <fmt/format.h>
+#include <random>
+#include <string>
+
+#include "arkanoid.pb.h"
+#include "asio/buffer.hpp"
+#include "asio/read_until.hpp"
+#include "asio/streambuf.hpp"
+
+#include "framing.hpp"
+
+namespace {
+
+std::string const legacy_end_of_message{ "\n\r\r" };
+std::size_t constexpr chunk_size{ 4096 };
+
+// Liefert einen vorbereiteten Datenstrom in Blöcken, wie es ein Socket tun würde.
+class MemoryStream
+{
+private:
+  std::string const &m_data;
+  std::size_t m_position{ 0 };
+
+public:
+  explicit MemoryStream(std::string const &data) : m_data{ data } {}
+
+  template<typename MutableBufferSequence>//
+  std::size_t read_some(MutableBufferSequence const &buffers, asio::error_code &ec)
+  {
+    if (m_position >= m_data.size()) {
+      ec = asio::error::eof;
+      return 0;
+    }
+
+    std::size_t const length = std::min({ chunk_size, asio::buffer_size(buffers), m_data.size() - m_position });
+    asio::buffer_copy(buffers, asio::buffer(m_data.data() + m_position, length));
+    m_position += length;
+    ec = {};
+
+    return length;
+  }
+
+  template<typename MutableBufferSequence>//
+  std::size_t read_some(MutableBufferSequence const &buffers)
+  {
+    asio::error_code ec;
+    auto const length = read_some(buffers, ec);
+    if (ec) { throw asio::system_error{ ec }; }
+    return length;
+  }
+};
+
+GameUpdate build_update(std::default_random_engine &engine, int const elements)
+{
+  std::uniform_real_distribution<float> position{ 0.0F, 200.0F };
+  std::uniform_real_distribution<float> velocity{ -3.0F, 3.0F };
+  GameUpdate update;
+
+  for (int i{ 0 }; i < elements; ++i) {
+    auto *element = update.add_element();
+    element->set_id(i);
+    element->mutable_element_position()->set_x(position(engine));
+    element->mutable_element_position()->set_y(position(engine));
+    element->mutable_ball()->set_velocity_x(velocity(engine));
+    element->mutable_ball()->set_velocity_y(velocity(engine));
+  }
+
+  return update;
+}
+
+struct Result
+{
+  int parsed{ 0 };
+  double seconds{ 0 };
+};
+
+Result run_legacy(std::string const &stream_data)
+{
+  MemoryStream stream{ stream_data };
+  asio::streambuf buffer;
+  Result result;
+  auto const start = std::chrono::steady_clock::now();
+
+  while (true) {
+    asio::error_code ec;
+    GameUpdate update;
+    std::size_t const bytes_transferred = asio::read_until(stream, buffer, legacy_end_of_message, ec);
+
+    if (ec) { break; }
+
+    std::string message(bytes_transferred - legacy_end_of_message.size(), '\0');
+    (void)asio::buffer_copy(asio::buffer(message), buffer.data());
+    buffer.consume(bytes_transferred);
+
+    if (update.ParseFromString(message)) { ++result.parsed; }
+  }
+
+  result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  return result;
+}
+
+Result run_length_prefixed(std::string const &stream_data)
+{
+  MemoryStream stream{ stream_data };
+  connection::FrameReader reader;
+  GameUpdate update;
+  Result result;
+  auto const start = std::chrono::steady_clock::now();
+
+  while (true) {
+    asio::error_code ec;
+    std::size_t const bytes_transferred = stream.read_some(reader.prepare(), ec);
+
+    if (ec) { break; }
+
+    reader.commit(bytes_transferred);
+    bool const valid = reader.consume_frames([&update, &result](char const *data, int const size) {
+      if (update.ParseFromArray(data, size)) { ++result.parsed; }
+    });
+
+    if (!valid) { break; }
+  }
+
+  result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  return result;
+}
+
+void compare(std::string const &name, int const elements_per_update, int const messages_per_run)
+{
+  std::default_random_engine engine{ 42 };
+  std::string legacy_stream;
+  std::string prefixed_stream;
+
+  for (int i{ 0 }; i < messages_per_run; ++i) {
+    auto const update = build_update(engine, elements_per_update);
+    legacy_stream += update.SerializeAsString() + legacy_end_of_message;
+    connection::append_frame(update, prefixed_stream);
+  }
+
+  auto const legacy = run_legacy(legacy_stream);
+  auto const prefixed = run_length_prefixed(prefixed_stream);
+
+  auto print = [&](std::string const &framing, Result const &result, std::string const &data) {
+    fmt::print("{:<24} {:<16} {:>9}/{} msgs {:>10.0f} msgs/s {:>8.1f} MB/s\n",
+      name,
+      framing,
+      result.parsed,
+      messages_per_run,
+      result.parsed / result.seconds,
+      static_cast<double>(data.size()) / result.seconds / 1e6);
+  };
+
+  print("sentinel", legacy, legacy_stream);
+  print("varint-prefix", prefixed, prefixed_stream);
+}
+
+}// namespace
+
+int main()
+{
+  compare("paddle (1 element)", 1, 500000);
+  compare("contact (3 elements)", 3, 200000);
+  compare("full sync (64 elements)", 64, 20000);
+
+  google::protobuf::ShutdownProtobufLibrary();
+
+  return EXIT_SUCCESS;
+}
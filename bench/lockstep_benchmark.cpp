@@ -0,0 +1,189 @@
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <deque>
+#include <fmt/format.h>
+#include <string>
+#include <utility>
+
+#include "arkanoid.pb.h"
+#include "box2d-incl/box2d/b2_world.h"
+
+#include "arkanoid_elements.hpp"
+#include "arkanoid_game.hpp"
+#include "lockstep.hpp"
+#include "match.hpp"
+#include "reliable_udp.hpp"
+#include "state_hash.hpp"
+
+namespace {
+
+long constexpr frames{ 2000 };
+long constexpr latency_frames{ 2 };
+long constexpr resend_frames{ 4 };// resend_interval bei 40 Frames/s
+std::uint32_t constexpr brick_seed{ 4711 };
+
+// Eine Seite im Lockstep wie in main(), nur ohne Bildschirm und Verbindung. Die Partie entsteht erst mit start().
+struct Peer
+{
+  b2World world{ { 0, 0 } };
+  arkanoid::ElementStore element_map;
+  ContactListener listener;
+  std::array<b2Fixture *, 2> back_plates{};
+  std::array<arkanoid::Paddle *, 2> players{ nullptr, nullptr };
+  arkanoid::Lockstep lockstep;
+  arkanoid::DesyncDetector desync;
+
+  Peer(int const local_player, int const redundancy) : lockstep{ local_player, redundancy } {}
+
+  void start(std::uint32_t const seed)
+  {
+    using namespace arkanoid;
+    int const paddle_y{ playing_field_bottom - paddle_height };
+    Vector const paddle_position{ (canvas_width / 2) - (paddle_width / 2), paddle_y };
+
+    world.SetContactListener(&listener);
+    back_plates = build_b2_world_border(&world);
+    generate_arkanoid_elements(paddle_position,
+      { playing_field_bottom - paddle_height },
+      { paddle_width / 2, -10 },
+      { ball_velocity_x, ball_velocity_y },
+      &world,
+      element_map,
+      seed);
+    players = prepare_lockstep_match(element_map, listener, back_plates);
+  }
+
+  // Ein Frame wie in run_game; gibt die zu sendende Nachricht zurück, sonst eine leere.
+  GameUpdate frame(long const frame, int const mouse_x)
+  {
+    GameUpdate update;
+    if (players[0] == nullptr) { return update; }
+
+    (void)lockstep.schedule_local(mouse_x, update);
+
+    if (lockstep.ready()) {
+      step_lockstep(world, element_map, players, lockstep.inputs(), 1.0F / bench::frame_rate);
+      element_map.disable_destroyed_bricks();
+      desync.record_local(lockstep.tick(), state_hash(element_map));
+      lockstep.advance();
+    } else {
+      lockstep.stall();
+      lockstep.fill_resend(update);
+    }
+
+    if (!update.has_lockstep_input()) { return {}; }
+    update.set_tick(frame);
+    desync.fill_every(update, arkanoid::state_hash_interval_ticks);
+    return update;
+  }
+
+  void receive(std::string const &bytes)
+  {
+    GameUpdate update;
+    if (!update.ParseFromString(bytes)) { return; }
+    if (update.has_lockstep_start() && players[0] == nullptr) { start(update.lockstep_start().brick_seed()); }
+    lockstep.receive(update);
+    desync.receive(update);
+  }
+};
+
+struct InFlight
+{
+  long arrival;
+  std::string bytes;
+};
+
+// Spielt eine Partie zwischen zwei Seiten; mit drop_every > 0 geht das erste und danach jedes so vielte Datagramm
+// verloren. Dann wird wie über UDP aufgeteilt: Was zuverlässig gehen muss, kommt nach einer Wiederholung doch noch
+// an, der Rest nicht. Das erste Datagramm ist der Start des Hosts.
+bool play(char const *name, int const redundancy, long const drop_every)
+{
+  Peer host{ 0, redundancy };
+  Peer client{ 1, redundancy };
+  std::array<std::deque<InFlight>, 2> to{};// to[0] an den Host, to[1] an den Client
+  std::array<connection::DeliveryClassifier, 2> classifiers{};// classifiers[0] des Hosts
+  std::size_t bytes{ 0 }, messages{ 0 };
+  long dropped{ 0 };
+
+  auto transmit = [&](std::deque<InFlight> &queue, long const frame, GameUpdate const &part, bool const reliable) {
+    if (part.ByteSizeLong() == 0) { return; }
+    auto bytes_out = part.SerializeAsString();
+    ++messages;
+    bytes += bytes_out.size();
+
+    long arrival{ frame + latency_frames };
+    if (drop_every > 0 && static_cast<long>(messages - 1) % drop_every == 0) {
+      ++dropped;
+      if (!reliable) { return; }
+      arrival += resend_frames;
+    }
+    auto const later = std::find_if(
+      queue.begin(), queue.end(), [arrival](InFlight const &in_flight) { return in_flight.arrival > arrival; });
+    queue.insert(later, { arrival, std::move(bytes_out) });
+  };
+  auto send = [&](std::size_t const from, long const frame, GameUpdate update) {
+    GameUpdate reliable;
+    if (drop_every > 0) { classifiers[from].split(update, reliable); }
+    transmit(to[1 - from], frame, reliable, true);
+    transmit(to[1 - from], frame, update, false);
+  };
+  auto deliver = [](std::deque<InFlight> &queue, long const frame, Peer &peer) {
+    while (!queue.empty() && queue.front().arrival <= frame) {
+      peer.receive(queue.front().bytes);
+      queue.pop_front();
+    }
+  };
+
+  // Wie in main(): Der Host erzeugt die Partie und sendet nur den seed, einmal.
+  GameUpdate start;
+  start.mutable_lockstep_start()->set_brick_seed(brick_seed);
+  host.start(brick_seed);
+  send(0, 0, start);
+
+  for (long frame{ 0 }; frame < frames; ++frame) {
+    deliver(to[0], frame, host);
+    deliver(to[1], frame, client);
+    auto const phase = static_cast<double>(frame) / 10.0;
+    send(0, frame, host.frame(frame, static_cast<int>(arkanoid::canvas_width / 2.0 + std::sin(phase) * 40.0)));
+    send(1, frame, client.frame(frame, static_cast<int>(arkanoid::canvas_width / 2.0 + std::cos(phase) * 40.0)));
+  }
+
+  // Zum Vergleich: der vollständige Zustand, wie ihn der Host sonst zu Beginn sendet.
+  GameUpdate full_state;
+  arkanoid::fill_game_update(&full_state, host.element_map.values());
+
+  // Der Client beginnt erst mit dem Start des Hosts und kann am Ende einen Tick zurückliegen.
+  bool const in_sync = host.desync.mismatched() == 0 && client.desync.mismatched() == 0
+                       && host.desync.matched() > 0
+                       && (host.lockstep.tick() != client.lockstep.tick()
+                           || state_hash(host.element_map) == state_hash(client.element_map));
+
+  fmt::print("{:<24} {:>5} Ticks, {:>4} Frames gewartet, {:>5.1f} Bytes je Nachricht, {:>3} verloren, {} gleich {}\n",
+    name,
+    host.lockstep.tick(),
+    host.lockstep.stalled_frames(),
+    messages > 0 ? static_cast<double>(bytes) / static_cast<double>(messages) : 0.0,
+    dropped,
+    host.desync.matched(),
+    in_sync ? "(synchron)" : "FEHLER: Abweichung");
+  fmt::print(
+    "{:<24} Start: {} Bytes seed statt {} Bytes Zustand\n", "", start.ByteSizeLong(), full_state.ByteSizeLong());
+
+  return in_sync;
+}
+
+}// namespace
+
+int main()
+{
+  bool ok{ true };
+  ok = play("TCP, ohne Verlust", 1, 0) && ok;
+  ok = play("UDP, jede 7. verloren", 4, 7) && ok;
+
+  google::protobuf::ShutdownProtobufLibrary();
+
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
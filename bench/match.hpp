@@ -0,0 +1,103 @@
+#ifndef BENCH_MATCH_CPP
+#define BENCH_MATCH_CPP
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "arkanoid.pb.h"
+#include "box2d-incl/box2d/b2_world.h"
+
+#include "arkanoid_elements.hpp"
+#include "arkanoid_game.hpp"
+#include "rollback.hpp"
+
+namespace bench {
+
+int constexpr frame_rate{ 40 };
+// Feste Anordnung der Steine, damit jeder Lauf dieselbe Partie misst.
+std::uint32_t constexpr brick_seed{ 4711 };
+auto constexpr frame_time_budget{ std::chrono::microseconds(1000000 / frame_rate) };
+
+// Ein Spiel wie in main(), nur ohne Bildschirm und Verbindung.
+struct Match
+{
+  b2World world{ { 0, 0 } };
+  arkanoid::ElementStore element_map;
+  ContactListener listener;
+  std::array<b2Fixture *, 2> back_plates{};
+  std::array<arkanoid::Paddle *, 2> paddle_ptrs{ nullptr, nullptr };
+  std::vector<arkanoid::Element *> updated_elements;
+  arkanoid::RollbackState rollback;
+  long tick{ 0 };
+
+  Match()
+  {
+    using namespace arkanoid;
+    int const paddle_y{ playing_field_bottom - paddle_height };
+    Vector const paddle_position{ (canvas_width / 2) - (paddle_width / 2), paddle_y };
+
+    world.SetContactListener(&listener);
+    back_plates = build_b2_world_border(&world);
+    generate_arkanoid_elements(paddle_position,
+      { playing_field_bottom - paddle_height },
+      { paddle_width / 2, -10 },
+      { ball_velocity_x, ball_velocity_y },
+      &world,
+      element_map,
+      brick_seed);
+  }
+
+  [[nodiscard]] static int mouse_x_at(long const tick)
+  {
+    return static_cast<int>(arkanoid::canvas_width / 2.0 + std::sin(static_cast<double>(tick) / 10.0) * 40.0);
+  }
+
+  void simulate_tick(int const mouse_x)
+  {
+    if (find_paddle_ptrs(paddle_ptrs, back_plates, element_map, listener)) {
+      update_paddle_position(paddle_ptrs[0], mouse_x);
+    }
+
+    world.Step(1.0F / frame_rate, 4, 2);
+    element_map.disable_destroyed_bricks();
+
+    element_map.for_each([this](auto &element) {
+      if (element.did_update()
+          && std::find(updated_elements.begin(), updated_elements.end(), &element) == updated_elements.end()) {
+        updated_elements.push_back(&element);
+      }
+    });
+  }
+
+  // Ein regulärer Tick inklusive Neuberechnung, falls Updates zurückgestellt wurden. Danach enthält
+  // updated_elements alle Elemente, die das Spiel in diesem Tick versenden würde.
+  int advance()
+  {
+    updated_elements.clear();
+    auto const apply = [this](GameUpdate const &update) { arkanoid::parse_game_update(element_map, update, &world); };
+    auto const step = [this](long const /*at_tick*/, int const mouse_x) { simulate_tick(mouse_x); };
+    int const resimulated = rollback.resimulate(world, element_map, listener, apply, step);
+
+    rollback.record(tick, mouse_x_at(tick), world, element_map, apply);
+    simulate_tick(mouse_x_at(tick));
+    ++tick;
+
+    return resimulated;
+  }
+
+  // Zustand des gegnerischen Schlägers, wie ihn die Gegenstelle senden würde.
+  [[nodiscard]] GameUpdate remote_update() const
+  {
+    GameUpdate update;
+    arkanoid::fill_game_update(&update, { paddle_ptrs[1] });
+    return update;
+  }
+};
+
+}// namespace bench
+
+#endif
@@ -0,0 +1,137 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <fmt/format.h>
+#include <random>
+#include <string>
+
+#include "arkanoid.pb.h"
+
+#include "arkanoid_elements.hpp"
+#include "match.hpp"
+#include "quantization.hpp"
+
+namespace {
+
+int constexpr round_trips{ 1000000 };
+
+[[nodiscard]] GameElement make_ball(float const x, float const y, float const velocity_x, float const velocity_y)
+{
+  GameElement element;
+  element.set_id(3);
+  element.mutable_element_position()->set_x(x);
+  element.mutable_element_position()->set_y(y);
+  element.mutable_ball()->set_velocity_x(velocity_x);
+  element.mutable_ball()->set_velocity_y(velocity_y);
+  return element;
+}
+
+// Packt zufällige Werte aus dem gesamten Bereich und prüft, dass der Fehler höchstens die halbe Auflösung beträgt.
+[[nodiscard]] bool check_round_trip(connection::Quantization const &quantization)
+{
+  std::default_random_engine engine{ 42 };
+  auto distribution = [](connection::QuantizedRange const &range) {
+    return std::uniform_real_distribution<float>{ range.min, range.max };
+  };
+  auto position_x = distribution(quantization.position_x);
+  auto position_y = distribution(quantization.position_y);
+  auto velocity = distribution(quantization.velocity);
+
+  float max_position_error{ 0.0F }, max_velocity_error{ 0.0F };
+  for (int i{ 0 }; i < round_trips; ++i) {
+    auto const original = make_ball(position_x(engine), position_y(engine), velocity(engine), velocity(engine));
+    auto element = original;
+
+    connection::pack_element(element, quantization);
+    GameElement received;
+    received.ParseFromString(element.SerializeAsString());
+    connection::unpack_element(received, quantization);
+
+    max_position_error = std::max({ max_position_error,
+      std::abs(received.element_position().x() - original.element_position().x()),
+      std::abs(received.element_position().y() - original.element_position().y()) });
+    max_velocity_error = std::max({ max_velocity_error,
+      std::abs(received.ball().velocity_x() - original.ball().velocity_x()),
+      std::abs(received.ball().velocity_y() - original.ball().velocity_y()) });
+  }
+
+  // Der Rundungsfehler von float kommt zur halben Auflösung hinzu.
+  auto const tolerance = [](connection::QuantizedRange const &range) {
+    return (range.precision / 2.0F) + (std::max(std::abs(range.min), std::abs(range.max)) * 1e-6F);
+  };
+  bool const positions_ok = max_position_error <= tolerance(quantization.position_x);
+  bool const velocities_ok = max_velocity_error <= tolerance(quantization.velocity);
+
+  auto zero = make_ball(0.0F, 0.0F, 0.0F, 0.0F);
+  connection::pack_element(zero, quantization);
+  connection::unpack_element(zero, quantization);
+  bool const zero_ok = zero.element_position().x() == 0.0F && zero.ball().velocity_y() == 0.0F;
+
+  fmt::print("Auflösung {:.4f}/{:.5f} ({}+{}+{} Bit): max. Fehler Position {:.5f} {}, Geschwindigkeit {:.6f} {}, "
+             "0 exakt {}\n",
+    quantization.position_x.precision,
+    quantization.velocity.precision,
+    quantization.position_x.bits(),
+    quantization.position_y.bits(),
+    quantization.velocity.bits(),
+    max_position_error,
+    positions_ok ? "ok" : "FEHLER",
+    max_velocity_error,
+    velocities_ok ? "ok" : "FEHLER",
+    zero_ok ? "ok" : "FEHLER");
+
+  return positions_ok && velocities_ok && zero_ok;
+}
+
+// Vergleicht die Größe der Elemente eines Spiels mit float-Feldern und bitgepackt.
+void compare_sizes(connection::Quantization const &quantization)
+{
+  bench::Match match;
+  for (int i{ 0 }; i < 400; ++i) { (void)match.advance(); }
+
+  std::array<std::size_t, 3> plain_bytes{}, packed_bytes{};
+  std::array<int, 3> counts{};
+  float max_speed{ 0.0F };
+
+  match.element_map.for_each([&](arkanoid::Element &element) {
+    GameElement net_element;
+    arkanoid::fill_game_element(&net_element, &element);
+    auto const kind = static_cast<std::size_t>(element.get_type());
+
+    plain_bytes[kind] += net_element.ByteSizeLong();
+    connection::snap_element(net_element, quantization);
+    connection::pack_element(net_element, quantization);
+    packed_bytes[kind] += net_element.ByteSizeLong();
+    ++counts[kind];
+
+    if (auto const *ball = arkanoid::element_cast<arkanoid::Ball>(&element)) {
+      auto const velocity = ball->velocity();
+      max_speed = std::max({ max_speed, std::abs(velocity.x), std::abs(velocity.y) });
+    }
+  });
+
+  for (auto const kind : { arkanoid::BALL, arkanoid::PADDLE, arkanoid::BRICK }) {
+    auto const index = static_cast<std::size_t>(kind);
+    fmt::print("{:<8} float {:>5.1f} Bytes, gepackt {:>5.1f} Bytes\n",
+      kind == arkanoid::BALL ? "Ball" : (kind == arkanoid::PADDLE ? "Schläger" : "Stein"),
+      static_cast<double>(plain_bytes[index]) / counts[index],
+      static_cast<double>(packed_bytes[index]) / counts[index]);
+  }
+  fmt::print("Größte Ballgeschwindigkeit {:.2f} (Bereich ±{:.0f})\n", max_speed, quantization.velocity.max);
+}
+
+}// namespace
+
+int main()
+{
+  bool ok{ true };
+  ok = check_round_trip(arkanoid::wire_quantization()) && ok;
+  ok = check_round_trip(arkanoid::wire_quantization(1.0F / 8.0F, 1.0F / 128.0F)) && ok;
+  ok = check_round_trip(arkanoid::wire_quantization(1.0F / 1024.0F, 1.0F / 16384.0F)) && ok;
+
+  compare_sizes(arkanoid::wire_quantization());
+
+  google::protobuf::ShutdownProtobufLibrary();
+
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,216 @@
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <deque>
+#include <filesystem>
+#include <fmt/format.h>
+#include <optional>
+#include <utility>
+
+#include "arkanoid.pb.h"
+#include "box2d-incl/box2d/b2_world.h"
+
+#include "lockstep.hpp"
+#include "match.hpp"
+#include "replay.hpp"
+
+namespace {
+
+long constexpr ticks{ 4000 };
+long constexpr remote_update_interval_ticks{ 4 };
+
+// Der Schläger der Gegenstelle, wie sie ihn senden würde.
+[[nodiscard]] GameUpdate remote_update(arkanoid::ElementStore const &elements, long const tick)
+{
+  GameUpdate update;
+  update.set_tick(tick);
+  arkanoid::fill_game_update(&update, { &elements.paddles()[1] });
+  auto *paddle = update.mutable_element(0);
+  paddle->mutable_paddle()->set_controlled_by_sender(true);
+  paddle->mutable_element_position()->set_x(
+    static_cast<float>(arkanoid::canvas_width / 2.0 + std::cos(static_cast<double>(tick) / 15.0) * 50.0));
+  return update;
+}
+
+// Eine Seite im Lockstep wie in run_game, ohne Bildschirm und Verbindung.
+struct LockstepPeer
+{
+  b2World world{ { 0, 0 } };
+  arkanoid::ElementStore element_map;
+  ContactListener listener;
+  std::array<b2Fixture *, 2> back_plates{};
+  std::array<arkanoid::Paddle *, 2> players{ nullptr, nullptr };
+  arkanoid::Lockstep lockstep;
+
+  explicit LockstepPeer(int const local_player) : lockstep{ local_player }
+  {
+    using namespace arkanoid;
+    int const paddle_y{ playing_field_bottom - paddle_height };
+    Vector const paddle_position{ (canvas_width / 2) - (paddle_width / 2), paddle_y };
+
+    world.SetContactListener(&listener);
+    back_plates = build_b2_world_border(&world);
+    generate_arkanoid_elements(paddle_position,
+      { playing_field_bottom - paddle_height },
+      { paddle_width / 2, -10 },
+      { ball_velocity_x, ball_velocity_y },
+      &world,
+      element_map,
+      4711);
+    players = prepare_lockstep_match(element_map, listener, back_plates);
+  }
+
+  // Ein Frame; gibt die zu sendende Nachricht zurück, falls es eine gibt.
+  [[nodiscard]] std::optional<GameUpdate> frame(long const frame, int const mouse_x)
+  {
+    GameUpdate update;
+    (void)lockstep.schedule_local(mouse_x, update);
+
+    if (lockstep.ready()) {
+      step_lockstep(world, element_map, players, lockstep.inputs(), 1.0F / bench::frame_rate);
+      element_map.disable_destroyed_bricks();
+      lockstep.advance();
+    } else {
+      lockstep.stall();
+    }
+
+    if (!update.has_lockstep_input()) { return std::nullopt; }
+    update.set_tick(frame);
+    return update;
+  }
+};
+
+// Zeichnet eine Lockstep-Partie aus Sicht des Clients auf. Die Nachrichten des Hosts kommen zeitweise erst nach acht
+// Frames an, sodass der Client auch warten muss.
+[[nodiscard]] bool record_lockstep(std::filesystem::path const &path)
+{
+  using namespace arkanoid;
+  LockstepPeer host{ 0 };
+  LockstepPeer client{ 1 };
+  ReplayWriter writer;
+  if (!writer.open(path.string(), ReplayMode::LOCKSTEP, bench::frame_rate)) { return false; }
+
+  std::optional<GameUpdate> to_host;
+  std::deque<std::pair<long, GameUpdate>> to_client;// Ankunft, Nachricht
+  for (long frame{ 0 }; frame < ticks; ++frame) {
+    auto const client_x = bench::Match::mouse_x_at(frame);
+    writer.set_tick(frame);
+    writer.record_input(client_x);
+
+    while (!to_client.empty() && to_client.front().first <= frame) {
+      writer.record_update(to_client.front().second, false);
+      client.lockstep.receive(to_client.front().second);
+      to_client.pop_front();
+    }
+    if (to_host) { host.lockstep.receive(*to_host); }
+
+    to_host = client.frame(frame, client_x);
+    if (to_host) { writer.record_update(*to_host, true); }
+    if (auto sent = host.frame(frame, bench::Match::mouse_x_at(frame + 90))) {
+      to_client.emplace_back(frame + (frame % 50 < 10 ? 8 : 1), std::move(*sent));
+    }
+
+    if (writer.keyframe_due()) {
+      writer.record_keyframe(client.world, client.element_map, client.players[1], client.lockstep.tick());
+    }
+  }
+  return true;
+}
+
+// Berechnet die Aufzeichnung ab dem Keyframe bei from neu.
+[[nodiscard]] bool replay(arkanoid::ReplayReader const &reader, std::int64_t const from, char const *name)
+{
+  using namespace arkanoid;
+  ReplaySession session{ reader.header().mode, static_cast<int>(reader.header().frame_rate) };
+
+  auto const start = std::chrono::steady_clock::now();
+  bool const played = session.play(reader, *reader.seek(from));
+  auto const seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  fmt::print("  {:<22} {:>5} Ticks, {:>7.0f} Ticks/s ({:>4.0f}x Echtzeit), Keyframes {} gleich, {} abweichend, {} "
+             "ungeprüft\n",
+    name,
+    session.ticks(),
+    static_cast<double>(session.ticks()) / seconds,
+    static_cast<double>(session.ticks()) / seconds / bench::frame_rate,
+    session.matched(),
+    session.mismatched(),
+    session.unchecked());
+  return played && session.mismatched() == 0 && session.unchecked() == 0 && session.matched() > 0;
+}
+
+}// namespace
+
+int main()
+{
+  using namespace arkanoid;
+  auto const path = std::filesystem::temp_directory_path() / "arkanoid_replay_benchmark.replay";
+
+  double record_ns{ 0 };
+  std::size_t records{ 0 }, bytes{ 0 };
+  {
+    // Die aufgezeichnete Partie rechnet wie run_game im direkten Modus; die Gegenstelle sendet ihren Schläger.
+    ReplaySession live{ ReplayMode::PEER, bench::frame_rate };
+    ReplayWriter writer;
+    if (!writer.open(path.string(), ReplayMode::PEER, bench::frame_rate)) {
+      fmt::print("FEHLER: {} kann nicht angelegt werden\n", path.string());
+      return EXIT_FAILURE;
+    }
+
+    for (long tick{ 0 }; tick < ticks; ++tick) {
+      auto const mouse_x = bench::Match::mouse_x_at(tick);
+      auto const update = remote_update(live.elements(), tick);
+
+      auto start = std::chrono::steady_clock::now();
+      writer.set_tick(tick);
+      writer.record_input(mouse_x);
+      if (tick % remote_update_interval_ticks == 0) { writer.record_update(update, false); }
+      record_ns += std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+      if (tick % remote_update_interval_ticks == 0) { live.receive(update); }
+      live.simulate(tick, mouse_x);
+
+      start = std::chrono::steady_clock::now();
+      if (writer.keyframe_due()) {
+        writer.record_keyframe(live.world(), live.elements(), &live.elements().paddles()[0]);
+      }
+      record_ns += std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    }
+    records = writer.records();
+    bytes = writer.bytes();
+  }
+
+  ReplayReader reader;
+  if (!reader.open(path.string())) {
+    fmt::print("FEHLER: Aufzeichnung nicht lesbar\n");
+    return EXIT_FAILURE;
+  }
+
+  fmt::print("{} Ticks: {} Einträge, {} Bytes ({:.0f} je Tick), {} Keyframes, Aufzeichnen {:.0f} ns je Tick\n",
+    ticks,
+    records,
+    bytes,
+    static_cast<double>(bytes) / ticks,
+    reader.keyframes().size(),
+    record_ns / ticks);
+
+  bool ok = replay(reader, 0, "ab Beginn");
+  // Beim Einstieg mitten in der Partie fehlt der Verlauf des Interpolators; er ist nach einem Update wieder da.
+  ok = replay(reader, ticks / 2, "ab der Mitte") && ok;
+
+  // Im Lockstep entstehen die Ticks allein aus den Eingaben beider Seiten.
+  ReplayReader lockstep_reader;
+  if (!record_lockstep(path) || !lockstep_reader.open(path.string())) {
+    fmt::print("FEHLER: Lockstep-Aufzeichnung nicht lesbar\n");
+    return EXIT_FAILURE;
+  }
+  ok = replay(lockstep_reader, 0, "Lockstep ab Beginn") && ok;
+  ok = replay(lockstep_reader, ticks / 2, "Lockstep ab der Mitte") && ok;
+
+  std::filesystem::remove(path);
+  google::protobuf::ShutdownProtobufLibrary();
+
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
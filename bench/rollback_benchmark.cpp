@@ -0,0 +1,109 @@
+#include <chrono>
+#include <cstdlib>
+#include <fmt/format.h>
+
+#include "arkanoid.pb.h"
+
+#include "arkanoid_elements.hpp"
+#include "match.hpp"
+#include "rollback.hpp"
+
+namespace {
+
+using bench::frame_time_budget;
+using bench::Match;
+
+long constexpr warmup_ticks{ 400 };
+int constexpr repetitions{ 200 };
+
+void measure_capture()
+{
+  Match match;
+  for (long i{ 0 }; i < warmup_ticks; ++i) { (void)match.advance(); }
+
+  arkanoid::WorldSnapshot snapshot;
+  auto const start = std::chrono::steady_clock::now();
+  for (int i{ 0 }; i < repetitions * 10; ++i) { snapshot.capture(match.world, match.element_map); }
+  auto const capture = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start);
+
+  fmt::print("{} Körper, {} Elemente: Sichern {:.2f} us\n",
+    match.world.GetBodyCount(),
+    match.element_map.size(),
+    capture.count() / (repetitions * 10));
+}
+
+void measure_resimulation(int const ticks_back)
+{
+  Match match;
+  for (long i{ 0 }; i < warmup_ticks; ++i) { (void)match.advance(); }
+
+  std::chrono::duration<double, std::micro> rollback_time{ 0 };
+  std::chrono::duration<double, std::micro> tick_time{ 0 };
+  long resimulated{ 0 };
+
+  for (int i{ 0 }; i < repetitions; ++i) {
+    auto const plain_start = std::chrono::steady_clock::now();
+    (void)match.advance();
+    tick_time += std::chrono::steady_clock::now() - plain_start;
+
+    match.rollback.defer(match.remote_update(), ticks_back);
+
+    auto const start = std::chrono::steady_clock::now();
+    resimulated += match.advance();
+    rollback_time += std::chrono::steady_clock::now() - start;
+  }
+
+  // Jeder Frame mit Rollback berechnet die zurückliegenden Ticks und den aktuellen.
+  double const per_tick_us = rollback_time.count() / static_cast<double>(resimulated + repetitions);
+  fmt::print("{:>3} Ticks zurück: {:>8.1f} us pro Frame ({:>5.1f} us Normalbetrieb), {:>6.2f} us pro "
+             "berechnetem Tick, {:>6.0f} Ticks pro {} ms Frame\n",
+    ticks_back,
+    rollback_time.count() / repetitions,
+    tick_time.count() / repetitions,
+    per_tick_us,
+    std::chrono::duration<double, std::micro>(frame_time_budget).count() / per_tick_us,
+    std::chrono::duration_cast<std::chrono::milliseconds>(frame_time_budget).count());
+}
+
+// Ein rechtzeitig eingetroffenes Update muss auch ein Rollback über seinen Tick hinweg überstehen.
+[[nodiscard]] bool check_on_time_update()
+{
+  Match match;
+  for (long i{ 0 }; i < warmup_ticks; ++i) { (void)match.advance(); }
+
+  arkanoid::Brick *target{ nullptr };
+  match.element_map.bricks().for_each([&target](arkanoid::Brick &brick) {
+    if (target == nullptr && brick.duration() > 0) { target = &brick; }
+  });
+  if (target == nullptr) { return false; }
+
+  GameUpdate update;
+  arkanoid::fill_game_update(&update, { target });
+  update.mutable_element(0)->mutable_brick()->set_duration(0);
+  match.rollback.defer(update, 0);
+  (void)match.advance();
+  for (int i{ 0 }; i < 3; ++i) { (void)match.advance(); }
+
+  match.rollback.defer(match.remote_update(), 5);
+  (void)match.advance();
+
+  bool const kept = target->duration() == 0;
+  fmt::print("Rechtzeitiges Update nach Rollback über seinen Tick: {}\n", kept ? "erhalten" : "FEHLER: verloren");
+  return kept;
+}
+
+}// namespace
+
+int main()
+{
+  bool const on_time_kept = check_on_time_update();
+  measure_capture();
+
+  for (int const ticks_back : { 1, 2, 4, 8, 16, static_cast<int>(arkanoid::rollback_history_ticks) - 1 }) {
+    measure_resimulation(ticks_back);
+  }
+
+  google::protobuf::ShutdownProtobufLibrary();
+
+  return on_time_kept ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,233 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <fmt/format.h>
+#include <string>
+#include <vector>
+
+#include "arkanoid.pb.h"
+#include "box2d-incl/box2d/b2_contact.h"
+#include "box2d-incl/box2d/b2_world.h"
+
+#include "match.hpp"
+#include "match_snapshot.hpp"
+#include "rollback.hpp"
+#include "state_hash.hpp"
+
+namespace {
+
+using bench::Match;
+
+long constexpr warmup_ticks{ 400 };
+long constexpr max_search_ticks{ 2000 };
+long constexpr rewind_ticks{ 120 };
+int constexpr repetitions{ 2000 };
+long constexpr sweep_ticks{ 300 };
+long constexpr sweep_replay_ticks{ 8 };
+float constexpr sweep_gap{ 4.0F };
+
+[[nodiscard]] std::vector<std::uint64_t> play(Match &match, long const ticks)
+{
+  std::vector<std::uint64_t> hashes;
+  for (long i{ 0 }; i < ticks; ++i) {
+    (void)match.advance();
+    hashes.push_back(arkanoid::state_hash(match.element_map));
+  }
+  return hashes;
+}
+
+// Ob sich gerade Körper berühren und der nächste Step ihre Impulse für den Warmstart übernimmt, etwa ein Ball an
+// einem Stein oder Schläger.
+[[nodiscard]] bool has_active_contact(b2World const &world)
+{
+  for (auto const *contact = world.GetContactList(); contact != nullptr; contact = contact->GetNext()) {
+    auto const *manifold = contact->GetManifold();
+    for (int i{ 0 }; i < manifold->pointCount; ++i) {
+      if (manifold->points[i].normalImpulse != 0.0F) { return true; }
+    }
+  }
+  return false;
+}
+
+// Der unterste Stein mit mehr als min_duration Haltbarkeit, unter dem kein anderer liegt: Ein Ball, der von unten
+// auf ihn zufliegt, trifft genau ihn.
+[[nodiscard]] arkanoid::Brick *brick_open_from_below(Match &match, int const min_duration)
+{
+  using namespace arkanoid;
+
+  std::vector<Brick *> bricks;
+  match.element_map.bricks().for_each([&bricks](Brick &brick) {
+    if (brick.duration() > 0) { bricks.push_back(&brick); }
+  });
+
+  Brick *target{ nullptr };
+  for (auto *brick : bricks) {
+    auto const position = brick->center_position();
+    bool const covered = std::any_of(bricks.begin(), bricks.end(), [&](Brick const *other) {
+      auto const other_position = other->center_position();
+      return other_position.y > position.y && std::abs(other_position.x - position.x) < brick_width + 2 * ball_radius;
+    });
+    if (brick->duration() > min_duration && !covered
+        && (target == nullptr || position.y > target->center_position().y)) {
+      target = brick;
+    }
+  }
+  return target;
+}
+
+// Erster Tick, in dem sich die Prüfsummen unterscheiden, sonst -1.
+[[nodiscard]] long first_difference(std::vector<std::uint64_t> const &expected,
+  std::vector<std::uint64_t> const &actual)
+{
+  for (std::size_t i{ 0 }; i < expected.size(); ++i) {
+    if (i >= actual.size() || expected[i] != actual[i]) { return static_cast<long>(i); }
+  }
+  return -1;
+}
+
+struct SweepResult
+{
+  int differences{ 0 };
+  int hits{ 0 };
+};
+
+[[nodiscard]] int total_duration(Match &match)
+{
+  int duration{ 0 };
+  match.element_map.bricks().for_each([&duration](arkanoid::Brick &brick) { duration += brick.duration(); });
+  return duration;
+}
+
+// Ein Ball fliegt aus kurzer Entfernung auf einen Stein zu, der mehrere Treffer übersteht, und prallt mehrfach ab.
+// Zurückgespult wird auf jeden von sweep_ticks aufeinanderfolgenden Ticks; gezählt werden die Ticks, nach denen die
+// Neuberechnung abweicht, und die Treffer, damit feststeht, dass der Vergleich Abpraller enthält.
+[[nodiscard]] SweepResult sweep_rollback()
+{
+  using namespace arkanoid;
+
+  Match match;
+  (void)play(match, warmup_ticks);
+  auto const *target = brick_open_from_below(match, 2);
+  auto &ball = match.element_map.balls()[0];
+  auto const brick = target->center_position();
+  ball.set_position({ brick.x, brick.y + (brick_height / 2.0F) + ball_radius + sweep_gap });
+  ball.set_velocity(convert_to_b2_coords({ ball_velocity_x, -ball_velocity_y }));
+
+  SweepResult result;
+  auto const duration_before = total_duration(match);
+  WorldSnapshot snapshot;
+  for (long i{ 0 }; i < sweep_ticks; ++i) {
+    snapshot.capture(match.world, match.element_map);
+    auto const tick = match.tick;
+    auto const expected = play(match, sweep_replay_ticks);
+
+    snapshot.restore(match.world, match.listener);
+    snapshot.restore_contacts(match.world, match.listener);
+    match.tick = tick;
+    if (first_difference(expected, play(match, sweep_replay_ticks)) >= 0) { ++result.differences; }
+
+    // Weiter mit dem nächsten Tick.
+    snapshot.restore(match.world, match.listener);
+    snapshot.restore_contacts(match.world, match.listener);
+    match.tick = tick;
+    (void)play(match, 1);
+  }
+  result.hits = duration_before - total_duration(match);
+  return result;
+}
+
+}// namespace
+
+int main()
+{
+  using namespace arkanoid;
+
+  Match match;
+  (void)play(match, warmup_ticks);
+  // Zurückgespult wird auf einen Tick mit Kontakt, sonst prüft der Vergleich weder Warmstart noch Berührungen. Von
+  // selbst erreichen die Bälle in so wenigen Ticks nichts; einer wird deshalb von unten leicht in einen Stein
+  // gesetzt, der den Treffer übersteht, und fliegt auf ihn zu. Der Kontakt hält bis zum Ende der Wiederholung, sodass
+  // beim Zurücksetzen Kontakte mit den Impulsen vom Ende bestehen.
+  auto const *target = brick_open_from_below(match, 1);
+  auto &ball = match.element_map.balls()[0];
+  auto const brick = target->center_position();
+  ball.set_position({ brick.x, brick.y + (brick_height / 2.0F) + ball_radius - 0.25F });
+  ball.set_velocity(convert_to_b2_coords({ ball_velocity_x, -ball_velocity_y }));
+  while (!has_active_contact(match.world) && match.tick < warmup_ticks + max_search_ticks) { (void)match.advance(); }
+  bool const in_contact = has_active_contact(match.world);
+
+  MatchSnapshot snapshot;
+  auto start = std::chrono::steady_clock::now();
+  for (int i{ 0 }; i < repetitions; ++i) { snapshot.capture(match.world, match.element_map, match.tick); }
+  auto const capture_us =
+    std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / repetitions;
+
+  // Wie ein Spielstand: Der Block wird kopiert und in einen neuen MatchSnapshot geladen.
+  std::vector<std::byte> const saved{ snapshot.data().begin(), snapshot.data().end() };
+  MatchSnapshot loaded;
+  bool const assigned = loaded.assign(saved);
+
+  WorldSnapshot world_snapshot;
+  world_snapshot.capture(match.world, match.element_map);
+
+  auto const expected = play(match, rewind_ticks);
+
+  // Zurückspulen und dieselben Ticks erneut berechnen: Mit dem Warmstart müssen alle Prüfsummen gleich sein.
+  bool const restored = loaded.restore(match.world, match.element_map);
+  match.tick = loaded.tick();
+  auto const replayed = play(match, rewind_ticks);
+  auto const difference = first_difference(expected, replayed);
+
+  // Ebenso mit dem Zustand des Rollbacks, der die Kontaktliste neu aufbaut.
+  world_snapshot.restore(match.world, match.listener);
+  world_snapshot.restore_contacts(match.world, match.listener);
+  match.tick = loaded.tick();
+  auto const rollback_difference = first_difference(expected, play(match, rewind_ticks));
+  auto const sweep = sweep_rollback();
+
+  // Zurücksetzen, nachdem sich die Welt jeweils einen Tick weiterbewegt hat.
+  double restore_us{ 0 };
+  for (int i{ 0 }; i < repetitions / 10; ++i) {
+    (void)match.advance();
+    start = std::chrono::steady_clock::now();
+    (void)snapshot.restore(match.world, match.element_map);
+    restore_us += std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+  }
+  restore_us /= repetitions / 10;
+
+  GameUpdate full_state;
+  fill_game_update(&full_state, match.element_map.values());
+
+  fmt::print("{} Körper, {} Elemente, zurückgespult auf Tick {}{}:\n",
+    match.world.GetBodyCount(),
+    match.element_map.size(),
+    loaded.tick(),
+    in_contact ? " mit Kontakt" : " ohne Kontakt");
+  fmt::print(
+    "  Größe     {:>6} Bytes (vollständiges GameUpdate {} Bytes)\n", snapshot.size(), full_state.ByteSizeLong());
+  fmt::print("  Sichern   {:>6.2f} us\n", capture_us);
+  fmt::print("  Setzen    {:>6.2f} us\n", restore_us);
+
+  // Ohne Kontakt prüft der Vergleich weder den Warmstart noch die Berührungen.
+  bool const same = assigned && restored && difference < 0;
+  bool const rollback_same = rollback_difference < 0;
+  auto const describe = [](bool const equal, long const at) {
+    return equal ? std::string{ "gleich" } : fmt::format("FEHLER: Abweichung ab Tick {}", at);
+  };
+  fmt::print("  {} Ticks nach dem Zurückspulen {}; WorldSnapshot {}{}\n",
+    rewind_ticks,
+    describe(same, difference),
+    describe(rollback_same, rollback_difference),
+    in_contact ? "" : "; FEHLER: kein Kontakt, der Vergleich prüft nichts");
+  fmt::print("  WorldSnapshot auf {} aufeinanderfolgende Ticks mit {} Treffern zurückgespult: {}{}\n",
+    sweep_ticks,
+    sweep.hits,
+    sweep.differences == 0 ? std::string{ "alle gleich" } : fmt::format("FEHLER: {} abweichend", sweep.differences),
+    sweep.hits > 0 ? "" : "; FEHLER: ohne Treffer prüft der Vergleich die Berührungen nicht");
+
+  google::protobuf::ShutdownProtobufLibrary();
+
+  return same && rollback_same && in_contact && sweep.differences == 0 && sweep.hits > 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,83 @@
+#include <array>
+#include <chrono>
+#include <cstdlib>
+#include <fmt/format.h>
+#include <string>
+#include <vector>
+
+#include "arkanoid.pb.h"
+
+#include "arkanoid_elements.hpp"
+#include "match.hpp"
+#include "spectator.hpp"
+#include "utils.hpp"
+
+namespace {
+
+int constexpr ticks{ 200 };
+
+// Jeder Zuschauer kodiert den Zustand selbst, wie es mit einer Connection pro Zuschauer geschähe.
+[[nodiscard]] std::size_t encode_per_viewer(bench::Match const &match, std::size_t const viewers)
+{
+  std::size_t bytes{ 0 };
+  for (std::size_t viewer{ 0 }; viewer < viewers; ++viewer) {
+    GameUpdate snapshot;
+    arkanoid::fill_game_update(&snapshot, match.element_map.values());
+    bytes += connection::encode_snapshot(snapshot, arkanoid::wire_quantization())->size();
+  }
+  return bytes;
+}
+
+// Einmal kodiert, jeder Zuschauer erhält nur eine weitere Referenz.
+[[nodiscard]] std::size_t encode_shared(bench::Match const &match, std::vector<connection::SharedFrame> &viewers)
+{
+  GameUpdate snapshot;
+  arkanoid::fill_game_update(&snapshot, match.element_map.values());
+  auto const frame = connection::encode_snapshot(snapshot, arkanoid::wire_quantization());
+  for (auto &viewer : viewers) { viewer = frame; }
+  return frame->size() * viewers.size();
+}
+
+void compare(std::size_t const viewers)
+{
+  bench::Match match;
+  std::vector<connection::SharedFrame> pending(viewers);
+  std::chrono::steady_clock::duration per_viewer{}, shared{};
+  std::size_t per_viewer_bytes{ 0 }, shared_bytes{ 0 };
+
+  for (int tick{ 0 }; tick < ticks; ++tick) {
+    (void)match.advance();
+
+    auto const start = std::chrono::steady_clock::now();
+    per_viewer_bytes += encode_per_viewer(match, viewers);
+    auto const middle = std::chrono::steady_clock::now();
+    shared_bytes += encode_shared(match, pending);
+    auto const end = std::chrono::steady_clock::now();
+
+    per_viewer += middle - start;
+    shared += end - middle;
+  }
+
+  auto const us_per_tick = [](auto const duration) {
+    return std::chrono::duration<double, std::micro>(duration).count() / ticks;
+  };
+  fmt::print("{:>5} Zuschauer: je Zuschauer kodiert {:>9.1f} us/Tick, einmal kodiert {:>7.1f} us/Tick ({:.0f}x), "
+             "{} Bytes {}\n",
+    viewers,
+    us_per_tick(per_viewer),
+    us_per_tick(shared),
+    us_per_tick(per_viewer) / us_per_tick(shared),
+    shared_bytes / ticks,
+    per_viewer_bytes == shared_bytes ? "gleich" : "UNTERSCHIEDLICH");
+}
+
+}// namespace
+
+int main()
+{
+  for (std::size_t const viewers : std::array<std::size_t, 4>{ 1, 10, 100, 1000 }) { compare(viewers); }
+
+  google::protobuf::ShutdownProtobufLibrary();
+
+  return EXIT_SUCCESS;
+}
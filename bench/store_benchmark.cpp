@@ -0,0 +1,108 @@
+#include <chrono>
+#include <cstdlib>
+#include <fmt/format.h>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "arkanoid.pb.h"
+#include "box2d-incl/box2d/b2_world.h"
+
+#include "arkanoid_elements.hpp"
+
+namespace {
+
+int constexpr repetitions{ 200 };
+
+// Ein Durchgang wie pro Frame: geänderte Elemente sammeln und verbliebene Steine zählen.
+template<typename ForEach>//
+[[nodiscard]] double measure_ns(std::size_t const count, std::vector<arkanoid::Element *> &updated, ForEach &&for_each)
+{
+  int live{ 0 };
+  auto pass = [&]() {
+    updated.clear();
+    for_each([&](arkanoid::Element &element) {
+      if (element.did_update()) { updated.push_back(&element); }
+      live += element.exists() ? 1 : 0;
+    });
+  };
+  pass();// aufwärmen
+
+  auto const start = std::chrono::steady_clock::now();
+  for (int i{ 0 }; i < repetitions; ++i) { pass(); }
+  auto const elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+  return live > 0 ? elapsed / static_cast<double>(count * repetitions) : 0.0;
+}
+
+// Wie get_winner vor den Zählern: einmal über alle Steine, bis einer noch steht.
+[[nodiscard]] bool bricks_left_by_scan(arkanoid::ElementStore const &store)
+{
+  bool bricks_left{ false };
+  store.bricks().for_each([&bricks_left](arkanoid::Brick &brick) { bricks_left = brick.exists() || bricks_left; });
+  return bricks_left;
+}
+
+template<typename Function>//
+[[nodiscard]] double measure_check_ns(Function &&function)
+{
+  long left{ 0 };
+  auto const start = std::chrono::steady_clock::now();
+  for (int i{ 0 }; i < repetitions; ++i) { left += function() ? 1 : 0; }
+  auto const elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+  return left > 0 ? elapsed / repetitions : 0.0;
+}
+
+// Gibt zurück, ob der Zähler lebender Steine nach dem Zerstören aller Steine bei 0 ankommt.
+bool compare(int const bricks)
+{
+  using namespace arkanoid;
+  b2World world{ { 0, 0 } };
+
+  // Abwechselnd angelegt, damit die Knoten der map wie nach einigen Updates im Speicher verstreut liegen.
+  std::map<int, std::unique_ptr<Element>> map;
+  ElementStore store;
+  for (int i{ 0 }; i < bricks; ++i) {
+    Vector const position{ static_cast<float>(i % 64), static_cast<float>(i / 64) };
+    auto &brick = store.emplace<Brick>(position, &world, 1 + (i % 3));
+    map.emplace(brick.id(), std::make_unique<Brick>(position, &world, 1 + (i % 3)));
+  }
+
+  std::vector<Element *> updated;
+  updated.reserve(static_cast<std::size_t>(bricks));
+  auto const count = static_cast<std::size_t>(bricks);
+
+  auto const before = measure_ns(count, updated, [&map](auto &&function) {
+    for (auto const &[id, element] : map) { function(*element); }
+  });
+  auto const after = measure_ns(count, updated, [&store](auto &&function) { store.for_each(function); });
+
+  fmt::print("{:>6} Steine: map {:>5.2f} ns, ElementStore {:>5.2f} ns je Element ({:.1f}x)\n",
+    bricks,
+    before,
+    after,
+    after > 0.0 ? before / after : 0.0);
+
+  auto const scan = measure_check_ns([&store]() { return bricks_left_by_scan(store); });
+  auto const counter = measure_check_ns([&store]() { return store.live_bricks() > 0; });
+  fmt::print("{:>6} Steine: Ende suchen {:>8.1f} ns, Zähler {:>5.1f} ns je Prüfung\n", bricks, scan, counter);
+
+  bool const counted_all = store.live_bricks() == count;
+  store.bricks().for_each([](Brick &brick) { brick.set_duration(0); });
+  store.disable_destroyed_bricks();
+  return counted_all && store.live_bricks() == 0 && !bricks_left_by_scan(store);
+}
+
+}// namespace
+
+int main()
+{
+  bool ok{ true };
+  for (auto const bricks : { 64, 1024, 8192 }) { ok = compare(bricks) && ok; }
+  if (!ok) { fmt::print("FEHLER: Zähler lebender Steine weicht ab\n"); }
+
+  google::protobuf::ShutdownProtobufLibrary();
+
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,152 @@
+#ifndef ALLOCATION_COUNTER_CPP
+#define ALLOCATION_COUNTER_CPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+// Ersetzt alle Formen des globalen operator new und delete, um Heap-Allokationen zu zählen. Darf wie alle Header nur
+// in eine Übersetzungseinheit pro Programm eingebunden werden.
+//
+// Die Ersetzungen sind nicht inline: Sonst sieht GCC an der Aufrufstelle malloc und free statt new und delete und
+// warnt mit -Wmismatched-new-delete.
+namespace allocation_counter {
+
+std::atomic<std::size_t> total{ 0 };
+thread_local std::size_t on_this_thread{ 0 };
+
+[[nodiscard]] std::size_t total_allocations() { return total.load(std::memory_order_relaxed); }
+
+// Nur Allokationen des aufrufenden Threads, z.B. um einen Abschnitt der Spielschleife zu messen.
+[[nodiscard]] std::size_t thread_allocations() { return on_this_thread; }
+
+// nullptr, wenn kein Speicher frei ist.
+[[gnu::noinline]] void *allocate(std::size_t size, std::size_t const alignment) noexcept
+{
+  total.fetch_add(1, std::memory_order_relaxed);
+  ++on_this_thread;
+
+  if (size == 0) { size = 1; }
+  if (alignment <= alignof(std::max_align_t)) { return std::malloc(size); }
+  // aligned_alloc verlangt ein Vielfaches der Ausrichtung.
+  return std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment);
+}
+
+[[gnu::noinline]] void *allocate_or_throw(std::size_t const size, std::size_t const alignment)
+{
+  if (void *memory = allocate(size, alignment)) { return memory; }
+  throw std::bad_alloc{};
+}
+
+[[gnu::noinline]] void release(void *memory) noexcept { std::free(memory); }
+
+}// namespace allocation_counter
+
+[[gnu::noinline]] void *operator new(std::size_t const size)
+{
+  return allocation_counter::allocate_or_throw(size, alignof(std::max_align_t));
+}
+
+[[gnu::noinline]] void *operator new[](std::size_t const size)
+{
+  return allocation_counter::allocate_or_throw(size, alignof(std::max_align_t));
+}
+
+[[gnu::noinline]] void *operator new(std::size_t const size, std::align_val_t const alignment)
+{
+  return allocation_counter::allocate_or_throw(size, static_cast<std::size_t>(alignment));
+}
+
+[[gnu::noinline]] void *operator new[](std::size_t const size, std::align_val_t const alignment)
+{
+  return allocation_counter::allocate_or_throw(size, static_cast<std::size_t>(alignment));
+}
+
+[[gnu::noinline]] void *operator new(std::size_t const size, std::nothrow_t const & /*tag*/) noexcept
+{
+  return allocation_counter::allocate(size, alignof(std::max_align_t));
+}
+
+[[gnu::noinline]] void *operator new[](std::size_t const size, std::nothrow_t const & /*tag*/) noexcept
+{
+  return allocation_counter::allocate(size, alignof(std::max_align_t));
+}
+
+[[gnu::noinline]] void *operator new(std::size_t const size,
+  std::align_val_t const alignment,
+  std::nothrow_t const & /*tag*/) noexcept
+{
+  return allocation_counter::allocate(size, static_cast<std::size_t>(alignment));
+}
+
+[[gnu::noinline]] void *operator new[](std::size_t const size,
+  std::align_val_t const alignment,
+  std::nothrow_t const & /*tag*/) noexcept
+{
+  return allocation_counter::allocate(size, static_cast<std::size_t>(alignment));
+}
+
+[[gnu::noinline]] void operator delete(void *memory) noexcept { allocation_counter::release(memory); }
+
+[[gnu::noinline]] void operator delete[](void *memory) noexcept { allocation_counter::release(memory); }
+
+[[gnu::noinline]] void operator delete(void *memory, std::size_t const /*size*/) noexcept
+{
+  allocation_counter::release(memory);
+}
+
+[[gnu::noinline]] void operator delete[](void *memory, std::size_t const /*size*/) noexcept
+{
+  allocation_counter::release(memory);
+}
+
+[[gnu::noinline]] void operator delete(void *memory, std::align_val_t const /*alignment*/) noexcept
+{
+  allocation_counter::release(memory);
+}
+
+[[gnu::noinline]] void operator delete[](void *memory, std::align_val_t const /*alignment*/) noexcept
+{
+  allocation_counter::release(memory);
+}
+
+[[gnu::noinline]] void operator delete(void *memory,
+  std::size_t const /*size*/,
+  std::align_val_t const /*alignment*/) noexcept
+{
+  allocation_counter::release(memory);
+}
+
+[[gnu::noinline]] void operator delete[](void *memory,
+  std::size_t const /*size*/,
+  std::align_val_t const /*alignment*/) noexcept
+{
+  allocation_counter::release(memory);
+}
+
+[[gnu::noinline]] void operator delete(void *memory, std::nothrow_t const & /*tag*/) noexcept
+{
+  allocation_counter::release(memory);
+}
+
+[[gnu::noinline]] void operator delete[](void *memory, std::nothrow_t const & /*tag*/) noexcept
+{
+  allocation_counter::release(memory);
+}
+
+[[gnu::noinline]] void operator delete(void *memory,
+  std::align_val_t const /*alignment*/,
+  std::nothrow_t const & /*tag*/) noexcept
+{
+  allocation_counter::release(memory);
+}
+
+[[gnu::noinline]] void operator delete[](void *memory,
+  std::align_val_t const /*alignment*/,
+  std::nothrow_t const & /*tag*/) noexcept
+{
+  allocation_counter::release(memory);
+}
+
+#endif
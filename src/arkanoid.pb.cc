@@ -14,193 +14,418 @@
 #include <google/protobuf/wire_format.h>
 // @@protoc_insertion_point(includes)
 #include <google/protobuf/port_def.inc>
-extern PROTOBUF_INTERNAL_EXPORT_arkanoid_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_ElementPosition_arkanoid_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_arkanoid_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<4> scc_info_GameElement_arkanoid_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_arkanoid_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_NetBall_arkanoid_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_arkanoid_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_NetBrick_arkanoid_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_arkanoid_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_NetPaddle_arkanoid_2eproto;
-class NetBallDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<NetBall> _instance;
-} _NetBall_default_instance_;
-class NetPaddleDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<NetPaddle> _instance;
-} _NetPaddle_default_instance_;
-class NetBrickDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<NetBrick> _instance;
-} _NetBrick_default_instance_;
-class ElementPositionDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<ElementPosition> _instance;
-} _ElementPosition_default_instance_;
-class GameElementDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<GameElement> _instance;
-  const ::NetBall* ball_;
-  const ::NetPaddle* paddle_;
-  const ::NetBrick* brick_;
-} _GameElement_default_instance_;
-class GameUpdateDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<GameUpdate> _instance;
-} _GameUpdate_default_instance_;
-static void InitDefaultsscc_info_ElementPosition_arkanoid_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::_ElementPosition_default_instance_;
-    new (ptr) ::ElementPosition();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::ElementPosition::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_ElementPosition_arkanoid_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_ElementPosition_arkanoid_2eproto}, {}};
-
-static void InitDefaultsscc_info_GameElement_arkanoid_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::_GameElement_default_instance_;
-    new (ptr) ::GameElement();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::GameElement::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<4> scc_info_GameElement_arkanoid_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 4, 0, InitDefaultsscc_info_GameElement_arkanoid_2eproto}, {
-      &scc_info_ElementPosition_arkanoid_2eproto.base,
-      &scc_info_NetBall_arkanoid_2eproto.base,
-      &scc_info_NetPaddle_arkanoid_2eproto.base,
-      &scc_info_NetBrick_arkanoid_2eproto.base,}};
-
-static void InitDefaultsscc_info_GameUpdate_arkanoid_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::_GameUpdate_default_instance_;
-    new (ptr) ::GameUpdate();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::GameUpdate::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_GameUpdate_arkanoid_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_GameUpdate_arkanoid_2eproto}, {
-      &scc_info_GameElement_arkanoid_2eproto.base,}};
-
-static void InitDefaultsscc_info_NetBall_arkanoid_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::_NetBall_default_instance_;
-    new (ptr) ::NetBall();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::NetBall::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_NetBall_arkanoid_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_NetBall_arkanoid_2eproto}, {}};
-
-static void InitDefaultsscc_info_NetBrick_arkanoid_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::_NetBrick_default_instance_;
-    new (ptr) ::NetBrick();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::NetBrick::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_NetBrick_arkanoid_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_NetBrick_arkanoid_2eproto}, {}};
-
-static void InitDefaultsscc_info_NetPaddle_arkanoid_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::_NetPaddle_default_instance_;
-    new (ptr) ::NetPaddle();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::NetPaddle::InitAsDefaultInstance();
-}
 
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_NetPaddle_arkanoid_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_NetPaddle_arkanoid_2eproto}, {}};
-
-static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_arkanoid_2eproto[6];
-static constexpr ::PROTOBUF_NAMESPACE_ID::EnumDescriptor const** file_level_enum_descriptors_arkanoid_2eproto = nullptr;
-static constexpr ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor const** file_level_service_descriptors_arkanoid_2eproto = nullptr;
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+PROTOBUF_CONSTEXPR NetBall::NetBall(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.velocity_x_)*/0
+  , /*decltype(_impl_.velocity_y_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct NetBallDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR NetBallDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~NetBallDefaultTypeInternal() {}
+  union {
+    NetBall _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 NetBallDefaultTypeInternal _NetBall_default_instance_;
+PROTOBUF_CONSTEXPR NetPaddle::NetPaddle(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.score_)*/0
+  , /*decltype(_impl_.controlled_by_sender_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct NetPaddleDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR NetPaddleDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~NetPaddleDefaultTypeInternal() {}
+  union {
+    NetPaddle _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 NetPaddleDefaultTypeInternal _NetPaddle_default_instance_;
+PROTOBUF_CONSTEXPR NetBrick::NetBrick(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.duration_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct NetBrickDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR NetBrickDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~NetBrickDefaultTypeInternal() {}
+  union {
+    NetBrick _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 NetBrickDefaultTypeInternal _NetBrick_default_instance_;
+PROTOBUF_CONSTEXPR ElementPosition::ElementPosition(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.x_)*/0
+  , /*decltype(_impl_.y_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ElementPositionDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ElementPositionDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ElementPositionDefaultTypeInternal() {}
+  union {
+    ElementPosition _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ElementPositionDefaultTypeInternal _ElementPosition_default_instance_;
+PROTOBUF_CONSTEXPR GameElement::GameElement(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.packed_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.element_position_)*/nullptr
+  , /*decltype(_impl_.id_)*/0
+  , /*decltype(_impl_.baseline_age_)*/0u
+  , /*decltype(_impl_.cleared_)*/0u
+  , /*decltype(_impl_.specific_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_._oneof_case_)*/{}} {}
+struct GameElementDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GameElementDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GameElementDefaultTypeInternal() {}
+  union {
+    GameElement _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GameElementDefaultTypeInternal _GameElement_default_instance_;
+PROTOBUF_CONSTEXPR Ping::Ping(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.sent_at_)*/int64_t{0}
+  , /*decltype(_impl_.tick_)*/int64_t{0}
+  , /*decltype(_impl_.tick_started_at_)*/int64_t{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PingDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PingDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PingDefaultTypeInternal() {}
+  union {
+    Ping _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PingDefaultTypeInternal _Ping_default_instance_;
+PROTOBUF_CONSTEXPR Pong::Pong(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.ping_sent_at_)*/int64_t{0}
+  , /*decltype(_impl_.ping_received_at_)*/int64_t{0}
+  , /*decltype(_impl_.sent_at_)*/int64_t{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PongDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PongDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PongDefaultTypeInternal() {}
+  union {
+    Pong _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PongDefaultTypeInternal _Pong_default_instance_;
+PROTOBUF_CONSTEXPR PlayerInput::PlayerInput(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.mouse_x_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PlayerInputDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PlayerInputDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PlayerInputDefaultTypeInternal() {}
+  union {
+    PlayerInput _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PlayerInputDefaultTypeInternal _PlayerInput_default_instance_;
+PROTOBUF_CONSTEXPR BrickHit::BrickHit(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.id_)*/0
+  , /*decltype(_impl_.paddle_id_)*/0
+  , /*decltype(_impl_.duration_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct BrickHitDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BrickHitDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BrickHitDefaultTypeInternal() {}
+  union {
+    BrickHit _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BrickHitDefaultTypeInternal _BrickHit_default_instance_;
+PROTOBUF_CONSTEXPR ScoreDelta::ScoreDelta(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.paddle_id_)*/0
+  , /*decltype(_impl_.delta_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ScoreDeltaDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ScoreDeltaDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ScoreDeltaDefaultTypeInternal() {}
+  union {
+    ScoreDelta _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ScoreDeltaDefaultTypeInternal _ScoreDelta_default_instance_;
+PROTOBUF_CONSTEXPR GameEvent::GameEvent(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.id_)*/0u
+  , /*decltype(_impl_.event_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_._oneof_case_)*/{}} {}
+struct GameEventDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GameEventDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GameEventDefaultTypeInternal() {}
+  union {
+    GameEvent _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GameEventDefaultTypeInternal _GameEvent_default_instance_;
+PROTOBUF_CONSTEXPR LockstepInput::LockstepInput(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.mouse_x_)*/{}
+  , /*decltype(_impl_._mouse_x_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.first_tick_)*/int64_t{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct LockstepInputDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR LockstepInputDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~LockstepInputDefaultTypeInternal() {}
+  union {
+    LockstepInput _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 LockstepInputDefaultTypeInternal _LockstepInput_default_instance_;
+PROTOBUF_CONSTEXPR LockstepStart::LockstepStart(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.brick_seed_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct LockstepStartDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR LockstepStartDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~LockstepStartDefaultTypeInternal() {}
+  union {
+    LockstepStart _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 LockstepStartDefaultTypeInternal _LockstepStart_default_instance_;
+PROTOBUF_CONSTEXPR StateHash::StateHash(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.tick_)*/int64_t{0}
+  , /*decltype(_impl_.value_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct StateHashDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StateHashDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StateHashDefaultTypeInternal() {}
+  union {
+    StateHash _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StateHashDefaultTypeInternal _StateHash_default_instance_;
+PROTOBUF_CONSTEXPR GameUpdate::GameUpdate(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.element_)*/{}
+  , /*decltype(_impl_.event_)*/{}
+  , /*decltype(_impl_.state_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.ping_)*/nullptr
+  , /*decltype(_impl_.pong_)*/nullptr
+  , /*decltype(_impl_.input_)*/nullptr
+  , /*decltype(_impl_.state_hash_)*/nullptr
+  , /*decltype(_impl_.lockstep_input_)*/nullptr
+  , /*decltype(_impl_.lockstep_start_)*/nullptr
+  , /*decltype(_impl_.tick_)*/int64_t{0}
+  , /*decltype(_impl_.sequence_)*/0u
+  , /*decltype(_impl_.ack_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct GameUpdateDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GameUpdateDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GameUpdateDefaultTypeInternal() {}
+  union {
+    GameUpdate _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GameUpdateDefaultTypeInternal _GameUpdate_default_instance_;
+static ::_pb::Metadata file_level_metadata_arkanoid_2eproto[15];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_arkanoid_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_arkanoid_2eproto = nullptr;
 
-const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_arkanoid_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+const uint32_t TableStruct_arkanoid_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::NetBall, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::NetBall, velocity_x_),
-  PROTOBUF_FIELD_OFFSET(::NetBall, velocity_y_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::NetBall, _impl_.velocity_x_),
+  PROTOBUF_FIELD_OFFSET(::NetBall, _impl_.velocity_y_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::NetPaddle, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::NetPaddle, score_),
-  PROTOBUF_FIELD_OFFSET(::NetPaddle, controlled_by_sender_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::NetPaddle, _impl_.score_),
+  PROTOBUF_FIELD_OFFSET(::NetPaddle, _impl_.controlled_by_sender_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::NetBrick, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::NetBrick, duration_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::NetBrick, _impl_.duration_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::ElementPosition, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::ElementPosition, x_),
-  PROTOBUF_FIELD_OFFSET(::ElementPosition, y_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ElementPosition, _impl_.x_),
+  PROTOBUF_FIELD_OFFSET(::ElementPosition, _impl_.y_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::GameElement, _internal_metadata_),
   ~0u,  // no _extensions_
-  PROTOBUF_FIELD_OFFSET(::GameElement, _oneof_case_[0]),
+  PROTOBUF_FIELD_OFFSET(::GameElement, _impl_._oneof_case_[0]),
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::GameElement, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::GameElement, _impl_.element_position_),
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  PROTOBUF_FIELD_OFFSET(::GameElement, _impl_.baseline_age_),
+  PROTOBUF_FIELD_OFFSET(::GameElement, _impl_.cleared_),
+  PROTOBUF_FIELD_OFFSET(::GameElement, _impl_.packed_),
+  PROTOBUF_FIELD_OFFSET(::GameElement, _impl_.specific_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::Ping, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Ping, _impl_.sent_at_),
+  PROTOBUF_FIELD_OFFSET(::Ping, _impl_.tick_),
+  PROTOBUF_FIELD_OFFSET(::Ping, _impl_.tick_started_at_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::Pong, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Pong, _impl_.ping_sent_at_),
+  PROTOBUF_FIELD_OFFSET(::Pong, _impl_.ping_received_at_),
+  PROTOBUF_FIELD_OFFSET(::Pong, _impl_.sent_at_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::PlayerInput, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::PlayerInput, _impl_.mouse_x_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::BrickHit, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::BrickHit, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::BrickHit, _impl_.paddle_id_),
+  PROTOBUF_FIELD_OFFSET(::BrickHit, _impl_.duration_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ScoreDelta, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ScoreDelta, _impl_.paddle_id_),
+  PROTOBUF_FIELD_OFFSET(::ScoreDelta, _impl_.delta_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::GameEvent, _internal_metadata_),
+  ~0u,  // no _extensions_
+  PROTOBUF_FIELD_OFFSET(::GameEvent, _impl_._oneof_case_[0]),
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::GameEvent, _impl_.id_),
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  PROTOBUF_FIELD_OFFSET(::GameEvent, _impl_.event_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::LockstepInput, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::LockstepInput, _impl_.first_tick_),
+  PROTOBUF_FIELD_OFFSET(::LockstepInput, _impl_.mouse_x_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::LockstepStart, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::LockstepStart, _impl_.brick_seed_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::StateHash, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::GameElement, id_),
-  PROTOBUF_FIELD_OFFSET(::GameElement, element_position_),
-  offsetof(::GameElementDefaultTypeInternal, ball_),
-  offsetof(::GameElementDefaultTypeInternal, paddle_),
-  offsetof(::GameElementDefaultTypeInternal, brick_),
-  PROTOBUF_FIELD_OFFSET(::GameElement, specific_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::StateHash, _impl_.tick_),
+  PROTOBUF_FIELD_OFFSET(::StateHash, _impl_.value_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::GameUpdate, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::GameUpdate, element_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::GameUpdate, _impl_.element_),
+  PROTOBUF_FIELD_OFFSET(::GameUpdate, _impl_.ping_),
+  PROTOBUF_FIELD_OFFSET(::GameUpdate, _impl_.pong_),
+  PROTOBUF_FIELD_OFFSET(::GameUpdate, _impl_.tick_),
+  PROTOBUF_FIELD_OFFSET(::GameUpdate, _impl_.sequence_),
+  PROTOBUF_FIELD_OFFSET(::GameUpdate, _impl_.ack_),
+  PROTOBUF_FIELD_OFFSET(::GameUpdate, _impl_.input_),
+  PROTOBUF_FIELD_OFFSET(::GameUpdate, _impl_.event_),
+  PROTOBUF_FIELD_OFFSET(::GameUpdate, _impl_.state_hash_),
+  PROTOBUF_FIELD_OFFSET(::GameUpdate, _impl_.lockstep_input_),
+  PROTOBUF_FIELD_OFFSET(::GameUpdate, _impl_.lockstep_start_),
+  PROTOBUF_FIELD_OFFSET(::GameUpdate, _impl_.state_),
 };
-static const ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
-  { 0, -1, sizeof(::NetBall)},
-  { 7, -1, sizeof(::NetPaddle)},
-  { 14, -1, sizeof(::NetBrick)},
-  { 20, -1, sizeof(::ElementPosition)},
-  { 27, -1, sizeof(::GameElement)},
-  { 38, -1, sizeof(::GameUpdate)},
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::NetBall)},
+  { 8, -1, -1, sizeof(::NetPaddle)},
+  { 16, -1, -1, sizeof(::NetBrick)},
+  { 23, -1, -1, sizeof(::ElementPosition)},
+  { 31, -1, -1, sizeof(::GameElement)},
+  { 46, -1, -1, sizeof(::Ping)},
+  { 55, -1, -1, sizeof(::Pong)},
+  { 64, -1, -1, sizeof(::PlayerInput)},
+  { 71, -1, -1, sizeof(::BrickHit)},
+  { 80, -1, -1, sizeof(::ScoreDelta)},
+  { 88, -1, -1, sizeof(::GameEvent)},
+  { 98, -1, -1, sizeof(::LockstepInput)},
+  { 106, -1, -1, sizeof(::LockstepStart)},
+  { 113, -1, -1, sizeof(::StateHash)},
+  { 121, -1, -1, sizeof(::GameUpdate)},
 };
 
-static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] = {
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::_NetBall_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::_NetPaddle_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::_NetBrick_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::_ElementPosition_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::_GameElement_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::_GameUpdate_default_instance_),
+static const ::_pb::Message* const file_default_instances[] = {
+  &::_NetBall_default_instance_._instance,
+  &::_NetPaddle_default_instance_._instance,
+  &::_NetBrick_default_instance_._instance,
+  &::_ElementPosition_default_instance_._instance,
+  &::_GameElement_default_instance_._instance,
+  &::_Ping_default_instance_._instance,
+  &::_Pong_default_instance_._instance,
+  &::_PlayerInput_default_instance_._instance,
+  &::_BrickHit_default_instance_._instance,
+  &::_ScoreDelta_default_instance_._instance,
+  &::_GameEvent_default_instance_._instance,
+  &::_LockstepInput_default_instance_._instance,
+  &::_LockstepStart_default_instance_._instance,
+  &::_StateHash_default_instance_._instance,
+  &::_GameUpdate_default_instance_._instance,
 };
 
 const char descriptor_table_protodef_arkanoid_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
@@ -208,165 +433,191 @@ const char descriptor_table_protodef_arkanoid_2eproto[] PROTOBUF_SECTION_VARIABL
   "x\030\001 \001(\002\022\022\n\nvelocity_y\030\002 \001(\002\"8\n\tNetPaddle"
   "\022\r\n\005score\030\001 \001(\005\022\034\n\024controlled_by_sender\030"
   "\002 \001(\010\"\034\n\010NetBrick\022\020\n\010duration\030\001 \001(\005\"\'\n\017E"
-  "lementPosition\022\t\n\001x\030\001 \001(\002\022\t\n\001y\030\002 \001(\002\"\245\001\n"
+  "lementPosition\022\t\n\001x\030\001 \001(\002\022\t\n\001y\030\002 \001(\002\"\334\001\n"
   "\013GameElement\022\n\n\002id\030\001 \001(\005\022*\n\020element_posi"
   "tion\030\002 \001(\0132\020.ElementPosition\022\030\n\004ball\030\003 \001"
   "(\0132\010.NetBallH\000\022\034\n\006paddle\030\004 \001(\0132\n.NetPadd"
-  "leH\000\022\032\n\005brick\030\005 \001(\0132\t.NetBrickH\000B\n\n\010spec"
-  "ific\"+\n\nGameUpdate\022\035\n\007element\030\001 \003(\0132\014.Ga"
-  "meElementb\006proto3"
+  "leH\000\022\032\n\005brick\030\005 \001(\0132\t.NetBrickH\000\022\024\n\014base"
+  "line_age\030\006 \001(\r\022\017\n\007cleared\030\007 \001(\r\022\016\n\006packe"
+  "d\030\010 \001(\014B\n\n\010specific\">\n\004Ping\022\017\n\007sent_at\030\001"
+  " \001(\003\022\014\n\004tick\030\002 \001(\003\022\027\n\017tick_started_at\030\003 "
+  "\001(\003\"G\n\004Pong\022\024\n\014ping_sent_at\030\001 \001(\003\022\030\n\020pin"
+  "g_received_at\030\002 \001(\003\022\017\n\007sent_at\030\003 \001(\003\"\036\n\013"
+  "PlayerInput\022\017\n\007mouse_x\030\001 \001(\005\";\n\010BrickHit"
+  "\022\n\n\002id\030\001 \001(\005\022\021\n\tpaddle_id\030\002 \001(\005\022\020\n\010durat"
+  "ion\030\003 \001(\005\".\n\nScoreDelta\022\021\n\tpaddle_id\030\001 \001"
+  "(\005\022\r\n\005delta\030\002 \001(\005\"d\n\tGameEvent\022\n\n\002id\030\001 \001"
+  "(\r\022\036\n\tbrick_hit\030\002 \001(\0132\t.BrickHitH\000\022\"\n\013sc"
+  "ore_delta\030\003 \001(\0132\013.ScoreDeltaH\000B\007\n\005event\""
+  "4\n\rLockstepInput\022\022\n\nfirst_tick\030\001 \001(\003\022\017\n\007"
+  "mouse_x\030\002 \003(\021\"#\n\rLockstepStart\022\022\n\nbrick_"
+  "seed\030\001 \001(\r\"(\n\tStateHash\022\014\n\004tick\030\001 \001(\003\022\r\n"
+  "\005value\030\002 \001(\006\"\271\002\n\nGameUpdate\022\035\n\007element\030\001"
+  " \003(\0132\014.GameElement\022\023\n\004ping\030\002 \001(\0132\005.Ping\022"
+  "\023\n\004pong\030\003 \001(\0132\005.Pong\022\014\n\004tick\030\004 \001(\003\022\020\n\010se"
+  "quence\030\005 \001(\r\022\013\n\003ack\030\006 \001(\r\022\033\n\005input\030\007 \001(\013"
+  "2\014.PlayerInput\022\031\n\005event\030\010 \003(\0132\n.GameEven"
+  "t\022\036\n\nstate_hash\030\t \001(\0132\n.StateHash\022&\n\016loc"
+  "kstep_input\030\n \001(\0132\016.LockstepInput\022&\n\016loc"
+  "kstep_start\030\013 \001(\0132\016.LockstepStart\022\r\n\005sta"
+  "te\030\014 \001(\014b\006proto3"
   ;
-static const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable*const descriptor_table_arkanoid_2eproto_deps[1] = {
-};
-static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_arkanoid_2eproto_sccs[6] = {
-  &scc_info_ElementPosition_arkanoid_2eproto.base,
-  &scc_info_GameElement_arkanoid_2eproto.base,
-  &scc_info_GameUpdate_arkanoid_2eproto.base,
-  &scc_info_NetBall_arkanoid_2eproto.base,
-  &scc_info_NetBrick_arkanoid_2eproto.base,
-  &scc_info_NetPaddle_arkanoid_2eproto.base,
-};
-static ::PROTOBUF_NAMESPACE_ID::internal::once_flag descriptor_table_arkanoid_2eproto_once;
-const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_arkanoid_2eproto = {
-  false, false, descriptor_table_protodef_arkanoid_2eproto, "arkanoid.proto", 417,
-  &descriptor_table_arkanoid_2eproto_once, descriptor_table_arkanoid_2eproto_sccs, descriptor_table_arkanoid_2eproto_deps, 6, 0,
-  schemas, file_default_instances, TableStruct_arkanoid_2eproto::offsets,
-  file_level_metadata_arkanoid_2eproto, 6, file_level_enum_descriptors_arkanoid_2eproto, file_level_service_descriptors_arkanoid_2eproto,
+static ::_pbi::once_flag descriptor_table_arkanoid_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_arkanoid_2eproto = {
+    false, false, 1256, descriptor_table_protodef_arkanoid_2eproto,
+    "arkanoid.proto",
+    &descriptor_table_arkanoid_2eproto_once, nullptr, 0, 15,
+    schemas, file_default_instances, TableStruct_arkanoid_2eproto::offsets,
+    file_level_metadata_arkanoid_2eproto, file_level_enum_descriptors_arkanoid_2eproto,
+    file_level_service_descriptors_arkanoid_2eproto,
 };
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_arkanoid_2eproto_getter() {
+  return &descriptor_table_arkanoid_2eproto;
+}
 
 // Force running AddDescriptors() at dynamic initialization time.
-static bool dynamic_init_dummy_arkanoid_2eproto = (static_cast<void>(::PROTOBUF_NAMESPACE_ID::internal::AddDescriptors(&descriptor_table_arkanoid_2eproto)), true);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_arkanoid_2eproto(&descriptor_table_arkanoid_2eproto);
 
 // ===================================================================
 
-void NetBall::InitAsDefaultInstance() {
-}
 class NetBall::_Internal {
  public:
 };
 
-NetBall::NetBall(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+NetBall::NetBall(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:NetBall)
 }
 NetBall::NetBall(const NetBall& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  NetBall* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.velocity_x_){}
+    , decltype(_impl_.velocity_y_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::memcpy(&velocity_x_, &from.velocity_x_,
-    static_cast<size_t>(reinterpret_cast<char*>(&velocity_y_) -
-    reinterpret_cast<char*>(&velocity_x_)) + sizeof(velocity_y_));
+  ::memcpy(&_impl_.velocity_x_, &from._impl_.velocity_x_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.velocity_y_) -
+    reinterpret_cast<char*>(&_impl_.velocity_x_)) + sizeof(_impl_.velocity_y_));
   // @@protoc_insertion_point(copy_constructor:NetBall)
 }
 
-void NetBall::SharedCtor() {
-  ::memset(&velocity_x_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&velocity_y_) -
-      reinterpret_cast<char*>(&velocity_x_)) + sizeof(velocity_y_));
+inline void NetBall::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.velocity_x_){0}
+    , decltype(_impl_.velocity_y_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 NetBall::~NetBall() {
   // @@protoc_insertion_point(destructor:NetBall)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void NetBall::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
+inline void NetBall::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
-void NetBall::ArenaDtor(void* object) {
-  NetBall* _this = reinterpret_cast< NetBall* >(object);
-  (void)_this;
-}
-void NetBall::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void NetBall::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const NetBall& NetBall::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_NetBall_arkanoid_2eproto.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void NetBall::Clear() {
 // @@protoc_insertion_point(message_clear_start:NetBall)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ::memset(&velocity_x_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&velocity_y_) -
-      reinterpret_cast<char*>(&velocity_x_)) + sizeof(velocity_y_));
+  ::memset(&_impl_.velocity_x_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.velocity_y_) -
+      reinterpret_cast<char*>(&_impl_.velocity_x_)) + sizeof(_impl_.velocity_y_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* NetBall::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* NetBall::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // float velocity_x = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 13)) {
-          velocity_x_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 13)) {
+          _impl_.velocity_x_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
           ptr += sizeof(float);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // float velocity_y = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 21)) {
-          velocity_y_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 21)) {
+          _impl_.velocity_y_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
           ptr += sizeof(float);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* NetBall::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* NetBall::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:NetBall)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // float velocity_x = 1;
-  if (!(this->velocity_x() <= 0 && this->velocity_x() >= 0)) {
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_velocity_x = this->_internal_velocity_x();
+  uint32_t raw_velocity_x;
+  memcpy(&raw_velocity_x, &tmp_velocity_x, sizeof(tmp_velocity_x));
+  if (raw_velocity_x != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFloatToArray(1, this->_internal_velocity_x(), target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(1, this->_internal_velocity_x(), target);
   }
 
   // float velocity_y = 2;
-  if (!(this->velocity_y() <= 0 && this->velocity_y() >= 0)) {
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_velocity_y = this->_internal_velocity_y();
+  uint32_t raw_velocity_y;
+  memcpy(&raw_velocity_y, &tmp_velocity_y, sizeof(tmp_velocity_y));
+  if (raw_velocity_y != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFloatToArray(2, this->_internal_velocity_y(), target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(2, this->_internal_velocity_y(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:NetBall)
@@ -377,64 +628,61 @@ size_t NetBall::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:NetBall)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // float velocity_x = 1;
-  if (!(this->velocity_x() <= 0 && this->velocity_x() >= 0)) {
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_velocity_x = this->_internal_velocity_x();
+  uint32_t raw_velocity_x;
+  memcpy(&raw_velocity_x, &tmp_velocity_x, sizeof(tmp_velocity_x));
+  if (raw_velocity_x != 0) {
     total_size += 1 + 4;
   }
 
   // float velocity_y = 2;
-  if (!(this->velocity_y() <= 0 && this->velocity_y() >= 0)) {
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_velocity_y = this->_internal_velocity_y();
+  uint32_t raw_velocity_y;
+  memcpy(&raw_velocity_y, &tmp_velocity_y, sizeof(tmp_velocity_y));
+  if (raw_velocity_y != 0) {
     total_size += 1 + 4;
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void NetBall::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:NetBall)
-  GOOGLE_DCHECK_NE(&from, this);
-  const NetBall* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<NetBall>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:NetBall)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:NetBall)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData NetBall::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    NetBall::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*NetBall::GetClassData() const { return &_class_data_; }
 
-void NetBall::MergeFrom(const NetBall& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:NetBall)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+
+void NetBall::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<NetBall*>(&to_msg);
+  auto& from = static_cast<const NetBall&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:NetBall)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (!(from.velocity_x() <= 0 && from.velocity_x() >= 0)) {
-    _internal_set_velocity_x(from._internal_velocity_x());
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_velocity_x = from._internal_velocity_x();
+  uint32_t raw_velocity_x;
+  memcpy(&raw_velocity_x, &tmp_velocity_x, sizeof(tmp_velocity_x));
+  if (raw_velocity_x != 0) {
+    _this->_internal_set_velocity_x(from._internal_velocity_x());
   }
-  if (!(from.velocity_y() <= 0 && from.velocity_y() >= 0)) {
-    _internal_set_velocity_y(from._internal_velocity_y());
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_velocity_y = from._internal_velocity_y();
+  uint32_t raw_velocity_y;
+  memcpy(&raw_velocity_y, &tmp_velocity_y, sizeof(tmp_velocity_y));
+  if (raw_velocity_y != 0) {
+    _this->_internal_set_velocity_y(from._internal_velocity_y());
   }
-}
-
-void NetBall::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:NetBall)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void NetBall::CopyFrom(const NetBall& from) {
@@ -450,150 +698,153 @@ bool NetBall::IsInitialized() const {
 
 void NetBall::InternalSwap(NetBall* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(NetBall, velocity_y_)
-      + sizeof(NetBall::velocity_y_)
-      - PROTOBUF_FIELD_OFFSET(NetBall, velocity_x_)>(
-          reinterpret_cast<char*>(&velocity_x_),
-          reinterpret_cast<char*>(&other->velocity_x_));
+      PROTOBUF_FIELD_OFFSET(NetBall, _impl_.velocity_y_)
+      + sizeof(NetBall::_impl_.velocity_y_)
+      - PROTOBUF_FIELD_OFFSET(NetBall, _impl_.velocity_x_)>(
+          reinterpret_cast<char*>(&_impl_.velocity_x_),
+          reinterpret_cast<char*>(&other->_impl_.velocity_x_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata NetBall::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_arkanoid_2eproto_getter, &descriptor_table_arkanoid_2eproto_once,
+      file_level_metadata_arkanoid_2eproto[0]);
 }
 
-
 // ===================================================================
 
-void NetPaddle::InitAsDefaultInstance() {
-}
 class NetPaddle::_Internal {
  public:
 };
 
-NetPaddle::NetPaddle(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+NetPaddle::NetPaddle(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:NetPaddle)
 }
 NetPaddle::NetPaddle(const NetPaddle& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  NetPaddle* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.score_){}
+    , decltype(_impl_.controlled_by_sender_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::memcpy(&score_, &from.score_,
-    static_cast<size_t>(reinterpret_cast<char*>(&controlled_by_sender_) -
-    reinterpret_cast<char*>(&score_)) + sizeof(controlled_by_sender_));
+  ::memcpy(&_impl_.score_, &from._impl_.score_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.controlled_by_sender_) -
+    reinterpret_cast<char*>(&_impl_.score_)) + sizeof(_impl_.controlled_by_sender_));
   // @@protoc_insertion_point(copy_constructor:NetPaddle)
 }
 
-void NetPaddle::SharedCtor() {
-  ::memset(&score_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&controlled_by_sender_) -
-      reinterpret_cast<char*>(&score_)) + sizeof(controlled_by_sender_));
+inline void NetPaddle::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.score_){0}
+    , decltype(_impl_.controlled_by_sender_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 NetPaddle::~NetPaddle() {
   // @@protoc_insertion_point(destructor:NetPaddle)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void NetPaddle::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
+inline void NetPaddle::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
-void NetPaddle::ArenaDtor(void* object) {
-  NetPaddle* _this = reinterpret_cast< NetPaddle* >(object);
-  (void)_this;
-}
-void NetPaddle::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void NetPaddle::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const NetPaddle& NetPaddle::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_NetPaddle_arkanoid_2eproto.base);
-  return *internal_default_instance();
-}
-
 
 void NetPaddle::Clear() {
 // @@protoc_insertion_point(message_clear_start:NetPaddle)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ::memset(&score_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&controlled_by_sender_) -
-      reinterpret_cast<char*>(&score_)) + sizeof(controlled_by_sender_));
+  ::memset(&_impl_.score_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.controlled_by_sender_) -
+      reinterpret_cast<char*>(&_impl_.score_)) + sizeof(_impl_.controlled_by_sender_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* NetPaddle::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* NetPaddle::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // int32 score = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
-          score_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.score_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // bool controlled_by_sender = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
-          controlled_by_sender_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.controlled_by_sender_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* NetPaddle::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* NetPaddle::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:NetPaddle)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // int32 score = 1;
-  if (this->score() != 0) {
+  if (this->_internal_score() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(1, this->_internal_score(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_score(), target);
   }
 
   // bool controlled_by_sender = 2;
-  if (this->controlled_by_sender() != 0) {
+  if (this->_internal_controlled_by_sender() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(2, this->_internal_controlled_by_sender(), target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_controlled_by_sender(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:NetPaddle)
@@ -604,66 +855,45 @@ size_t NetPaddle::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:NetPaddle)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // int32 score = 1;
-  if (this->score() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_score());
+  if (this->_internal_score() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_score());
   }
 
   // bool controlled_by_sender = 2;
-  if (this->controlled_by_sender() != 0) {
+  if (this->_internal_controlled_by_sender() != 0) {
     total_size += 1 + 1;
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void NetPaddle::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:NetPaddle)
-  GOOGLE_DCHECK_NE(&from, this);
-  const NetPaddle* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<NetPaddle>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:NetPaddle)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:NetPaddle)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData NetPaddle::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    NetPaddle::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*NetPaddle::GetClassData() const { return &_class_data_; }
 
-void NetPaddle::MergeFrom(const NetPaddle& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:NetPaddle)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+
+void NetPaddle::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<NetPaddle*>(&to_msg);
+  auto& from = static_cast<const NetPaddle&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:NetPaddle)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.score() != 0) {
-    _internal_set_score(from._internal_score());
+  if (from._internal_score() != 0) {
+    _this->_internal_set_score(from._internal_score());
   }
-  if (from.controlled_by_sender() != 0) {
-    _internal_set_controlled_by_sender(from._internal_controlled_by_sender());
+  if (from._internal_controlled_by_sender() != 0) {
+    _this->_internal_set_controlled_by_sender(from._internal_controlled_by_sender());
   }
-}
-
-void NetPaddle::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:NetPaddle)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void NetPaddle::CopyFrom(const NetPaddle& from) {
@@ -679,131 +909,133 @@ bool NetPaddle::IsInitialized() const {
 
 void NetPaddle::InternalSwap(NetPaddle* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(NetPaddle, controlled_by_sender_)
-      + sizeof(NetPaddle::controlled_by_sender_)
-      - PROTOBUF_FIELD_OFFSET(NetPaddle, score_)>(
-          reinterpret_cast<char*>(&score_),
-          reinterpret_cast<char*>(&other->score_));
+      PROTOBUF_FIELD_OFFSET(NetPaddle, _impl_.controlled_by_sender_)
+      + sizeof(NetPaddle::_impl_.controlled_by_sender_)
+      - PROTOBUF_FIELD_OFFSET(NetPaddle, _impl_.score_)>(
+          reinterpret_cast<char*>(&_impl_.score_),
+          reinterpret_cast<char*>(&other->_impl_.score_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata NetPaddle::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_arkanoid_2eproto_getter, &descriptor_table_arkanoid_2eproto_once,
+      file_level_metadata_arkanoid_2eproto[1]);
 }
 
-
 // ===================================================================
 
-void NetBrick::InitAsDefaultInstance() {
-}
 class NetBrick::_Internal {
  public:
 };
 
-NetBrick::NetBrick(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+NetBrick::NetBrick(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:NetBrick)
 }
 NetBrick::NetBrick(const NetBrick& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  NetBrick* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.duration_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  duration_ = from.duration_;
+  _this->_impl_.duration_ = from._impl_.duration_;
   // @@protoc_insertion_point(copy_constructor:NetBrick)
 }
 
-void NetBrick::SharedCtor() {
-  duration_ = 0;
+inline void NetBrick::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.duration_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 NetBrick::~NetBrick() {
   // @@protoc_insertion_point(destructor:NetBrick)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void NetBrick::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
+inline void NetBrick::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
-void NetBrick::ArenaDtor(void* object) {
-  NetBrick* _this = reinterpret_cast< NetBrick* >(object);
-  (void)_this;
-}
-void NetBrick::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void NetBrick::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const NetBrick& NetBrick::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_NetBrick_arkanoid_2eproto.base);
-  return *internal_default_instance();
-}
-
 
 void NetBrick::Clear() {
 // @@protoc_insertion_point(message_clear_start:NetBrick)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  duration_ = 0;
+  _impl_.duration_ = 0;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* NetBrick::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* NetBrick::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // int32 duration = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
-          duration_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.duration_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* NetBrick::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* NetBrick::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:NetBrick)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // int32 duration = 1;
-  if (this->duration() != 0) {
+  if (this->_internal_duration() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(1, this->_internal_duration(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_duration(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:NetBrick)
@@ -814,58 +1046,37 @@ size_t NetBrick::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:NetBrick)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // int32 duration = 1;
-  if (this->duration() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_duration());
+  if (this->_internal_duration() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_duration());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void NetBrick::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:NetBrick)
-  GOOGLE_DCHECK_NE(&from, this);
-  const NetBrick* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<NetBrick>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:NetBrick)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:NetBrick)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData NetBrick::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    NetBrick::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*NetBrick::GetClassData() const { return &_class_data_; }
 
-void NetBrick::MergeFrom(const NetBrick& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:NetBrick)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+
+void NetBrick::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<NetBrick*>(&to_msg);
+  auto& from = static_cast<const NetBrick&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:NetBrick)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.duration() != 0) {
-    _internal_set_duration(from._internal_duration());
+  if (from._internal_duration() != 0) {
+    _this->_internal_set_duration(from._internal_duration());
   }
-}
-
-void NetBrick::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:NetBrick)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void NetBrick::CopyFrom(const NetBrick& from) {
@@ -881,145 +1092,156 @@ bool NetBrick::IsInitialized() const {
 
 void NetBrick::InternalSwap(NetBrick* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  swap(duration_, other->duration_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.duration_, other->_impl_.duration_);
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata NetBrick::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_arkanoid_2eproto_getter, &descriptor_table_arkanoid_2eproto_once,
+      file_level_metadata_arkanoid_2eproto[2]);
 }
 
-
 // ===================================================================
 
-void ElementPosition::InitAsDefaultInstance() {
-}
 class ElementPosition::_Internal {
  public:
 };
 
-ElementPosition::ElementPosition(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+ElementPosition::ElementPosition(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:ElementPosition)
 }
 ElementPosition::ElementPosition(const ElementPosition& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ElementPosition* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.x_){}
+    , decltype(_impl_.y_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::memcpy(&x_, &from.x_,
-    static_cast<size_t>(reinterpret_cast<char*>(&y_) -
-    reinterpret_cast<char*>(&x_)) + sizeof(y_));
+  ::memcpy(&_impl_.x_, &from._impl_.x_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.y_) -
+    reinterpret_cast<char*>(&_impl_.x_)) + sizeof(_impl_.y_));
   // @@protoc_insertion_point(copy_constructor:ElementPosition)
 }
 
-void ElementPosition::SharedCtor() {
-  ::memset(&x_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&y_) -
-      reinterpret_cast<char*>(&x_)) + sizeof(y_));
+inline void ElementPosition::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.x_){0}
+    , decltype(_impl_.y_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 ElementPosition::~ElementPosition() {
   // @@protoc_insertion_point(destructor:ElementPosition)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void ElementPosition::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
+inline void ElementPosition::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
-void ElementPosition::ArenaDtor(void* object) {
-  ElementPosition* _this = reinterpret_cast< ElementPosition* >(object);
-  (void)_this;
-}
-void ElementPosition::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void ElementPosition::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const ElementPosition& ElementPosition::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_ElementPosition_arkanoid_2eproto.base);
-  return *internal_default_instance();
-}
-
 
 void ElementPosition::Clear() {
 // @@protoc_insertion_point(message_clear_start:ElementPosition)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ::memset(&x_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&y_) -
-      reinterpret_cast<char*>(&x_)) + sizeof(y_));
+  ::memset(&_impl_.x_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.y_) -
+      reinterpret_cast<char*>(&_impl_.x_)) + sizeof(_impl_.y_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* ElementPosition::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* ElementPosition::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // float x = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 13)) {
-          x_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 13)) {
+          _impl_.x_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
           ptr += sizeof(float);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // float y = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 21)) {
-          y_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 21)) {
+          _impl_.y_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
           ptr += sizeof(float);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* ElementPosition::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* ElementPosition::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:ElementPosition)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // float x = 1;
-  if (!(this->x() <= 0 && this->x() >= 0)) {
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_x = this->_internal_x();
+  uint32_t raw_x;
+  memcpy(&raw_x, &tmp_x, sizeof(tmp_x));
+  if (raw_x != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFloatToArray(1, this->_internal_x(), target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(1, this->_internal_x(), target);
   }
 
   // float y = 2;
-  if (!(this->y() <= 0 && this->y() >= 0)) {
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_y = this->_internal_y();
+  uint32_t raw_y;
+  memcpy(&raw_y, &tmp_y, sizeof(tmp_y));
+  if (raw_y != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFloatToArray(2, this->_internal_y(), target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(2, this->_internal_y(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:ElementPosition)
@@ -1030,64 +1252,61 @@ size_t ElementPosition::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:ElementPosition)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // float x = 1;
-  if (!(this->x() <= 0 && this->x() >= 0)) {
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_x = this->_internal_x();
+  uint32_t raw_x;
+  memcpy(&raw_x, &tmp_x, sizeof(tmp_x));
+  if (raw_x != 0) {
     total_size += 1 + 4;
   }
 
   // float y = 2;
-  if (!(this->y() <= 0 && this->y() >= 0)) {
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_y = this->_internal_y();
+  uint32_t raw_y;
+  memcpy(&raw_y, &tmp_y, sizeof(tmp_y));
+  if (raw_y != 0) {
     total_size += 1 + 4;
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void ElementPosition::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:ElementPosition)
-  GOOGLE_DCHECK_NE(&from, this);
-  const ElementPosition* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<ElementPosition>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:ElementPosition)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:ElementPosition)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ElementPosition::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ElementPosition::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ElementPosition::GetClassData() const { return &_class_data_; }
 
-void ElementPosition::MergeFrom(const ElementPosition& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:ElementPosition)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+
+void ElementPosition::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ElementPosition*>(&to_msg);
+  auto& from = static_cast<const ElementPosition&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ElementPosition)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (!(from.x() <= 0 && from.x() >= 0)) {
-    _internal_set_x(from._internal_x());
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_x = from._internal_x();
+  uint32_t raw_x;
+  memcpy(&raw_x, &tmp_x, sizeof(tmp_x));
+  if (raw_x != 0) {
+    _this->_internal_set_x(from._internal_x());
   }
-  if (!(from.y() <= 0 && from.y() >= 0)) {
-    _internal_set_y(from._internal_y());
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_y = from._internal_y();
+  uint32_t raw_y;
+  memcpy(&raw_y, &tmp_y, sizeof(tmp_y));
+  if (raw_y != 0) {
+    _this->_internal_set_y(from._internal_y());
   }
-}
-
-void ElementPosition::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:ElementPosition)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void ElementPosition::CopyFrom(const ElementPosition& from) {
@@ -1103,32 +1322,23 @@ bool ElementPosition::IsInitialized() const {
 
 void ElementPosition::InternalSwap(ElementPosition* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(ElementPosition, y_)
-      + sizeof(ElementPosition::y_)
-      - PROTOBUF_FIELD_OFFSET(ElementPosition, x_)>(
-          reinterpret_cast<char*>(&x_),
-          reinterpret_cast<char*>(&other->x_));
+      PROTOBUF_FIELD_OFFSET(ElementPosition, _impl_.y_)
+      + sizeof(ElementPosition::_impl_.y_)
+      - PROTOBUF_FIELD_OFFSET(ElementPosition, _impl_.x_)>(
+          reinterpret_cast<char*>(&_impl_.x_),
+          reinterpret_cast<char*>(&other->_impl_.x_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata ElementPosition::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_arkanoid_2eproto_getter, &descriptor_table_arkanoid_2eproto_once,
+      file_level_metadata_arkanoid_2eproto[3]);
 }
 
-
 // ===================================================================
 
-void GameElement::InitAsDefaultInstance() {
-  ::_GameElement_default_instance_._instance.get_mutable()->element_position_ = const_cast< ::ElementPosition*>(
-      ::ElementPosition::internal_default_instance());
-  ::_GameElement_default_instance_.ball_ = const_cast< ::NetBall*>(
-      ::NetBall::internal_default_instance());
-  ::_GameElement_default_instance_.paddle_ = const_cast< ::NetPaddle*>(
-      ::NetPaddle::internal_default_instance());
-  ::_GameElement_default_instance_.brick_ = const_cast< ::NetBrick*>(
-      ::NetBrick::internal_default_instance());
-}
 class GameElement::_Internal {
  public:
   static const ::ElementPosition& element_position(const GameElement* msg);
@@ -1139,92 +1349,114 @@ class GameElement::_Internal {
 
 const ::ElementPosition&
 GameElement::_Internal::element_position(const GameElement* msg) {
-  return *msg->element_position_;
+  return *msg->_impl_.element_position_;
 }
 const ::NetBall&
 GameElement::_Internal::ball(const GameElement* msg) {
-  return *msg->specific_.ball_;
+  return *msg->_impl_.specific_.ball_;
 }
 const ::NetPaddle&
 GameElement::_Internal::paddle(const GameElement* msg) {
-  return *msg->specific_.paddle_;
+  return *msg->_impl_.specific_.paddle_;
 }
 const ::NetBrick&
 GameElement::_Internal::brick(const GameElement* msg) {
-  return *msg->specific_.brick_;
+  return *msg->_impl_.specific_.brick_;
 }
 void GameElement::set_allocated_ball(::NetBall* ball) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   clear_specific();
   if (ball) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(ball);
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(ball);
     if (message_arena != submessage_arena) {
       ball = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, ball, submessage_arena);
     }
     set_has_ball();
-    specific_.ball_ = ball;
+    _impl_.specific_.ball_ = ball;
   }
   // @@protoc_insertion_point(field_set_allocated:GameElement.ball)
 }
 void GameElement::set_allocated_paddle(::NetPaddle* paddle) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   clear_specific();
   if (paddle) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(paddle);
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(paddle);
     if (message_arena != submessage_arena) {
       paddle = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, paddle, submessage_arena);
     }
     set_has_paddle();
-    specific_.paddle_ = paddle;
+    _impl_.specific_.paddle_ = paddle;
   }
   // @@protoc_insertion_point(field_set_allocated:GameElement.paddle)
 }
 void GameElement::set_allocated_brick(::NetBrick* brick) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   clear_specific();
   if (brick) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(brick);
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(brick);
     if (message_arena != submessage_arena) {
       brick = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, brick, submessage_arena);
     }
     set_has_brick();
-    specific_.brick_ = brick;
+    _impl_.specific_.brick_ = brick;
   }
   // @@protoc_insertion_point(field_set_allocated:GameElement.brick)
 }
-GameElement::GameElement(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+GameElement::GameElement(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:GameElement)
 }
 GameElement::GameElement(const GameElement& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GameElement* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.packed_){}
+    , decltype(_impl_.element_position_){nullptr}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.baseline_age_){}
+    , decltype(_impl_.cleared_){}
+    , decltype(_impl_.specific_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.packed_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.packed_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_packed().empty()) {
+    _this->_impl_.packed_.Set(from._internal_packed(), 
+      _this->GetArenaForAllocation());
+  }
   if (from._internal_has_element_position()) {
-    element_position_ = new ::ElementPosition(*from.element_position_);
-  } else {
-    element_position_ = nullptr;
+    _this->_impl_.element_position_ = new ::ElementPosition(*from._impl_.element_position_);
   }
-  id_ = from.id_;
+  ::memcpy(&_impl_.id_, &from._impl_.id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.cleared_) -
+    reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.cleared_));
   clear_has_specific();
   switch (from.specific_case()) {
     case kBall: {
-      _internal_mutable_ball()->::NetBall::MergeFrom(from._internal_ball());
+      _this->_internal_mutable_ball()->::NetBall::MergeFrom(
+          from._internal_ball());
       break;
     }
     case kPaddle: {
-      _internal_mutable_paddle()->::NetPaddle::MergeFrom(from._internal_paddle());
+      _this->_internal_mutable_paddle()->::NetPaddle::MergeFrom(
+          from._internal_paddle());
       break;
     }
     case kBrick: {
-      _internal_mutable_brick()->::NetBrick::MergeFrom(from._internal_brick());
+      _this->_internal_mutable_brick()->::NetBrick::MergeFrom(
+          from._internal_brick());
       break;
     }
     case SPECIFIC_NOT_SET: {
@@ -1234,61 +1466,67 @@ GameElement::GameElement(const GameElement& from)
   // @@protoc_insertion_point(copy_constructor:GameElement)
 }
 
-void GameElement::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_GameElement_arkanoid_2eproto.base);
-  ::memset(&element_position_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&id_) -
-      reinterpret_cast<char*>(&element_position_)) + sizeof(id_));
+inline void GameElement::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.packed_){}
+    , decltype(_impl_.element_position_){nullptr}
+    , decltype(_impl_.id_){0}
+    , decltype(_impl_.baseline_age_){0u}
+    , decltype(_impl_.cleared_){0u}
+    , decltype(_impl_.specific_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}
+  };
+  _impl_.packed_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.packed_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   clear_has_specific();
 }
 
 GameElement::~GameElement() {
   // @@protoc_insertion_point(destructor:GameElement)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void GameElement::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-  if (this != internal_default_instance()) delete element_position_;
+inline void GameElement::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.packed_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.element_position_;
   if (has_specific()) {
     clear_specific();
   }
 }
 
-void GameElement::ArenaDtor(void* object) {
-  GameElement* _this = reinterpret_cast< GameElement* >(object);
-  (void)_this;
-}
-void GameElement::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void GameElement::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const GameElement& GameElement::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_GameElement_arkanoid_2eproto.base);
-  return *internal_default_instance();
-}
-
 
 void GameElement::clear_specific() {
 // @@protoc_insertion_point(one_of_clear_start:GameElement)
   switch (specific_case()) {
     case kBall: {
-      if (GetArena() == nullptr) {
-        delete specific_.ball_;
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.specific_.ball_;
       }
       break;
     }
     case kPaddle: {
-      if (GetArena() == nullptr) {
-        delete specific_.paddle_;
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.specific_.paddle_;
       }
       break;
     }
     case kBrick: {
-      if (GetArena() == nullptr) {
-        delete specific_.brick_;
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.specific_.brick_;
       }
       break;
     }
@@ -1296,136 +1534,182 @@ void GameElement::clear_specific() {
       break;
     }
   }
-  _oneof_case_[0] = SPECIFIC_NOT_SET;
+  _impl_._oneof_case_[0] = SPECIFIC_NOT_SET;
 }
 
 
 void GameElement::Clear() {
 // @@protoc_insertion_point(message_clear_start:GameElement)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  if (GetArena() == nullptr && element_position_ != nullptr) {
-    delete element_position_;
+  _impl_.packed_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.element_position_ != nullptr) {
+    delete _impl_.element_position_;
   }
-  element_position_ = nullptr;
-  id_ = 0;
+  _impl_.element_position_ = nullptr;
+  ::memset(&_impl_.id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.cleared_) -
+      reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.cleared_));
   clear_specific();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* GameElement::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* GameElement::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // int32 id = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
-          id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // .ElementPosition element_position = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
           ptr = ctx->ParseMessage(_internal_mutable_element_position(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // .NetBall ball = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
           ptr = ctx->ParseMessage(_internal_mutable_ball(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // .NetPaddle paddle = 4;
       case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
           ptr = ctx->ParseMessage(_internal_mutable_paddle(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // .NetBrick brick = 5;
       case 5:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 42)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
           ptr = ctx->ParseMessage(_internal_mutable_brick(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
+      // uint32 baseline_age = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.baseline_age_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      // uint32 cleared = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.cleared_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes packed = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          auto str = _internal_mutable_packed();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* GameElement::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* GameElement::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:GameElement)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // int32 id = 1;
-  if (this->id() != 0) {
+  if (this->_internal_id() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(1, this->_internal_id(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_id(), target);
   }
 
   // .ElementPosition element_position = 2;
-  if (this->has_element_position()) {
-    target = stream->EnsureSpace(target);
+  if (this->_internal_has_element_position()) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        2, _Internal::element_position(this), target, stream);
+      InternalWriteMessage(2, _Internal::element_position(this),
+        _Internal::element_position(this).GetCachedSize(), target, stream);
   }
 
   // .NetBall ball = 3;
   if (_internal_has_ball()) {
-    target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        3, _Internal::ball(this), target, stream);
+      InternalWriteMessage(3, _Internal::ball(this),
+        _Internal::ball(this).GetCachedSize(), target, stream);
   }
 
   // .NetPaddle paddle = 4;
   if (_internal_has_paddle()) {
-    target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        4, _Internal::paddle(this), target, stream);
+      InternalWriteMessage(4, _Internal::paddle(this),
+        _Internal::paddle(this).GetCachedSize(), target, stream);
   }
 
   // .NetBrick brick = 5;
   if (_internal_has_brick()) {
-    target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        5, _Internal::brick(this), target, stream);
+      InternalWriteMessage(5, _Internal::brick(this),
+        _Internal::brick(this).GetCachedSize(), target, stream);
+  }
+
+  // uint32 baseline_age = 6;
+  if (this->_internal_baseline_age() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(6, this->_internal_baseline_age(), target);
+  }
+
+  // uint32 cleared = 7;
+  if (this->_internal_cleared() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(7, this->_internal_cleared(), target);
+  }
+
+  // bytes packed = 8;
+  if (!this->_internal_packed().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        8, this->_internal_packed(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:GameElement)
@@ -1436,22 +1720,37 @@ size_t GameElement::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:GameElement)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
+  // bytes packed = 8;
+  if (!this->_internal_packed().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_packed());
+  }
+
   // .ElementPosition element_position = 2;
-  if (this->has_element_position()) {
+  if (this->_internal_has_element_position()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *element_position_);
+        *_impl_.element_position_);
   }
 
   // int32 id = 1;
-  if (this->id() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_id());
+  if (this->_internal_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_id());
+  }
+
+  // uint32 baseline_age = 6;
+  if (this->_internal_baseline_age() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_baseline_age());
+  }
+
+  // uint32 cleared = 7;
+  if (this->_internal_cleared() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_cleared());
   }
 
   switch (specific_case()) {
@@ -1459,88 +1758,82 @@ size_t GameElement::ByteSizeLong() const {
     case kBall: {
       total_size += 1 +
         ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          *specific_.ball_);
+          *_impl_.specific_.ball_);
       break;
     }
     // .NetPaddle paddle = 4;
     case kPaddle: {
       total_size += 1 +
         ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          *specific_.paddle_);
+          *_impl_.specific_.paddle_);
       break;
     }
     // .NetBrick brick = 5;
     case kBrick: {
       total_size += 1 +
         ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          *specific_.brick_);
+          *_impl_.specific_.brick_);
       break;
     }
     case SPECIFIC_NOT_SET: {
       break;
     }
   }
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void GameElement::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:GameElement)
-  GOOGLE_DCHECK_NE(&from, this);
-  const GameElement* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<GameElement>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:GameElement)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:GameElement)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GameElement::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GameElement::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GameElement::GetClassData() const { return &_class_data_; }
 
-void GameElement::MergeFrom(const GameElement& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:GameElement)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+
+void GameElement::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GameElement*>(&to_msg);
+  auto& from = static_cast<const GameElement&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:GameElement)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.has_element_position()) {
-    _internal_mutable_element_position()->::ElementPosition::MergeFrom(from._internal_element_position());
+  if (!from._internal_packed().empty()) {
+    _this->_internal_set_packed(from._internal_packed());
+  }
+  if (from._internal_has_element_position()) {
+    _this->_internal_mutable_element_position()->::ElementPosition::MergeFrom(
+        from._internal_element_position());
   }
-  if (from.id() != 0) {
-    _internal_set_id(from._internal_id());
+  if (from._internal_id() != 0) {
+    _this->_internal_set_id(from._internal_id());
+  }
+  if (from._internal_baseline_age() != 0) {
+    _this->_internal_set_baseline_age(from._internal_baseline_age());
+  }
+  if (from._internal_cleared() != 0) {
+    _this->_internal_set_cleared(from._internal_cleared());
   }
   switch (from.specific_case()) {
     case kBall: {
-      _internal_mutable_ball()->::NetBall::MergeFrom(from._internal_ball());
+      _this->_internal_mutable_ball()->::NetBall::MergeFrom(
+          from._internal_ball());
       break;
     }
     case kPaddle: {
-      _internal_mutable_paddle()->::NetPaddle::MergeFrom(from._internal_paddle());
+      _this->_internal_mutable_paddle()->::NetPaddle::MergeFrom(
+          from._internal_paddle());
       break;
     }
     case kBrick: {
-      _internal_mutable_brick()->::NetBrick::MergeFrom(from._internal_brick());
+      _this->_internal_mutable_brick()->::NetBrick::MergeFrom(
+          from._internal_brick());
       break;
     }
     case SPECIFIC_NOT_SET: {
       break;
     }
   }
-}
-
-void GameElement::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:GameElement)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void GameElement::CopyFrom(const GameElement& from) {
@@ -1556,94 +1849,2256 @@ bool GameElement::IsInitialized() const {
 
 void GameElement::InternalSwap(GameElement* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.packed_, lhs_arena,
+      &other->_impl_.packed_, rhs_arena
+  );
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(GameElement, id_)
-      + sizeof(GameElement::id_)
-      - PROTOBUF_FIELD_OFFSET(GameElement, element_position_)>(
-          reinterpret_cast<char*>(&element_position_),
-          reinterpret_cast<char*>(&other->element_position_));
-  swap(specific_, other->specific_);
-  swap(_oneof_case_[0], other->_oneof_case_[0]);
+      PROTOBUF_FIELD_OFFSET(GameElement, _impl_.cleared_)
+      + sizeof(GameElement::_impl_.cleared_)
+      - PROTOBUF_FIELD_OFFSET(GameElement, _impl_.element_position_)>(
+          reinterpret_cast<char*>(&_impl_.element_position_),
+          reinterpret_cast<char*>(&other->_impl_.element_position_));
+  swap(_impl_.specific_, other->_impl_.specific_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata GameElement::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_arkanoid_2eproto_getter, &descriptor_table_arkanoid_2eproto_once,
+      file_level_metadata_arkanoid_2eproto[4]);
 }
 
-
 // ===================================================================
 
-void GameUpdate::InitAsDefaultInstance() {
-}
-class GameUpdate::_Internal {
+class Ping::_Internal {
  public:
 };
 
-GameUpdate::GameUpdate(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
-  element_(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:GameUpdate)
+Ping::Ping(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Ping)
 }
-GameUpdate::GameUpdate(const GameUpdate& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      element_(from.element_) {
+Ping::Ping(const Ping& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Ping* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.sent_at_){}
+    , decltype(_impl_.tick_){}
+    , decltype(_impl_.tick_started_at_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  // @@protoc_insertion_point(copy_constructor:GameUpdate)
+  ::memcpy(&_impl_.sent_at_, &from._impl_.sent_at_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.tick_started_at_) -
+    reinterpret_cast<char*>(&_impl_.sent_at_)) + sizeof(_impl_.tick_started_at_));
+  // @@protoc_insertion_point(copy_constructor:Ping)
+}
+
+inline void Ping::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.sent_at_){int64_t{0}}
+    , decltype(_impl_.tick_){int64_t{0}}
+    , decltype(_impl_.tick_started_at_){int64_t{0}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+Ping::~Ping() {
+  // @@protoc_insertion_point(destructor:Ping)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
 }
 
-void GameUpdate::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_GameUpdate_arkanoid_2eproto.base);
+inline void Ping::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
-GameUpdate::~GameUpdate() {
-  // @@protoc_insertion_point(destructor:GameUpdate)
-  SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+void Ping::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-void GameUpdate::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-}
+void Ping::Clear() {
+// @@protoc_insertion_point(message_clear_start:Ping)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-void GameUpdate::ArenaDtor(void* object) {
-  GameUpdate* _this = reinterpret_cast< GameUpdate* >(object);
-  (void)_this;
+  ::memset(&_impl_.sent_at_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.tick_started_at_) -
+      reinterpret_cast<char*>(&_impl_.sent_at_)) + sizeof(_impl_.tick_started_at_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
-void GameUpdate::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+
+const char* Ping::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int64 sent_at = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.sent_at_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 tick = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.tick_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 tick_started_at = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.tick_started_at_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Ping::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Ping)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int64 sent_at = 1;
+  if (this->_internal_sent_at() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(1, this->_internal_sent_at(), target);
+  }
+
+  // int64 tick = 2;
+  if (this->_internal_tick() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(2, this->_internal_tick(), target);
+  }
+
+  // int64 tick_started_at = 3;
+  if (this->_internal_tick_started_at() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(3, this->_internal_tick_started_at(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Ping)
+  return target;
+}
+
+size_t Ping::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Ping)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // int64 sent_at = 1;
+  if (this->_internal_sent_at() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_sent_at());
+  }
+
+  // int64 tick = 2;
+  if (this->_internal_tick() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_tick());
+  }
+
+  // int64 tick_started_at = 3;
+  if (this->_internal_tick_started_at() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_tick_started_at());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Ping::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Ping::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Ping::GetClassData() const { return &_class_data_; }
+
+
+void Ping::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Ping*>(&to_msg);
+  auto& from = static_cast<const Ping&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Ping)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_sent_at() != 0) {
+    _this->_internal_set_sent_at(from._internal_sent_at());
+  }
+  if (from._internal_tick() != 0) {
+    _this->_internal_set_tick(from._internal_tick());
+  }
+  if (from._internal_tick_started_at() != 0) {
+    _this->_internal_set_tick_started_at(from._internal_tick_started_at());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Ping::CopyFrom(const Ping& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Ping)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Ping::IsInitialized() const {
+  return true;
+}
+
+void Ping::InternalSwap(Ping* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Ping, _impl_.tick_started_at_)
+      + sizeof(Ping::_impl_.tick_started_at_)
+      - PROTOBUF_FIELD_OFFSET(Ping, _impl_.sent_at_)>(
+          reinterpret_cast<char*>(&_impl_.sent_at_),
+          reinterpret_cast<char*>(&other->_impl_.sent_at_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Ping::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_arkanoid_2eproto_getter, &descriptor_table_arkanoid_2eproto_once,
+      file_level_metadata_arkanoid_2eproto[5]);
+}
+
+// ===================================================================
+
+class Pong::_Internal {
+ public:
+};
+
+Pong::Pong(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Pong)
+}
+Pong::Pong(const Pong& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Pong* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.ping_sent_at_){}
+    , decltype(_impl_.ping_received_at_){}
+    , decltype(_impl_.sent_at_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.ping_sent_at_, &from._impl_.ping_sent_at_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.sent_at_) -
+    reinterpret_cast<char*>(&_impl_.ping_sent_at_)) + sizeof(_impl_.sent_at_));
+  // @@protoc_insertion_point(copy_constructor:Pong)
+}
+
+inline void Pong::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.ping_sent_at_){int64_t{0}}
+    , decltype(_impl_.ping_received_at_){int64_t{0}}
+    , decltype(_impl_.sent_at_){int64_t{0}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+Pong::~Pong() {
+  // @@protoc_insertion_point(destructor:Pong)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Pong::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void Pong::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Pong::Clear() {
+// @@protoc_insertion_point(message_clear_start:Pong)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.ping_sent_at_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.sent_at_) -
+      reinterpret_cast<char*>(&_impl_.ping_sent_at_)) + sizeof(_impl_.sent_at_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Pong::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int64 ping_sent_at = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.ping_sent_at_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 ping_received_at = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.ping_received_at_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 sent_at = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.sent_at_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Pong::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Pong)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int64 ping_sent_at = 1;
+  if (this->_internal_ping_sent_at() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(1, this->_internal_ping_sent_at(), target);
+  }
+
+  // int64 ping_received_at = 2;
+  if (this->_internal_ping_received_at() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(2, this->_internal_ping_received_at(), target);
+  }
+
+  // int64 sent_at = 3;
+  if (this->_internal_sent_at() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(3, this->_internal_sent_at(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Pong)
+  return target;
+}
+
+size_t Pong::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Pong)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // int64 ping_sent_at = 1;
+  if (this->_internal_ping_sent_at() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_ping_sent_at());
+  }
+
+  // int64 ping_received_at = 2;
+  if (this->_internal_ping_received_at() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_ping_received_at());
+  }
+
+  // int64 sent_at = 3;
+  if (this->_internal_sent_at() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_sent_at());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Pong::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Pong::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Pong::GetClassData() const { return &_class_data_; }
+
+
+void Pong::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Pong*>(&to_msg);
+  auto& from = static_cast<const Pong&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Pong)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_ping_sent_at() != 0) {
+    _this->_internal_set_ping_sent_at(from._internal_ping_sent_at());
+  }
+  if (from._internal_ping_received_at() != 0) {
+    _this->_internal_set_ping_received_at(from._internal_ping_received_at());
+  }
+  if (from._internal_sent_at() != 0) {
+    _this->_internal_set_sent_at(from._internal_sent_at());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Pong::CopyFrom(const Pong& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Pong)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Pong::IsInitialized() const {
+  return true;
+}
+
+void Pong::InternalSwap(Pong* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Pong, _impl_.sent_at_)
+      + sizeof(Pong::_impl_.sent_at_)
+      - PROTOBUF_FIELD_OFFSET(Pong, _impl_.ping_sent_at_)>(
+          reinterpret_cast<char*>(&_impl_.ping_sent_at_),
+          reinterpret_cast<char*>(&other->_impl_.ping_sent_at_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Pong::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_arkanoid_2eproto_getter, &descriptor_table_arkanoid_2eproto_once,
+      file_level_metadata_arkanoid_2eproto[6]);
+}
+
+// ===================================================================
+
+class PlayerInput::_Internal {
+ public:
+};
+
+PlayerInput::PlayerInput(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:PlayerInput)
+}
+PlayerInput::PlayerInput(const PlayerInput& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PlayerInput* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.mouse_x_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.mouse_x_ = from._impl_.mouse_x_;
+  // @@protoc_insertion_point(copy_constructor:PlayerInput)
+}
+
+inline void PlayerInput::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.mouse_x_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+PlayerInput::~PlayerInput() {
+  // @@protoc_insertion_point(destructor:PlayerInput)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PlayerInput::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void PlayerInput::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PlayerInput::Clear() {
+// @@protoc_insertion_point(message_clear_start:PlayerInput)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.mouse_x_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PlayerInput::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 mouse_x = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.mouse_x_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PlayerInput::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:PlayerInput)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 mouse_x = 1;
+  if (this->_internal_mouse_x() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_mouse_x(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:PlayerInput)
+  return target;
+}
+
+size_t PlayerInput::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:PlayerInput)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // int32 mouse_x = 1;
+  if (this->_internal_mouse_x() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_mouse_x());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PlayerInput::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PlayerInput::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PlayerInput::GetClassData() const { return &_class_data_; }
+
+
+void PlayerInput::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PlayerInput*>(&to_msg);
+  auto& from = static_cast<const PlayerInput&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:PlayerInput)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_mouse_x() != 0) {
+    _this->_internal_set_mouse_x(from._internal_mouse_x());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PlayerInput::CopyFrom(const PlayerInput& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:PlayerInput)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PlayerInput::IsInitialized() const {
+  return true;
+}
+
+void PlayerInput::InternalSwap(PlayerInput* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.mouse_x_, other->_impl_.mouse_x_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PlayerInput::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_arkanoid_2eproto_getter, &descriptor_table_arkanoid_2eproto_once,
+      file_level_metadata_arkanoid_2eproto[7]);
+}
+
+// ===================================================================
+
+class BrickHit::_Internal {
+ public:
+};
+
+BrickHit::BrickHit(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:BrickHit)
+}
+BrickHit::BrickHit(const BrickHit& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BrickHit* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.id_){}
+    , decltype(_impl_.paddle_id_){}
+    , decltype(_impl_.duration_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.id_, &from._impl_.id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.duration_) -
+    reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.duration_));
+  // @@protoc_insertion_point(copy_constructor:BrickHit)
+}
+
+inline void BrickHit::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.id_){0}
+    , decltype(_impl_.paddle_id_){0}
+    , decltype(_impl_.duration_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+BrickHit::~BrickHit() {
+  // @@protoc_insertion_point(destructor:BrickHit)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void BrickHit::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void BrickHit::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void BrickHit::Clear() {
+// @@protoc_insertion_point(message_clear_start:BrickHit)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.duration_) -
+      reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.duration_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* BrickHit::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 paddle_id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.paddle_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 duration = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.duration_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* BrickHit::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:BrickHit)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 id = 1;
+  if (this->_internal_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_id(), target);
+  }
+
+  // int32 paddle_id = 2;
+  if (this->_internal_paddle_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_paddle_id(), target);
+  }
+
+  // int32 duration = 3;
+  if (this->_internal_duration() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_duration(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:BrickHit)
+  return target;
+}
+
+size_t BrickHit::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:BrickHit)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // int32 id = 1;
+  if (this->_internal_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_id());
+  }
+
+  // int32 paddle_id = 2;
+  if (this->_internal_paddle_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_paddle_id());
+  }
+
+  // int32 duration = 3;
+  if (this->_internal_duration() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_duration());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BrickHit::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BrickHit::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BrickHit::GetClassData() const { return &_class_data_; }
+
+
+void BrickHit::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BrickHit*>(&to_msg);
+  auto& from = static_cast<const BrickHit&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:BrickHit)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_id() != 0) {
+    _this->_internal_set_id(from._internal_id());
+  }
+  if (from._internal_paddle_id() != 0) {
+    _this->_internal_set_paddle_id(from._internal_paddle_id());
+  }
+  if (from._internal_duration() != 0) {
+    _this->_internal_set_duration(from._internal_duration());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void BrickHit::CopyFrom(const BrickHit& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:BrickHit)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool BrickHit::IsInitialized() const {
+  return true;
+}
+
+void BrickHit::InternalSwap(BrickHit* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(BrickHit, _impl_.duration_)
+      + sizeof(BrickHit::_impl_.duration_)
+      - PROTOBUF_FIELD_OFFSET(BrickHit, _impl_.id_)>(
+          reinterpret_cast<char*>(&_impl_.id_),
+          reinterpret_cast<char*>(&other->_impl_.id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata BrickHit::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_arkanoid_2eproto_getter, &descriptor_table_arkanoid_2eproto_once,
+      file_level_metadata_arkanoid_2eproto[8]);
+}
+
+// ===================================================================
+
+class ScoreDelta::_Internal {
+ public:
+};
+
+ScoreDelta::ScoreDelta(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ScoreDelta)
+}
+ScoreDelta::ScoreDelta(const ScoreDelta& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ScoreDelta* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.paddle_id_){}
+    , decltype(_impl_.delta_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.paddle_id_, &from._impl_.paddle_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.delta_) -
+    reinterpret_cast<char*>(&_impl_.paddle_id_)) + sizeof(_impl_.delta_));
+  // @@protoc_insertion_point(copy_constructor:ScoreDelta)
+}
+
+inline void ScoreDelta::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.paddle_id_){0}
+    , decltype(_impl_.delta_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ScoreDelta::~ScoreDelta() {
+  // @@protoc_insertion_point(destructor:ScoreDelta)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ScoreDelta::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void ScoreDelta::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ScoreDelta::Clear() {
+// @@protoc_insertion_point(message_clear_start:ScoreDelta)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.paddle_id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.delta_) -
+      reinterpret_cast<char*>(&_impl_.paddle_id_)) + sizeof(_impl_.delta_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ScoreDelta::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 paddle_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.paddle_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 delta = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.delta_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ScoreDelta::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ScoreDelta)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 paddle_id = 1;
+  if (this->_internal_paddle_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_paddle_id(), target);
+  }
+
+  // int32 delta = 2;
+  if (this->_internal_delta() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_delta(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ScoreDelta)
+  return target;
+}
+
+size_t ScoreDelta::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ScoreDelta)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // int32 paddle_id = 1;
+  if (this->_internal_paddle_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_paddle_id());
+  }
+
+  // int32 delta = 2;
+  if (this->_internal_delta() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_delta());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ScoreDelta::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ScoreDelta::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ScoreDelta::GetClassData() const { return &_class_data_; }
+
+
+void ScoreDelta::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ScoreDelta*>(&to_msg);
+  auto& from = static_cast<const ScoreDelta&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ScoreDelta)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_paddle_id() != 0) {
+    _this->_internal_set_paddle_id(from._internal_paddle_id());
+  }
+  if (from._internal_delta() != 0) {
+    _this->_internal_set_delta(from._internal_delta());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ScoreDelta::CopyFrom(const ScoreDelta& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ScoreDelta)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ScoreDelta::IsInitialized() const {
+  return true;
+}
+
+void ScoreDelta::InternalSwap(ScoreDelta* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ScoreDelta, _impl_.delta_)
+      + sizeof(ScoreDelta::_impl_.delta_)
+      - PROTOBUF_FIELD_OFFSET(ScoreDelta, _impl_.paddle_id_)>(
+          reinterpret_cast<char*>(&_impl_.paddle_id_),
+          reinterpret_cast<char*>(&other->_impl_.paddle_id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ScoreDelta::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_arkanoid_2eproto_getter, &descriptor_table_arkanoid_2eproto_once,
+      file_level_metadata_arkanoid_2eproto[9]);
+}
+
+// ===================================================================
+
+class GameEvent::_Internal {
+ public:
+  static const ::BrickHit& brick_hit(const GameEvent* msg);
+  static const ::ScoreDelta& score_delta(const GameEvent* msg);
+};
+
+const ::BrickHit&
+GameEvent::_Internal::brick_hit(const GameEvent* msg) {
+  return *msg->_impl_.event_.brick_hit_;
+}
+const ::ScoreDelta&
+GameEvent::_Internal::score_delta(const GameEvent* msg) {
+  return *msg->_impl_.event_.score_delta_;
+}
+void GameEvent::set_allocated_brick_hit(::BrickHit* brick_hit) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_event();
+  if (brick_hit) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(brick_hit);
+    if (message_arena != submessage_arena) {
+      brick_hit = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, brick_hit, submessage_arena);
+    }
+    set_has_brick_hit();
+    _impl_.event_.brick_hit_ = brick_hit;
+  }
+  // @@protoc_insertion_point(field_set_allocated:GameEvent.brick_hit)
+}
+void GameEvent::set_allocated_score_delta(::ScoreDelta* score_delta) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_event();
+  if (score_delta) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(score_delta);
+    if (message_arena != submessage_arena) {
+      score_delta = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, score_delta, submessage_arena);
+    }
+    set_has_score_delta();
+    _impl_.event_.score_delta_ = score_delta;
+  }
+  // @@protoc_insertion_point(field_set_allocated:GameEvent.score_delta)
+}
+GameEvent::GameEvent(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:GameEvent)
+}
+GameEvent::GameEvent(const GameEvent& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GameEvent* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.id_){}
+    , decltype(_impl_.event_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.id_ = from._impl_.id_;
+  clear_has_event();
+  switch (from.event_case()) {
+    case kBrickHit: {
+      _this->_internal_mutable_brick_hit()->::BrickHit::MergeFrom(
+          from._internal_brick_hit());
+      break;
+    }
+    case kScoreDelta: {
+      _this->_internal_mutable_score_delta()->::ScoreDelta::MergeFrom(
+          from._internal_score_delta());
+      break;
+    }
+    case EVENT_NOT_SET: {
+      break;
+    }
+  }
+  // @@protoc_insertion_point(copy_constructor:GameEvent)
+}
+
+inline void GameEvent::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.id_){0u}
+    , decltype(_impl_.event_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}
+  };
+  clear_has_event();
+}
+
+GameEvent::~GameEvent() {
+  // @@protoc_insertion_point(destructor:GameEvent)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void GameEvent::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (has_event()) {
+    clear_event();
+  }
+}
+
+void GameEvent::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void GameEvent::clear_event() {
+// @@protoc_insertion_point(one_of_clear_start:GameEvent)
+  switch (event_case()) {
+    case kBrickHit: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.event_.brick_hit_;
+      }
+      break;
+    }
+    case kScoreDelta: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.event_.score_delta_;
+      }
+      break;
+    }
+    case EVENT_NOT_SET: {
+      break;
+    }
+  }
+  _impl_._oneof_case_[0] = EVENT_NOT_SET;
+}
+
+
+void GameEvent::Clear() {
+// @@protoc_insertion_point(message_clear_start:GameEvent)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.id_ = 0u;
+  clear_event();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* GameEvent::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .BrickHit brick_hit = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_brick_hit(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .ScoreDelta score_delta = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_score_delta(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* GameEvent::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:GameEvent)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 id = 1;
+  if (this->_internal_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_id(), target);
+  }
+
+  // .BrickHit brick_hit = 2;
+  if (_internal_has_brick_hit()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::brick_hit(this),
+        _Internal::brick_hit(this).GetCachedSize(), target, stream);
+  }
+
+  // .ScoreDelta score_delta = 3;
+  if (_internal_has_score_delta()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::score_delta(this),
+        _Internal::score_delta(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:GameEvent)
+  return target;
+}
+
+size_t GameEvent::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:GameEvent)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // uint32 id = 1;
+  if (this->_internal_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_id());
+  }
+
+  switch (event_case()) {
+    // .BrickHit brick_hit = 2;
+    case kBrickHit: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.event_.brick_hit_);
+      break;
+    }
+    // .ScoreDelta score_delta = 3;
+    case kScoreDelta: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.event_.score_delta_);
+      break;
+    }
+    case EVENT_NOT_SET: {
+      break;
+    }
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GameEvent::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GameEvent::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GameEvent::GetClassData() const { return &_class_data_; }
+
+
+void GameEvent::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GameEvent*>(&to_msg);
+  auto& from = static_cast<const GameEvent&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:GameEvent)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_id() != 0) {
+    _this->_internal_set_id(from._internal_id());
+  }
+  switch (from.event_case()) {
+    case kBrickHit: {
+      _this->_internal_mutable_brick_hit()->::BrickHit::MergeFrom(
+          from._internal_brick_hit());
+      break;
+    }
+    case kScoreDelta: {
+      _this->_internal_mutable_score_delta()->::ScoreDelta::MergeFrom(
+          from._internal_score_delta());
+      break;
+    }
+    case EVENT_NOT_SET: {
+      break;
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void GameEvent::CopyFrom(const GameEvent& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:GameEvent)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool GameEvent::IsInitialized() const {
+  return true;
+}
+
+void GameEvent::InternalSwap(GameEvent* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.id_, other->_impl_.id_);
+  swap(_impl_.event_, other->_impl_.event_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata GameEvent::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_arkanoid_2eproto_getter, &descriptor_table_arkanoid_2eproto_once,
+      file_level_metadata_arkanoid_2eproto[10]);
+}
+
+// ===================================================================
+
+class LockstepInput::_Internal {
+ public:
+};
+
+LockstepInput::LockstepInput(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:LockstepInput)
+}
+LockstepInput::LockstepInput(const LockstepInput& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  LockstepInput* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.mouse_x_){from._impl_.mouse_x_}
+    , /*decltype(_impl_._mouse_x_cached_byte_size_)*/{0}
+    , decltype(_impl_.first_tick_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.first_tick_ = from._impl_.first_tick_;
+  // @@protoc_insertion_point(copy_constructor:LockstepInput)
+}
+
+inline void LockstepInput::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.mouse_x_){arena}
+    , /*decltype(_impl_._mouse_x_cached_byte_size_)*/{0}
+    , decltype(_impl_.first_tick_){int64_t{0}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+LockstepInput::~LockstepInput() {
+  // @@protoc_insertion_point(destructor:LockstepInput)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void LockstepInput::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.mouse_x_.~RepeatedField();
+}
+
+void LockstepInput::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void LockstepInput::Clear() {
+// @@protoc_insertion_point(message_clear_start:LockstepInput)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.mouse_x_.Clear();
+  _impl_.first_tick_ = int64_t{0};
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* LockstepInput::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int64 first_tick = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.first_tick_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated sint32 mouse_x = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedSInt32Parser(_internal_mutable_mouse_x(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 16) {
+          _internal_add_mouse_x(::PROTOBUF_NAMESPACE_ID::internal::ReadVarintZigZag32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* LockstepInput::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:LockstepInput)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int64 first_tick = 1;
+  if (this->_internal_first_tick() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(1, this->_internal_first_tick(), target);
+  }
+
+  // repeated sint32 mouse_x = 2;
+  {
+    int byte_size = _impl_._mouse_x_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteSInt32Packed(
+          2, _internal_mouse_x(), byte_size, target);
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:LockstepInput)
+  return target;
+}
+
+size_t LockstepInput::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:LockstepInput)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated sint32 mouse_x = 2;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      SInt32Size(this->_impl_.mouse_x_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._mouse_x_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // int64 first_tick = 1;
+  if (this->_internal_first_tick() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_first_tick());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData LockstepInput::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    LockstepInput::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*LockstepInput::GetClassData() const { return &_class_data_; }
+
+
+void LockstepInput::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<LockstepInput*>(&to_msg);
+  auto& from = static_cast<const LockstepInput&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:LockstepInput)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.mouse_x_.MergeFrom(from._impl_.mouse_x_);
+  if (from._internal_first_tick() != 0) {
+    _this->_internal_set_first_tick(from._internal_first_tick());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void LockstepInput::CopyFrom(const LockstepInput& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:LockstepInput)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool LockstepInput::IsInitialized() const {
+  return true;
+}
+
+void LockstepInput::InternalSwap(LockstepInput* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.mouse_x_.InternalSwap(&other->_impl_.mouse_x_);
+  swap(_impl_.first_tick_, other->_impl_.first_tick_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata LockstepInput::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_arkanoid_2eproto_getter, &descriptor_table_arkanoid_2eproto_once,
+      file_level_metadata_arkanoid_2eproto[11]);
+}
+
+// ===================================================================
+
+class LockstepStart::_Internal {
+ public:
+};
+
+LockstepStart::LockstepStart(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:LockstepStart)
+}
+LockstepStart::LockstepStart(const LockstepStart& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  LockstepStart* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.brick_seed_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.brick_seed_ = from._impl_.brick_seed_;
+  // @@protoc_insertion_point(copy_constructor:LockstepStart)
+}
+
+inline void LockstepStart::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.brick_seed_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+LockstepStart::~LockstepStart() {
+  // @@protoc_insertion_point(destructor:LockstepStart)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void LockstepStart::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void LockstepStart::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void LockstepStart::Clear() {
+// @@protoc_insertion_point(message_clear_start:LockstepStart)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.brick_seed_ = 0u;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* LockstepStart::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 brick_seed = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.brick_seed_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* LockstepStart::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:LockstepStart)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 brick_seed = 1;
+  if (this->_internal_brick_seed() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_brick_seed(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:LockstepStart)
+  return target;
+}
+
+size_t LockstepStart::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:LockstepStart)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // uint32 brick_seed = 1;
+  if (this->_internal_brick_seed() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_brick_seed());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData LockstepStart::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    LockstepStart::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*LockstepStart::GetClassData() const { return &_class_data_; }
+
+
+void LockstepStart::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<LockstepStart*>(&to_msg);
+  auto& from = static_cast<const LockstepStart&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:LockstepStart)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_brick_seed() != 0) {
+    _this->_internal_set_brick_seed(from._internal_brick_seed());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void LockstepStart::CopyFrom(const LockstepStart& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:LockstepStart)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool LockstepStart::IsInitialized() const {
+  return true;
+}
+
+void LockstepStart::InternalSwap(LockstepStart* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.brick_seed_, other->_impl_.brick_seed_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata LockstepStart::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_arkanoid_2eproto_getter, &descriptor_table_arkanoid_2eproto_once,
+      file_level_metadata_arkanoid_2eproto[12]);
+}
+
+// ===================================================================
+
+class StateHash::_Internal {
+ public:
+};
+
+StateHash::StateHash(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:StateHash)
 }
-void GameUpdate::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+StateHash::StateHash(const StateHash& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  StateHash* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.tick_){}
+    , decltype(_impl_.value_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.tick_, &from._impl_.tick_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.value_) -
+    reinterpret_cast<char*>(&_impl_.tick_)) + sizeof(_impl_.value_));
+  // @@protoc_insertion_point(copy_constructor:StateHash)
+}
+
+inline void StateHash::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.tick_){int64_t{0}}
+    , decltype(_impl_.value_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+StateHash::~StateHash() {
+  // @@protoc_insertion_point(destructor:StateHash)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void StateHash::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void StateHash::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void StateHash::Clear() {
+// @@protoc_insertion_point(message_clear_start:StateHash)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.tick_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.value_) -
+      reinterpret_cast<char*>(&_impl_.tick_)) + sizeof(_impl_.value_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* StateHash::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int64 tick = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.tick_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // fixed64 value = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _impl_.value_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* StateHash::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:StateHash)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int64 tick = 1;
+  if (this->_internal_tick() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(1, this->_internal_tick(), target);
+  }
+
+  // fixed64 value = 2;
+  if (this->_internal_value() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(2, this->_internal_value(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:StateHash)
+  return target;
+}
+
+size_t StateHash::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:StateHash)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // int64 tick = 1;
+  if (this->_internal_tick() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_tick());
+  }
+
+  // fixed64 value = 2;
+  if (this->_internal_value() != 0) {
+    total_size += 1 + 8;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData StateHash::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    StateHash::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*StateHash::GetClassData() const { return &_class_data_; }
+
+
+void StateHash::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<StateHash*>(&to_msg);
+  auto& from = static_cast<const StateHash&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:StateHash)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_tick() != 0) {
+    _this->_internal_set_tick(from._internal_tick());
+  }
+  if (from._internal_value() != 0) {
+    _this->_internal_set_value(from._internal_value());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void StateHash::CopyFrom(const StateHash& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:StateHash)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool StateHash::IsInitialized() const {
+  return true;
+}
+
+void StateHash::InternalSwap(StateHash* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(StateHash, _impl_.value_)
+      + sizeof(StateHash::_impl_.value_)
+      - PROTOBUF_FIELD_OFFSET(StateHash, _impl_.tick_)>(
+          reinterpret_cast<char*>(&_impl_.tick_),
+          reinterpret_cast<char*>(&other->_impl_.tick_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata StateHash::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_arkanoid_2eproto_getter, &descriptor_table_arkanoid_2eproto_once,
+      file_level_metadata_arkanoid_2eproto[13]);
+}
+
+// ===================================================================
+
+class GameUpdate::_Internal {
+ public:
+  static const ::Ping& ping(const GameUpdate* msg);
+  static const ::Pong& pong(const GameUpdate* msg);
+  static const ::PlayerInput& input(const GameUpdate* msg);
+  static const ::StateHash& state_hash(const GameUpdate* msg);
+  static const ::LockstepInput& lockstep_input(const GameUpdate* msg);
+  static const ::LockstepStart& lockstep_start(const GameUpdate* msg);
+};
+
+const ::Ping&
+GameUpdate::_Internal::ping(const GameUpdate* msg) {
+  return *msg->_impl_.ping_;
+}
+const ::Pong&
+GameUpdate::_Internal::pong(const GameUpdate* msg) {
+  return *msg->_impl_.pong_;
+}
+const ::PlayerInput&
+GameUpdate::_Internal::input(const GameUpdate* msg) {
+  return *msg->_impl_.input_;
+}
+const ::StateHash&
+GameUpdate::_Internal::state_hash(const GameUpdate* msg) {
+  return *msg->_impl_.state_hash_;
+}
+const ::LockstepInput&
+GameUpdate::_Internal::lockstep_input(const GameUpdate* msg) {
+  return *msg->_impl_.lockstep_input_;
+}
+const ::LockstepStart&
+GameUpdate::_Internal::lockstep_start(const GameUpdate* msg) {
+  return *msg->_impl_.lockstep_start_;
 }
-const GameUpdate& GameUpdate::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_GameUpdate_arkanoid_2eproto.base);
-  return *internal_default_instance();
+GameUpdate::GameUpdate(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:GameUpdate)
+}
+GameUpdate::GameUpdate(const GameUpdate& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GameUpdate* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.element_){from._impl_.element_}
+    , decltype(_impl_.event_){from._impl_.event_}
+    , decltype(_impl_.state_){}
+    , decltype(_impl_.ping_){nullptr}
+    , decltype(_impl_.pong_){nullptr}
+    , decltype(_impl_.input_){nullptr}
+    , decltype(_impl_.state_hash_){nullptr}
+    , decltype(_impl_.lockstep_input_){nullptr}
+    , decltype(_impl_.lockstep_start_){nullptr}
+    , decltype(_impl_.tick_){}
+    , decltype(_impl_.sequence_){}
+    , decltype(_impl_.ack_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.state_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.state_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_state().empty()) {
+    _this->_impl_.state_.Set(from._internal_state(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_ping()) {
+    _this->_impl_.ping_ = new ::Ping(*from._impl_.ping_);
+  }
+  if (from._internal_has_pong()) {
+    _this->_impl_.pong_ = new ::Pong(*from._impl_.pong_);
+  }
+  if (from._internal_has_input()) {
+    _this->_impl_.input_ = new ::PlayerInput(*from._impl_.input_);
+  }
+  if (from._internal_has_state_hash()) {
+    _this->_impl_.state_hash_ = new ::StateHash(*from._impl_.state_hash_);
+  }
+  if (from._internal_has_lockstep_input()) {
+    _this->_impl_.lockstep_input_ = new ::LockstepInput(*from._impl_.lockstep_input_);
+  }
+  if (from._internal_has_lockstep_start()) {
+    _this->_impl_.lockstep_start_ = new ::LockstepStart(*from._impl_.lockstep_start_);
+  }
+  ::memcpy(&_impl_.tick_, &from._impl_.tick_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.ack_) -
+    reinterpret_cast<char*>(&_impl_.tick_)) + sizeof(_impl_.ack_));
+  // @@protoc_insertion_point(copy_constructor:GameUpdate)
+}
+
+inline void GameUpdate::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.element_){arena}
+    , decltype(_impl_.event_){arena}
+    , decltype(_impl_.state_){}
+    , decltype(_impl_.ping_){nullptr}
+    , decltype(_impl_.pong_){nullptr}
+    , decltype(_impl_.input_){nullptr}
+    , decltype(_impl_.state_hash_){nullptr}
+    , decltype(_impl_.lockstep_input_){nullptr}
+    , decltype(_impl_.lockstep_start_){nullptr}
+    , decltype(_impl_.tick_){int64_t{0}}
+    , decltype(_impl_.sequence_){0u}
+    , decltype(_impl_.ack_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.state_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.state_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
+GameUpdate::~GameUpdate() {
+  // @@protoc_insertion_point(destructor:GameUpdate)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void GameUpdate::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.element_.~RepeatedPtrField();
+  _impl_.event_.~RepeatedPtrField();
+  _impl_.state_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.ping_;
+  if (this != internal_default_instance()) delete _impl_.pong_;
+  if (this != internal_default_instance()) delete _impl_.input_;
+  if (this != internal_default_instance()) delete _impl_.state_hash_;
+  if (this != internal_default_instance()) delete _impl_.lockstep_input_;
+  if (this != internal_default_instance()) delete _impl_.lockstep_start_;
+}
+
+void GameUpdate::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
 
 void GameUpdate::Clear() {
 // @@protoc_insertion_point(message_clear_start:GameUpdate)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  element_.Clear();
+  _impl_.element_.Clear();
+  _impl_.event_.Clear();
+  _impl_.state_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.ping_ != nullptr) {
+    delete _impl_.ping_;
+  }
+  _impl_.ping_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.pong_ != nullptr) {
+    delete _impl_.pong_;
+  }
+  _impl_.pong_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.input_ != nullptr) {
+    delete _impl_.input_;
+  }
+  _impl_.input_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.state_hash_ != nullptr) {
+    delete _impl_.state_hash_;
+  }
+  _impl_.state_hash_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.lockstep_input_ != nullptr) {
+    delete _impl_.lockstep_input_;
+  }
+  _impl_.lockstep_input_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.lockstep_start_ != nullptr) {
+    delete _impl_.lockstep_start_;
+  }
+  _impl_.lockstep_start_ = nullptr;
+  ::memset(&_impl_.tick_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.ack_) -
+      reinterpret_cast<char*>(&_impl_.tick_)) + sizeof(_impl_.ack_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* GameUpdate::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* GameUpdate::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // repeated .GameElement element = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           ptr -= 1;
           do {
             ptr += 1;
@@ -1651,46 +4106,216 @@ const char* GameUpdate::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID:
             CHK_(ptr);
             if (!ctx->DataAvailable(ptr)) break;
           } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
+      // .Ping ping = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_ping(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      // .Pong pong = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_pong(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 tick = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.tick_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 sequence = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.sequence_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 ack = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.ack_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .PlayerInput input = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_input(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .GameEvent event = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_event(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<66>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // .StateHash state_hash = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          ptr = ctx->ParseMessage(_internal_mutable_state_hash(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .LockstepInput lockstep_input = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          ptr = ctx->ParseMessage(_internal_mutable_lockstep_input(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .LockstepStart lockstep_start = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
+          ptr = ctx->ParseMessage(_internal_mutable_lockstep_start(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes state = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 98)) {
+          auto str = _internal_mutable_state();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* GameUpdate::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* GameUpdate::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:GameUpdate)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // repeated .GameElement element = 1;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->_internal_element_size()); i < n; i++) {
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_element_size()); i < n; i++) {
+    const auto& repfield = this->_internal_element(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // .Ping ping = 2;
+  if (this->_internal_has_ping()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::ping(this),
+        _Internal::ping(this).GetCachedSize(), target, stream);
+  }
+
+  // .Pong pong = 3;
+  if (this->_internal_has_pong()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::pong(this),
+        _Internal::pong(this).GetCachedSize(), target, stream);
+  }
+
+  // int64 tick = 4;
+  if (this->_internal_tick() != 0) {
     target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(4, this->_internal_tick(), target);
+  }
+
+  // uint32 sequence = 5;
+  if (this->_internal_sequence() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_sequence(), target);
+  }
+
+  // uint32 ack = 6;
+  if (this->_internal_ack() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(6, this->_internal_ack(), target);
+  }
+
+  // .PlayerInput input = 7;
+  if (this->_internal_has_input()) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(1, this->_internal_element(i), target, stream);
+      InternalWriteMessage(7, _Internal::input(this),
+        _Internal::input(this).GetCachedSize(), target, stream);
+  }
+
+  // repeated .GameEvent event = 8;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_event_size()); i < n; i++) {
+    const auto& repfield = this->_internal_event(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(8, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // .StateHash state_hash = 9;
+  if (this->_internal_has_state_hash()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(9, _Internal::state_hash(this),
+        _Internal::state_hash(this).GetCachedSize(), target, stream);
+  }
+
+  // .LockstepInput lockstep_input = 10;
+  if (this->_internal_has_lockstep_input()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(10, _Internal::lockstep_input(this),
+        _Internal::lockstep_input(this).GetCachedSize(), target, stream);
+  }
+
+  // .LockstepStart lockstep_start = 11;
+  if (this->_internal_has_lockstep_start()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(11, _Internal::lockstep_start(this),
+        _Internal::lockstep_start(this).GetCachedSize(), target, stream);
+  }
+
+  // bytes state = 12;
+  if (!this->_internal_state().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        12, this->_internal_state(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:GameUpdate)
@@ -1701,56 +4326,145 @@ size_t GameUpdate::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:GameUpdate)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // repeated .GameElement element = 1;
   total_size += 1UL * this->_internal_element_size();
-  for (const auto& msg : this->element_) {
+  for (const auto& msg : this->_impl_.element_) {
     total_size +=
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
+  // repeated .GameEvent event = 8;
+  total_size += 1UL * this->_internal_event_size();
+  for (const auto& msg : this->_impl_.event_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
 
-void GameUpdate::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:GameUpdate)
-  GOOGLE_DCHECK_NE(&from, this);
-  const GameUpdate* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<GameUpdate>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:GameUpdate)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:GameUpdate)
-    MergeFrom(*source);
+  // bytes state = 12;
+  if (!this->_internal_state().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_state());
   }
-}
 
-void GameUpdate::MergeFrom(const GameUpdate& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:GameUpdate)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+  // .Ping ping = 2;
+  if (this->_internal_has_ping()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.ping_);
+  }
+
+  // .Pong pong = 3;
+  if (this->_internal_has_pong()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.pong_);
+  }
+
+  // .PlayerInput input = 7;
+  if (this->_internal_has_input()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.input_);
+  }
+
+  // .StateHash state_hash = 9;
+  if (this->_internal_has_state_hash()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.state_hash_);
+  }
+
+  // .LockstepInput lockstep_input = 10;
+  if (this->_internal_has_lockstep_input()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.lockstep_input_);
+  }
+
+  // .LockstepStart lockstep_start = 11;
+  if (this->_internal_has_lockstep_start()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.lockstep_start_);
+  }
+
+  // int64 tick = 4;
+  if (this->_internal_tick() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_tick());
+  }
+
+  // uint32 sequence = 5;
+  if (this->_internal_sequence() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_sequence());
+  }
+
+  // uint32 ack = 6;
+  if (this->_internal_ack() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_ack());
+  }
 
-  element_.MergeFrom(from.element_);
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void GameUpdate::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:GameUpdate)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GameUpdate::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GameUpdate::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GameUpdate::GetClassData() const { return &_class_data_; }
+
+
+void GameUpdate::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GameUpdate*>(&to_msg);
+  auto& from = static_cast<const GameUpdate&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:GameUpdate)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.element_.MergeFrom(from._impl_.element_);
+  _this->_impl_.event_.MergeFrom(from._impl_.event_);
+  if (!from._internal_state().empty()) {
+    _this->_internal_set_state(from._internal_state());
+  }
+  if (from._internal_has_ping()) {
+    _this->_internal_mutable_ping()->::Ping::MergeFrom(
+        from._internal_ping());
+  }
+  if (from._internal_has_pong()) {
+    _this->_internal_mutable_pong()->::Pong::MergeFrom(
+        from._internal_pong());
+  }
+  if (from._internal_has_input()) {
+    _this->_internal_mutable_input()->::PlayerInput::MergeFrom(
+        from._internal_input());
+  }
+  if (from._internal_has_state_hash()) {
+    _this->_internal_mutable_state_hash()->::StateHash::MergeFrom(
+        from._internal_state_hash());
+  }
+  if (from._internal_has_lockstep_input()) {
+    _this->_internal_mutable_lockstep_input()->::LockstepInput::MergeFrom(
+        from._internal_lockstep_input());
+  }
+  if (from._internal_has_lockstep_start()) {
+    _this->_internal_mutable_lockstep_start()->::LockstepStart::MergeFrom(
+        from._internal_lockstep_start());
+  }
+  if (from._internal_tick() != 0) {
+    _this->_internal_set_tick(from._internal_tick());
+  }
+  if (from._internal_sequence() != 0) {
+    _this->_internal_set_sequence(from._internal_sequence());
+  }
+  if (from._internal_ack() != 0) {
+    _this->_internal_set_ack(from._internal_ack());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void GameUpdate::CopyFrom(const GameUpdate& from) {
@@ -1766,33 +4480,89 @@ bool GameUpdate::IsInitialized() const {
 
 void GameUpdate::InternalSwap(GameUpdate* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  element_.InternalSwap(&other->element_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.element_.InternalSwap(&other->_impl_.element_);
+  _impl_.event_.InternalSwap(&other->_impl_.event_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.state_, lhs_arena,
+      &other->_impl_.state_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(GameUpdate, _impl_.ack_)
+      + sizeof(GameUpdate::_impl_.ack_)
+      - PROTOBUF_FIELD_OFFSET(GameUpdate, _impl_.ping_)>(
+          reinterpret_cast<char*>(&_impl_.ping_),
+          reinterpret_cast<char*>(&other->_impl_.ping_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata GameUpdate::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_arkanoid_2eproto_getter, &descriptor_table_arkanoid_2eproto_once,
+      file_level_metadata_arkanoid_2eproto[14]);
 }
 
-
 // @@protoc_insertion_point(namespace_scope)
 PROTOBUF_NAMESPACE_OPEN
-template<> PROTOBUF_NOINLINE ::NetBall* Arena::CreateMaybeMessage< ::NetBall >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::NetBall*
+Arena::CreateMaybeMessage< ::NetBall >(Arena* arena) {
   return Arena::CreateMessageInternal< ::NetBall >(arena);
 }
-template<> PROTOBUF_NOINLINE ::NetPaddle* Arena::CreateMaybeMessage< ::NetPaddle >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::NetPaddle*
+Arena::CreateMaybeMessage< ::NetPaddle >(Arena* arena) {
   return Arena::CreateMessageInternal< ::NetPaddle >(arena);
 }
-template<> PROTOBUF_NOINLINE ::NetBrick* Arena::CreateMaybeMessage< ::NetBrick >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::NetBrick*
+Arena::CreateMaybeMessage< ::NetBrick >(Arena* arena) {
   return Arena::CreateMessageInternal< ::NetBrick >(arena);
 }
-template<> PROTOBUF_NOINLINE ::ElementPosition* Arena::CreateMaybeMessage< ::ElementPosition >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::ElementPosition*
+Arena::CreateMaybeMessage< ::ElementPosition >(Arena* arena) {
   return Arena::CreateMessageInternal< ::ElementPosition >(arena);
 }
-template<> PROTOBUF_NOINLINE ::GameElement* Arena::CreateMaybeMessage< ::GameElement >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::GameElement*
+Arena::CreateMaybeMessage< ::GameElement >(Arena* arena) {
   return Arena::CreateMessageInternal< ::GameElement >(arena);
 }
-template<> PROTOBUF_NOINLINE ::GameUpdate* Arena::CreateMaybeMessage< ::GameUpdate >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::Ping*
+Arena::CreateMaybeMessage< ::Ping >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Ping >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Pong*
+Arena::CreateMaybeMessage< ::Pong >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Pong >(arena);
+}
+template<> PROTOBUF_NOINLINE ::PlayerInput*
+Arena::CreateMaybeMessage< ::PlayerInput >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::PlayerInput >(arena);
+}
+template<> PROTOBUF_NOINLINE ::BrickHit*
+Arena::CreateMaybeMessage< ::BrickHit >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::BrickHit >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ScoreDelta*
+Arena::CreateMaybeMessage< ::ScoreDelta >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ScoreDelta >(arena);
+}
+template<> PROTOBUF_NOINLINE ::GameEvent*
+Arena::CreateMaybeMessage< ::GameEvent >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::GameEvent >(arena);
+}
+template<> PROTOBUF_NOINLINE ::LockstepInput*
+Arena::CreateMaybeMessage< ::LockstepInput >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::LockstepInput >(arena);
+}
+template<> PROTOBUF_NOINLINE ::LockstepStart*
+Arena::CreateMaybeMessage< ::LockstepStart >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::LockstepStart >(arena);
+}
+template<> PROTOBUF_NOINLINE ::StateHash*
+Arena::CreateMaybeMessage< ::StateHash >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::StateHash >(arena);
+}
+template<> PROTOBUF_NOINLINE ::GameUpdate*
+Arena::CreateMaybeMessage< ::GameUpdate >(Arena* arena) {
   return Arena::CreateMessageInternal< ::GameUpdate >(arena);
 }
 PROTOBUF_NAMESPACE_CLOSE
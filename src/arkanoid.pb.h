@@ -8,12 +8,12 @@
 #include <string>
 
 #include <google/protobuf/port_def.inc>
-#if PROTOBUF_VERSION < 3012000
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3012004 < PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
@@ -23,9 +23,7 @@
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
 #include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/inlined_string_field.h>
 #include <google/protobuf/metadata_lite.h>
 #include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/message.h>
@@ -43,51 +41,80 @@ PROTOBUF_NAMESPACE_CLOSE
 
 // Internal implementation detail -- do not use these members.
 struct TableStruct_arkanoid_2eproto {
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTableField entries[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::AuxillaryParseTableField aux[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[6]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
-  static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
-  static const ::PROTOBUF_NAMESPACE_ID::uint32 offsets[];
+  static const uint32_t offsets[];
 };
 extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_arkanoid_2eproto;
+class BrickHit;
+struct BrickHitDefaultTypeInternal;
+extern BrickHitDefaultTypeInternal _BrickHit_default_instance_;
 class ElementPosition;
-class ElementPositionDefaultTypeInternal;
+struct ElementPositionDefaultTypeInternal;
 extern ElementPositionDefaultTypeInternal _ElementPosition_default_instance_;
 class GameElement;
-class GameElementDefaultTypeInternal;
+struct GameElementDefaultTypeInternal;
 extern GameElementDefaultTypeInternal _GameElement_default_instance_;
+class GameEvent;
+struct GameEventDefaultTypeInternal;
+extern GameEventDefaultTypeInternal _GameEvent_default_instance_;
 class GameUpdate;
-class GameUpdateDefaultTypeInternal;
+struct GameUpdateDefaultTypeInternal;
 extern GameUpdateDefaultTypeInternal _GameUpdate_default_instance_;
+class LockstepInput;
+struct LockstepInputDefaultTypeInternal;
+extern LockstepInputDefaultTypeInternal _LockstepInput_default_instance_;
+class LockstepStart;
+struct LockstepStartDefaultTypeInternal;
+extern LockstepStartDefaultTypeInternal _LockstepStart_default_instance_;
 class NetBall;
-class NetBallDefaultTypeInternal;
+struct NetBallDefaultTypeInternal;
 extern NetBallDefaultTypeInternal _NetBall_default_instance_;
 class NetBrick;
-class NetBrickDefaultTypeInternal;
+struct NetBrickDefaultTypeInternal;
 extern NetBrickDefaultTypeInternal _NetBrick_default_instance_;
 class NetPaddle;
-class NetPaddleDefaultTypeInternal;
+struct NetPaddleDefaultTypeInternal;
 extern NetPaddleDefaultTypeInternal _NetPaddle_default_instance_;
+class Ping;
+struct PingDefaultTypeInternal;
+extern PingDefaultTypeInternal _Ping_default_instance_;
+class PlayerInput;
+struct PlayerInputDefaultTypeInternal;
+extern PlayerInputDefaultTypeInternal _PlayerInput_default_instance_;
+class Pong;
+struct PongDefaultTypeInternal;
+extern PongDefaultTypeInternal _Pong_default_instance_;
+class ScoreDelta;
+struct ScoreDeltaDefaultTypeInternal;
+extern ScoreDeltaDefaultTypeInternal _ScoreDelta_default_instance_;
+class StateHash;
+struct StateHashDefaultTypeInternal;
+extern StateHashDefaultTypeInternal _StateHash_default_instance_;
 PROTOBUF_NAMESPACE_OPEN
+template<> ::BrickHit* Arena::CreateMaybeMessage<::BrickHit>(Arena*);
 template<> ::ElementPosition* Arena::CreateMaybeMessage<::ElementPosition>(Arena*);
 template<> ::GameElement* Arena::CreateMaybeMessage<::GameElement>(Arena*);
+template<> ::GameEvent* Arena::CreateMaybeMessage<::GameEvent>(Arena*);
 template<> ::GameUpdate* Arena::CreateMaybeMessage<::GameUpdate>(Arena*);
+template<> ::LockstepInput* Arena::CreateMaybeMessage<::LockstepInput>(Arena*);
+template<> ::LockstepStart* Arena::CreateMaybeMessage<::LockstepStart>(Arena*);
 template<> ::NetBall* Arena::CreateMaybeMessage<::NetBall>(Arena*);
 template<> ::NetBrick* Arena::CreateMaybeMessage<::NetBrick>(Arena*);
 template<> ::NetPaddle* Arena::CreateMaybeMessage<::NetPaddle>(Arena*);
+template<> ::Ping* Arena::CreateMaybeMessage<::Ping>(Arena*);
+template<> ::PlayerInput* Arena::CreateMaybeMessage<::PlayerInput>(Arena*);
+template<> ::Pong* Arena::CreateMaybeMessage<::Pong>(Arena*);
+template<> ::ScoreDelta* Arena::CreateMaybeMessage<::ScoreDelta>(Arena*);
+template<> ::StateHash* Arena::CreateMaybeMessage<::StateHash>(Arena*);
 PROTOBUF_NAMESPACE_CLOSE
 
 // ===================================================================
 
-class NetBall PROTOBUF_FINAL :
+class NetBall final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:NetBall) */ {
  public:
-  inline NetBall() : NetBall(nullptr) {};
-  virtual ~NetBall();
+  inline NetBall() : NetBall(nullptr) {}
+  ~NetBall() override;
+  explicit PROTOBUF_CONSTEXPR NetBall(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   NetBall(const NetBall& from);
   NetBall(NetBall&& from) noexcept
@@ -100,8 +127,13 @@ class NetBall PROTOBUF_FINAL :
     return *this;
   }
   inline NetBall& operator=(NetBall&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -112,14 +144,14 @@ class NetBall PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const NetBall& default_instance() {
+    return *internal_default_instance();
   }
-  static const NetBall& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const NetBall* internal_default_instance() {
     return reinterpret_cast<const NetBall*>(
                &_NetBall_default_instance_);
@@ -132,7 +164,12 @@ class NetBall PROTOBUF_FINAL :
   }
   inline void Swap(NetBall* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -140,56 +177,53 @@ class NetBall PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(NetBall* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline NetBall* New() const final {
-    return CreateMaybeMessage<NetBall>(nullptr);
-  }
-
-  NetBall* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  NetBall* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<NetBall>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const NetBall& from);
-  void MergeFrom(const NetBall& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const NetBall& from) {
+    NetBall::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(NetBall* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "NetBall";
   }
   protected:
-  explicit NetBall(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit NetBall(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_arkanoid_2eproto);
-    return ::descriptor_table_arkanoid_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -224,18 +258,22 @@ class NetBall PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  float velocity_x_;
-  float velocity_y_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    float velocity_x_;
+    float velocity_y_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_arkanoid_2eproto;
 };
 // -------------------------------------------------------------------
 
-class NetPaddle PROTOBUF_FINAL :
+class NetPaddle final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:NetPaddle) */ {
  public:
-  inline NetPaddle() : NetPaddle(nullptr) {};
-  virtual ~NetPaddle();
+  inline NetPaddle() : NetPaddle(nullptr) {}
+  ~NetPaddle() override;
+  explicit PROTOBUF_CONSTEXPR NetPaddle(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   NetPaddle(const NetPaddle& from);
   NetPaddle(NetPaddle&& from) noexcept
@@ -248,8 +286,13 @@ class NetPaddle PROTOBUF_FINAL :
     return *this;
   }
   inline NetPaddle& operator=(NetPaddle&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -260,14 +303,14 @@ class NetPaddle PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const NetPaddle& default_instance() {
+    return *internal_default_instance();
   }
-  static const NetPaddle& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const NetPaddle* internal_default_instance() {
     return reinterpret_cast<const NetPaddle*>(
                &_NetPaddle_default_instance_);
@@ -280,7 +323,12 @@ class NetPaddle PROTOBUF_FINAL :
   }
   inline void Swap(NetPaddle* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -288,56 +336,53 @@ class NetPaddle PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(NetPaddle* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline NetPaddle* New() const final {
-    return CreateMaybeMessage<NetPaddle>(nullptr);
-  }
-
-  NetPaddle* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  NetPaddle* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<NetPaddle>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const NetPaddle& from);
-  void MergeFrom(const NetPaddle& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const NetPaddle& from) {
+    NetPaddle::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(NetPaddle* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "NetPaddle";
   }
   protected:
-  explicit NetPaddle(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit NetPaddle(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_arkanoid_2eproto);
-    return ::descriptor_table_arkanoid_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -349,11 +394,11 @@ class NetPaddle PROTOBUF_FINAL :
   };
   // int32 score = 1;
   void clear_score();
-  ::PROTOBUF_NAMESPACE_ID::int32 score() const;
-  void set_score(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t score() const;
+  void set_score(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_score() const;
-  void _internal_set_score(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_score() const;
+  void _internal_set_score(int32_t value);
   public:
 
   // bool controlled_by_sender = 2;
@@ -372,18 +417,22 @@ class NetPaddle PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::int32 score_;
-  bool controlled_by_sender_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    int32_t score_;
+    bool controlled_by_sender_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_arkanoid_2eproto;
 };
 // -------------------------------------------------------------------
 
-class NetBrick PROTOBUF_FINAL :
+class NetBrick final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:NetBrick) */ {
  public:
-  inline NetBrick() : NetBrick(nullptr) {};
-  virtual ~NetBrick();
+  inline NetBrick() : NetBrick(nullptr) {}
+  ~NetBrick() override;
+  explicit PROTOBUF_CONSTEXPR NetBrick(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   NetBrick(const NetBrick& from);
   NetBrick(NetBrick&& from) noexcept
@@ -396,8 +445,13 @@ class NetBrick PROTOBUF_FINAL :
     return *this;
   }
   inline NetBrick& operator=(NetBrick&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -408,14 +462,14 @@ class NetBrick PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const NetBrick& default_instance() {
+    return *internal_default_instance();
   }
-  static const NetBrick& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const NetBrick* internal_default_instance() {
     return reinterpret_cast<const NetBrick*>(
                &_NetBrick_default_instance_);
@@ -428,7 +482,12 @@ class NetBrick PROTOBUF_FINAL :
   }
   inline void Swap(NetBrick* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -436,56 +495,53 @@ class NetBrick PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(NetBrick* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline NetBrick* New() const final {
-    return CreateMaybeMessage<NetBrick>(nullptr);
-  }
-
-  NetBrick* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  NetBrick* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<NetBrick>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const NetBrick& from);
-  void MergeFrom(const NetBrick& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const NetBrick& from) {
+    NetBrick::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(NetBrick* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "NetBrick";
   }
   protected:
-  explicit NetBrick(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit NetBrick(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_arkanoid_2eproto);
-    return ::descriptor_table_arkanoid_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -496,11 +552,11 @@ class NetBrick PROTOBUF_FINAL :
   };
   // int32 duration = 1;
   void clear_duration();
-  ::PROTOBUF_NAMESPACE_ID::int32 duration() const;
-  void set_duration(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t duration() const;
+  void set_duration(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_duration() const;
-  void _internal_set_duration(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_duration() const;
+  void _internal_set_duration(int32_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:NetBrick)
@@ -510,17 +566,21 @@ class NetBrick PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::int32 duration_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    int32_t duration_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_arkanoid_2eproto;
 };
 // -------------------------------------------------------------------
 
-class ElementPosition PROTOBUF_FINAL :
+class ElementPosition final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ElementPosition) */ {
  public:
-  inline ElementPosition() : ElementPosition(nullptr) {};
-  virtual ~ElementPosition();
+  inline ElementPosition() : ElementPosition(nullptr) {}
+  ~ElementPosition() override;
+  explicit PROTOBUF_CONSTEXPR ElementPosition(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   ElementPosition(const ElementPosition& from);
   ElementPosition(ElementPosition&& from) noexcept
@@ -533,8 +593,13 @@ class ElementPosition PROTOBUF_FINAL :
     return *this;
   }
   inline ElementPosition& operator=(ElementPosition&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -545,14 +610,14 @@ class ElementPosition PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ElementPosition& default_instance() {
+    return *internal_default_instance();
   }
-  static const ElementPosition& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const ElementPosition* internal_default_instance() {
     return reinterpret_cast<const ElementPosition*>(
                &_ElementPosition_default_instance_);
@@ -565,7 +630,12 @@ class ElementPosition PROTOBUF_FINAL :
   }
   inline void Swap(ElementPosition* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -573,56 +643,53 @@ class ElementPosition PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(ElementPosition* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline ElementPosition* New() const final {
-    return CreateMaybeMessage<ElementPosition>(nullptr);
-  }
-
-  ElementPosition* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  ElementPosition* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<ElementPosition>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const ElementPosition& from);
-  void MergeFrom(const ElementPosition& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ElementPosition& from) {
+    ElementPosition::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(ElementPosition* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "ElementPosition";
   }
   protected:
-  explicit ElementPosition(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit ElementPosition(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_arkanoid_2eproto);
-    return ::descriptor_table_arkanoid_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -657,18 +724,22 @@ class ElementPosition PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  float x_;
-  float y_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    float x_;
+    float y_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_arkanoid_2eproto;
 };
 // -------------------------------------------------------------------
 
-class GameElement PROTOBUF_FINAL :
+class GameElement final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:GameElement) */ {
  public:
-  inline GameElement() : GameElement(nullptr) {};
-  virtual ~GameElement();
+  inline GameElement() : GameElement(nullptr) {}
+  ~GameElement() override;
+  explicit PROTOBUF_CONSTEXPR GameElement(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   GameElement(const GameElement& from);
   GameElement(GameElement&& from) noexcept
@@ -681,8 +752,13 @@ class GameElement PROTOBUF_FINAL :
     return *this;
   }
   inline GameElement& operator=(GameElement&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -693,13 +769,14 @@ class GameElement PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GameElement& default_instance() {
+    return *internal_default_instance();
   }
-  static const GameElement& default_instance();
-
   enum SpecificCase {
     kBall = 3,
     kPaddle = 4,
@@ -707,7 +784,6 @@ class GameElement PROTOBUF_FINAL :
     SPECIFIC_NOT_SET = 0,
   };
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const GameElement* internal_default_instance() {
     return reinterpret_cast<const GameElement*>(
                &_GameElement_default_instance_);
@@ -720,7 +796,12 @@ class GameElement PROTOBUF_FINAL :
   }
   inline void Swap(GameElement* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -728,68 +809,82 @@ class GameElement PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(GameElement* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline GameElement* New() const final {
-    return CreateMaybeMessage<GameElement>(nullptr);
-  }
-
-  GameElement* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  GameElement* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<GameElement>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const GameElement& from);
-  void MergeFrom(const GameElement& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GameElement& from) {
+    GameElement::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(GameElement* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "GameElement";
   }
   protected:
-  explicit GameElement(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit GameElement(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_arkanoid_2eproto);
-    return ::descriptor_table_arkanoid_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
   enum : int {
+    kPackedFieldNumber = 8,
     kElementPositionFieldNumber = 2,
     kIdFieldNumber = 1,
+    kBaselineAgeFieldNumber = 6,
+    kClearedFieldNumber = 7,
     kBallFieldNumber = 3,
     kPaddleFieldNumber = 4,
     kBrickFieldNumber = 5,
   };
+  // bytes packed = 8;
+  void clear_packed();
+  const std::string& packed() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_packed(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_packed();
+  PROTOBUF_NODISCARD std::string* release_packed();
+  void set_allocated_packed(std::string* packed);
+  private:
+  const std::string& _internal_packed() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_packed(const std::string& value);
+  std::string* _internal_mutable_packed();
+  public:
+
   // .ElementPosition element_position = 2;
   bool has_element_position() const;
   private:
@@ -797,7 +892,7 @@ class GameElement PROTOBUF_FINAL :
   public:
   void clear_element_position();
   const ::ElementPosition& element_position() const;
-  ::ElementPosition* release_element_position();
+  PROTOBUF_NODISCARD ::ElementPosition* release_element_position();
   ::ElementPosition* mutable_element_position();
   void set_allocated_element_position(::ElementPosition* element_position);
   private:
@@ -810,11 +905,29 @@ class GameElement PROTOBUF_FINAL :
 
   // int32 id = 1;
   void clear_id();
-  ::PROTOBUF_NAMESPACE_ID::int32 id() const;
-  void set_id(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t id() const;
+  void set_id(int32_t value);
+  private:
+  int32_t _internal_id() const;
+  void _internal_set_id(int32_t value);
+  public:
+
+  // uint32 baseline_age = 6;
+  void clear_baseline_age();
+  uint32_t baseline_age() const;
+  void set_baseline_age(uint32_t value);
+  private:
+  uint32_t _internal_baseline_age() const;
+  void _internal_set_baseline_age(uint32_t value);
+  public:
+
+  // uint32 cleared = 7;
+  void clear_cleared();
+  uint32_t cleared() const;
+  void set_cleared(uint32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_id() const;
-  void _internal_set_id(::PROTOBUF_NAMESPACE_ID::int32 value);
+  uint32_t _internal_cleared() const;
+  void _internal_set_cleared(uint32_t value);
   public:
 
   // .NetBall ball = 3;
@@ -824,7 +937,7 @@ class GameElement PROTOBUF_FINAL :
   public:
   void clear_ball();
   const ::NetBall& ball() const;
-  ::NetBall* release_ball();
+  PROTOBUF_NODISCARD ::NetBall* release_ball();
   ::NetBall* mutable_ball();
   void set_allocated_ball(::NetBall* ball);
   private:
@@ -842,7 +955,7 @@ class GameElement PROTOBUF_FINAL :
   public:
   void clear_paddle();
   const ::NetPaddle& paddle() const;
-  ::NetPaddle* release_paddle();
+  PROTOBUF_NODISCARD ::NetPaddle* release_paddle();
   ::NetPaddle* mutable_paddle();
   void set_allocated_paddle(::NetPaddle* paddle);
   private:
@@ -860,7 +973,7 @@ class GameElement PROTOBUF_FINAL :
   public:
   void clear_brick();
   const ::NetBrick& brick() const;
-  ::NetBrick* release_brick();
+  PROTOBUF_NODISCARD ::NetBrick* release_brick();
   ::NetBrick* mutable_brick();
   void set_allocated_brick(::NetBrick* brick);
   private:
@@ -886,40 +999,53 @@ class GameElement PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::ElementPosition* element_position_;
-  ::PROTOBUF_NAMESPACE_ID::int32 id_;
-  union SpecificUnion {
-    SpecificUnion() {}
-    ::NetBall* ball_;
-    ::NetPaddle* paddle_;
-    ::NetBrick* brick_;
-  } specific_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 _oneof_case_[1];
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr packed_;
+    ::ElementPosition* element_position_;
+    int32_t id_;
+    uint32_t baseline_age_;
+    uint32_t cleared_;
+    union SpecificUnion {
+      constexpr SpecificUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      ::NetBall* ball_;
+      ::NetPaddle* paddle_;
+      ::NetBrick* brick_;
+    } specific_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t _oneof_case_[1];
 
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_arkanoid_2eproto;
 };
 // -------------------------------------------------------------------
 
-class GameUpdate PROTOBUF_FINAL :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:GameUpdate) */ {
+class Ping final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Ping) */ {
  public:
-  inline GameUpdate() : GameUpdate(nullptr) {};
-  virtual ~GameUpdate();
+  inline Ping() : Ping(nullptr) {}
+  ~Ping() override;
+  explicit PROTOBUF_CONSTEXPR Ping(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  GameUpdate(const GameUpdate& from);
-  GameUpdate(GameUpdate&& from) noexcept
-    : GameUpdate() {
+  Ping(const Ping& from);
+  Ping(Ping&& from) noexcept
+    : Ping() {
     *this = ::std::move(from);
   }
 
-  inline GameUpdate& operator=(const GameUpdate& from) {
+  inline Ping& operator=(const Ping& from) {
     CopyFrom(from);
     return *this;
   }
-  inline GameUpdate& operator=(GameUpdate&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+  inline Ping& operator=(Ping&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -930,658 +1056,3729 @@ class GameUpdate PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
-  static const GameUpdate& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const GameUpdate* internal_default_instance() {
-    return reinterpret_cast<const GameUpdate*>(
-               &_GameUpdate_default_instance_);
+  static const Ping& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Ping* internal_default_instance() {
+    return reinterpret_cast<const Ping*>(
+               &_Ping_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     5;
 
-  friend void swap(GameUpdate& a, GameUpdate& b) {
+  friend void swap(Ping& a, Ping& b) {
     a.Swap(&b);
   }
-  inline void Swap(GameUpdate* other) {
+  inline void Swap(Ping* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(GameUpdate* other) {
+  void UnsafeArenaSwap(Ping* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline GameUpdate* New() const final {
-    return CreateMaybeMessage<GameUpdate>(nullptr);
+  Ping* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Ping>(arena);
   }
-
-  GameUpdate* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<GameUpdate>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Ping& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Ping& from) {
+    Ping::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const GameUpdate& from);
-  void MergeFrom(const GameUpdate& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(GameUpdate* other);
+  void InternalSwap(Ping* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "GameUpdate";
+    return "Ping";
   }
   protected:
-  explicit GameUpdate(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit Ping(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_arkanoid_2eproto);
-    return ::descriptor_table_arkanoid_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
   enum : int {
-    kElementFieldNumber = 1,
+    kSentAtFieldNumber = 1,
+    kTickFieldNumber = 2,
+    kTickStartedAtFieldNumber = 3,
   };
-  // repeated .GameElement element = 1;
-  int element_size() const;
+  // int64 sent_at = 1;
+  void clear_sent_at();
+  int64_t sent_at() const;
+  void set_sent_at(int64_t value);
   private:
-  int _internal_element_size() const;
+  int64_t _internal_sent_at() const;
+  void _internal_set_sent_at(int64_t value);
   public:
-  void clear_element();
-  ::GameElement* mutable_element(int index);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::GameElement >*
-      mutable_element();
+
+  // int64 tick = 2;
+  void clear_tick();
+  int64_t tick() const;
+  void set_tick(int64_t value);
   private:
-  const ::GameElement& _internal_element(int index) const;
-  ::GameElement* _internal_add_element();
+  int64_t _internal_tick() const;
+  void _internal_set_tick(int64_t value);
   public:
-  const ::GameElement& element(int index) const;
-  ::GameElement* add_element();
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::GameElement >&
-      element() const;
 
-  // @@protoc_insertion_point(class_scope:GameUpdate)
+  // int64 tick_started_at = 3;
+  void clear_tick_started_at();
+  int64_t tick_started_at() const;
+  void set_tick_started_at(int64_t value);
+  private:
+  int64_t _internal_tick_started_at() const;
+  void _internal_set_tick_started_at(int64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:Ping)
  private:
   class _Internal;
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::GameElement > element_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    int64_t sent_at_;
+    int64_t tick_;
+    int64_t tick_started_at_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_arkanoid_2eproto;
 };
-// ===================================================================
-
-
-// ===================================================================
+// -------------------------------------------------------------------
 
-#ifdef __GNUC__
-  #pragma GCC diagnostic push
-  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
-// NetBall
+class Pong final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Pong) */ {
+ public:
+  inline Pong() : Pong(nullptr) {}
+  ~Pong() override;
+  explicit PROTOBUF_CONSTEXPR Pong(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-// float velocity_x = 1;
-inline void NetBall::clear_velocity_x() {
-  velocity_x_ = 0;
-}
-inline float NetBall::_internal_velocity_x() const {
-  return velocity_x_;
-}
-inline float NetBall::velocity_x() const {
-  // @@protoc_insertion_point(field_get:NetBall.velocity_x)
-  return _internal_velocity_x();
-}
-inline void NetBall::_internal_set_velocity_x(float value) {
-  
-  velocity_x_ = value;
-}
-inline void NetBall::set_velocity_x(float value) {
-  _internal_set_velocity_x(value);
-  // @@protoc_insertion_point(field_set:NetBall.velocity_x)
-}
+  Pong(const Pong& from);
+  Pong(Pong&& from) noexcept
+    : Pong() {
+    *this = ::std::move(from);
+  }
 
-// float velocity_y = 2;
-inline void NetBall::clear_velocity_y() {
-  velocity_y_ = 0;
-}
-inline float NetBall::_internal_velocity_y() const {
-  return velocity_y_;
-}
-inline float NetBall::velocity_y() const {
-  // @@protoc_insertion_point(field_get:NetBall.velocity_y)
-  return _internal_velocity_y();
-}
-inline void NetBall::_internal_set_velocity_y(float value) {
-  
-  velocity_y_ = value;
-}
-inline void NetBall::set_velocity_y(float value) {
-  _internal_set_velocity_y(value);
-  // @@protoc_insertion_point(field_set:NetBall.velocity_y)
-}
+  inline Pong& operator=(const Pong& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Pong& operator=(Pong&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-// -------------------------------------------------------------------
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Pong& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Pong* internal_default_instance() {
+    return reinterpret_cast<const Pong*>(
+               &_Pong_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
 
-// NetPaddle
+  friend void swap(Pong& a, Pong& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Pong* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Pong* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
-// int32 score = 1;
-inline void NetPaddle::clear_score() {
-  score_ = 0;
-}
-inline ::PROTOBUF_NAMESPACE_ID::int32 NetPaddle::_internal_score() const {
-  return score_;
-}
-inline ::PROTOBUF_NAMESPACE_ID::int32 NetPaddle::score() const {
-  // @@protoc_insertion_point(field_get:NetPaddle.score)
-  return _internal_score();
-}
-inline void NetPaddle::_internal_set_score(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  
-  score_ = value;
-}
-inline void NetPaddle::set_score(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  _internal_set_score(value);
-  // @@protoc_insertion_point(field_set:NetPaddle.score)
-}
+  // implements Message ----------------------------------------------
 
-// bool controlled_by_sender = 2;
-inline void NetPaddle::clear_controlled_by_sender() {
-  controlled_by_sender_ = false;
-}
-inline bool NetPaddle::_internal_controlled_by_sender() const {
-  return controlled_by_sender_;
-}
-inline bool NetPaddle::controlled_by_sender() const {
-  // @@protoc_insertion_point(field_get:NetPaddle.controlled_by_sender)
-  return _internal_controlled_by_sender();
-}
-inline void NetPaddle::_internal_set_controlled_by_sender(bool value) {
-  
-  controlled_by_sender_ = value;
-}
-inline void NetPaddle::set_controlled_by_sender(bool value) {
-  _internal_set_controlled_by_sender(value);
-  // @@protoc_insertion_point(field_set:NetPaddle.controlled_by_sender)
-}
+  Pong* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Pong>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Pong& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Pong& from) {
+    Pong::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
 
-// -------------------------------------------------------------------
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-// NetBrick
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Pong* other);
 
-// int32 duration = 1;
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Pong";
+  }
+  protected:
+  explicit Pong(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPingSentAtFieldNumber = 1,
+    kPingReceivedAtFieldNumber = 2,
+    kSentAtFieldNumber = 3,
+  };
+  // int64 ping_sent_at = 1;
+  void clear_ping_sent_at();
+  int64_t ping_sent_at() const;
+  void set_ping_sent_at(int64_t value);
+  private:
+  int64_t _internal_ping_sent_at() const;
+  void _internal_set_ping_sent_at(int64_t value);
+  public:
+
+  // int64 ping_received_at = 2;
+  void clear_ping_received_at();
+  int64_t ping_received_at() const;
+  void set_ping_received_at(int64_t value);
+  private:
+  int64_t _internal_ping_received_at() const;
+  void _internal_set_ping_received_at(int64_t value);
+  public:
+
+  // int64 sent_at = 3;
+  void clear_sent_at();
+  int64_t sent_at() const;
+  void set_sent_at(int64_t value);
+  private:
+  int64_t _internal_sent_at() const;
+  void _internal_set_sent_at(int64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:Pong)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int64_t ping_sent_at_;
+    int64_t ping_received_at_;
+    int64_t sent_at_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_arkanoid_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PlayerInput final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:PlayerInput) */ {
+ public:
+  inline PlayerInput() : PlayerInput(nullptr) {}
+  ~PlayerInput() override;
+  explicit PROTOBUF_CONSTEXPR PlayerInput(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PlayerInput(const PlayerInput& from);
+  PlayerInput(PlayerInput&& from) noexcept
+    : PlayerInput() {
+    *this = ::std::move(from);
+  }
+
+  inline PlayerInput& operator=(const PlayerInput& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PlayerInput& operator=(PlayerInput&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PlayerInput& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PlayerInput* internal_default_instance() {
+    return reinterpret_cast<const PlayerInput*>(
+               &_PlayerInput_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  friend void swap(PlayerInput& a, PlayerInput& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PlayerInput* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PlayerInput* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PlayerInput* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PlayerInput>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PlayerInput& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PlayerInput& from) {
+    PlayerInput::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PlayerInput* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "PlayerInput";
+  }
+  protected:
+  explicit PlayerInput(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMouseXFieldNumber = 1,
+  };
+  // int32 mouse_x = 1;
+  void clear_mouse_x();
+  int32_t mouse_x() const;
+  void set_mouse_x(int32_t value);
+  private:
+  int32_t _internal_mouse_x() const;
+  void _internal_set_mouse_x(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:PlayerInput)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t mouse_x_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_arkanoid_2eproto;
+};
+// -------------------------------------------------------------------
+
+class BrickHit final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:BrickHit) */ {
+ public:
+  inline BrickHit() : BrickHit(nullptr) {}
+  ~BrickHit() override;
+  explicit PROTOBUF_CONSTEXPR BrickHit(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  BrickHit(const BrickHit& from);
+  BrickHit(BrickHit&& from) noexcept
+    : BrickHit() {
+    *this = ::std::move(from);
+  }
+
+  inline BrickHit& operator=(const BrickHit& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline BrickHit& operator=(BrickHit&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const BrickHit& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const BrickHit* internal_default_instance() {
+    return reinterpret_cast<const BrickHit*>(
+               &_BrickHit_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
+
+  friend void swap(BrickHit& a, BrickHit& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(BrickHit* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(BrickHit* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  BrickHit* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BrickHit>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const BrickHit& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BrickHit& from) {
+    BrickHit::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(BrickHit* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "BrickHit";
+  }
+  protected:
+  explicit BrickHit(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kIdFieldNumber = 1,
+    kPaddleIdFieldNumber = 2,
+    kDurationFieldNumber = 3,
+  };
+  // int32 id = 1;
+  void clear_id();
+  int32_t id() const;
+  void set_id(int32_t value);
+  private:
+  int32_t _internal_id() const;
+  void _internal_set_id(int32_t value);
+  public:
+
+  // int32 paddle_id = 2;
+  void clear_paddle_id();
+  int32_t paddle_id() const;
+  void set_paddle_id(int32_t value);
+  private:
+  int32_t _internal_paddle_id() const;
+  void _internal_set_paddle_id(int32_t value);
+  public:
+
+  // int32 duration = 3;
+  void clear_duration();
+  int32_t duration() const;
+  void set_duration(int32_t value);
+  private:
+  int32_t _internal_duration() const;
+  void _internal_set_duration(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:BrickHit)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t id_;
+    int32_t paddle_id_;
+    int32_t duration_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_arkanoid_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ScoreDelta final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ScoreDelta) */ {
+ public:
+  inline ScoreDelta() : ScoreDelta(nullptr) {}
+  ~ScoreDelta() override;
+  explicit PROTOBUF_CONSTEXPR ScoreDelta(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ScoreDelta(const ScoreDelta& from);
+  ScoreDelta(ScoreDelta&& from) noexcept
+    : ScoreDelta() {
+    *this = ::std::move(from);
+  }
+
+  inline ScoreDelta& operator=(const ScoreDelta& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ScoreDelta& operator=(ScoreDelta&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ScoreDelta& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ScoreDelta* internal_default_instance() {
+    return reinterpret_cast<const ScoreDelta*>(
+               &_ScoreDelta_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    9;
+
+  friend void swap(ScoreDelta& a, ScoreDelta& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ScoreDelta* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ScoreDelta* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ScoreDelta* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ScoreDelta>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ScoreDelta& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ScoreDelta& from) {
+    ScoreDelta::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ScoreDelta* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ScoreDelta";
+  }
+  protected:
+  explicit ScoreDelta(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPaddleIdFieldNumber = 1,
+    kDeltaFieldNumber = 2,
+  };
+  // int32 paddle_id = 1;
+  void clear_paddle_id();
+  int32_t paddle_id() const;
+  void set_paddle_id(int32_t value);
+  private:
+  int32_t _internal_paddle_id() const;
+  void _internal_set_paddle_id(int32_t value);
+  public:
+
+  // int32 delta = 2;
+  void clear_delta();
+  int32_t delta() const;
+  void set_delta(int32_t value);
+  private:
+  int32_t _internal_delta() const;
+  void _internal_set_delta(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:ScoreDelta)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t paddle_id_;
+    int32_t delta_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_arkanoid_2eproto;
+};
+// -------------------------------------------------------------------
+
+class GameEvent final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:GameEvent) */ {
+ public:
+  inline GameEvent() : GameEvent(nullptr) {}
+  ~GameEvent() override;
+  explicit PROTOBUF_CONSTEXPR GameEvent(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  GameEvent(const GameEvent& from);
+  GameEvent(GameEvent&& from) noexcept
+    : GameEvent() {
+    *this = ::std::move(from);
+  }
+
+  inline GameEvent& operator=(const GameEvent& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GameEvent& operator=(GameEvent&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GameEvent& default_instance() {
+    return *internal_default_instance();
+  }
+  enum EventCase {
+    kBrickHit = 2,
+    kScoreDelta = 3,
+    EVENT_NOT_SET = 0,
+  };
+
+  static inline const GameEvent* internal_default_instance() {
+    return reinterpret_cast<const GameEvent*>(
+               &_GameEvent_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    10;
+
+  friend void swap(GameEvent& a, GameEvent& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GameEvent* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GameEvent* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  GameEvent* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GameEvent>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const GameEvent& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GameEvent& from) {
+    GameEvent::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GameEvent* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "GameEvent";
+  }
+  protected:
+  explicit GameEvent(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kIdFieldNumber = 1,
+    kBrickHitFieldNumber = 2,
+    kScoreDeltaFieldNumber = 3,
+  };
+  // uint32 id = 1;
+  void clear_id();
+  uint32_t id() const;
+  void set_id(uint32_t value);
+  private:
+  uint32_t _internal_id() const;
+  void _internal_set_id(uint32_t value);
+  public:
+
+  // .BrickHit brick_hit = 2;
+  bool has_brick_hit() const;
+  private:
+  bool _internal_has_brick_hit() const;
+  public:
+  void clear_brick_hit();
+  const ::BrickHit& brick_hit() const;
+  PROTOBUF_NODISCARD ::BrickHit* release_brick_hit();
+  ::BrickHit* mutable_brick_hit();
+  void set_allocated_brick_hit(::BrickHit* brick_hit);
+  private:
+  const ::BrickHit& _internal_brick_hit() const;
+  ::BrickHit* _internal_mutable_brick_hit();
+  public:
+  void unsafe_arena_set_allocated_brick_hit(
+      ::BrickHit* brick_hit);
+  ::BrickHit* unsafe_arena_release_brick_hit();
+
+  // .ScoreDelta score_delta = 3;
+  bool has_score_delta() const;
+  private:
+  bool _internal_has_score_delta() const;
+  public:
+  void clear_score_delta();
+  const ::ScoreDelta& score_delta() const;
+  PROTOBUF_NODISCARD ::ScoreDelta* release_score_delta();
+  ::ScoreDelta* mutable_score_delta();
+  void set_allocated_score_delta(::ScoreDelta* score_delta);
+  private:
+  const ::ScoreDelta& _internal_score_delta() const;
+  ::ScoreDelta* _internal_mutable_score_delta();
+  public:
+  void unsafe_arena_set_allocated_score_delta(
+      ::ScoreDelta* score_delta);
+  ::ScoreDelta* unsafe_arena_release_score_delta();
+
+  void clear_event();
+  EventCase event_case() const;
+  // @@protoc_insertion_point(class_scope:GameEvent)
+ private:
+  class _Internal;
+  void set_has_brick_hit();
+  void set_has_score_delta();
+
+  inline bool has_event() const;
+  inline void clear_has_event();
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint32_t id_;
+    union EventUnion {
+      constexpr EventUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      ::BrickHit* brick_hit_;
+      ::ScoreDelta* score_delta_;
+    } event_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t _oneof_case_[1];
+
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_arkanoid_2eproto;
+};
+// -------------------------------------------------------------------
+
+class LockstepInput final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:LockstepInput) */ {
+ public:
+  inline LockstepInput() : LockstepInput(nullptr) {}
+  ~LockstepInput() override;
+  explicit PROTOBUF_CONSTEXPR LockstepInput(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  LockstepInput(const LockstepInput& from);
+  LockstepInput(LockstepInput&& from) noexcept
+    : LockstepInput() {
+    *this = ::std::move(from);
+  }
+
+  inline LockstepInput& operator=(const LockstepInput& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline LockstepInput& operator=(LockstepInput&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LockstepInput& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const LockstepInput* internal_default_instance() {
+    return reinterpret_cast<const LockstepInput*>(
+               &_LockstepInput_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    11;
+
+  friend void swap(LockstepInput& a, LockstepInput& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(LockstepInput* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LockstepInput* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  LockstepInput* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LockstepInput>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const LockstepInput& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LockstepInput& from) {
+    LockstepInput::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(LockstepInput* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "LockstepInput";
+  }
+  protected:
+  explicit LockstepInput(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMouseXFieldNumber = 2,
+    kFirstTickFieldNumber = 1,
+  };
+  // repeated sint32 mouse_x = 2;
+  int mouse_x_size() const;
+  private:
+  int _internal_mouse_x_size() const;
+  public:
+  void clear_mouse_x();
+  private:
+  int32_t _internal_mouse_x(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_mouse_x() const;
+  void _internal_add_mouse_x(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_mouse_x();
+  public:
+  int32_t mouse_x(int index) const;
+  void set_mouse_x(int index, int32_t value);
+  void add_mouse_x(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      mouse_x() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_mouse_x();
+
+  // int64 first_tick = 1;
+  void clear_first_tick();
+  int64_t first_tick() const;
+  void set_first_tick(int64_t value);
+  private:
+  int64_t _internal_first_tick() const;
+  void _internal_set_first_tick(int64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:LockstepInput)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > mouse_x_;
+    mutable std::atomic<int> _mouse_x_cached_byte_size_;
+    int64_t first_tick_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_arkanoid_2eproto;
+};
+// -------------------------------------------------------------------
+
+class LockstepStart final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:LockstepStart) */ {
+ public:
+  inline LockstepStart() : LockstepStart(nullptr) {}
+  ~LockstepStart() override;
+  explicit PROTOBUF_CONSTEXPR LockstepStart(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  LockstepStart(const LockstepStart& from);
+  LockstepStart(LockstepStart&& from) noexcept
+    : LockstepStart() {
+    *this = ::std::move(from);
+  }
+
+  inline LockstepStart& operator=(const LockstepStart& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline LockstepStart& operator=(LockstepStart&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LockstepStart& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const LockstepStart* internal_default_instance() {
+    return reinterpret_cast<const LockstepStart*>(
+               &_LockstepStart_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    12;
+
+  friend void swap(LockstepStart& a, LockstepStart& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(LockstepStart* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LockstepStart* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  LockstepStart* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LockstepStart>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const LockstepStart& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LockstepStart& from) {
+    LockstepStart::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(LockstepStart* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "LockstepStart";
+  }
+  protected:
+  explicit LockstepStart(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kBrickSeedFieldNumber = 1,
+  };
+  // uint32 brick_seed = 1;
+  void clear_brick_seed();
+  uint32_t brick_seed() const;
+  void set_brick_seed(uint32_t value);
+  private:
+  uint32_t _internal_brick_seed() const;
+  void _internal_set_brick_seed(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:LockstepStart)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint32_t brick_seed_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_arkanoid_2eproto;
+};
+// -------------------------------------------------------------------
+
+class StateHash final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:StateHash) */ {
+ public:
+  inline StateHash() : StateHash(nullptr) {}
+  ~StateHash() override;
+  explicit PROTOBUF_CONSTEXPR StateHash(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  StateHash(const StateHash& from);
+  StateHash(StateHash&& from) noexcept
+    : StateHash() {
+    *this = ::std::move(from);
+  }
+
+  inline StateHash& operator=(const StateHash& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline StateHash& operator=(StateHash&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const StateHash& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const StateHash* internal_default_instance() {
+    return reinterpret_cast<const StateHash*>(
+               &_StateHash_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    13;
+
+  friend void swap(StateHash& a, StateHash& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(StateHash* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(StateHash* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  StateHash* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<StateHash>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const StateHash& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const StateHash& from) {
+    StateHash::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(StateHash* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "StateHash";
+  }
+  protected:
+  explicit StateHash(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTickFieldNumber = 1,
+    kValueFieldNumber = 2,
+  };
+  // int64 tick = 1;
+  void clear_tick();
+  int64_t tick() const;
+  void set_tick(int64_t value);
+  private:
+  int64_t _internal_tick() const;
+  void _internal_set_tick(int64_t value);
+  public:
+
+  // fixed64 value = 2;
+  void clear_value();
+  uint64_t value() const;
+  void set_value(uint64_t value);
+  private:
+  uint64_t _internal_value() const;
+  void _internal_set_value(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:StateHash)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int64_t tick_;
+    uint64_t value_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_arkanoid_2eproto;
+};
+// -------------------------------------------------------------------
+
+class GameUpdate final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:GameUpdate) */ {
+ public:
+  inline GameUpdate() : GameUpdate(nullptr) {}
+  ~GameUpdate() override;
+  explicit PROTOBUF_CONSTEXPR GameUpdate(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  GameUpdate(const GameUpdate& from);
+  GameUpdate(GameUpdate&& from) noexcept
+    : GameUpdate() {
+    *this = ::std::move(from);
+  }
+
+  inline GameUpdate& operator=(const GameUpdate& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GameUpdate& operator=(GameUpdate&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GameUpdate& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GameUpdate* internal_default_instance() {
+    return reinterpret_cast<const GameUpdate*>(
+               &_GameUpdate_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    14;
+
+  friend void swap(GameUpdate& a, GameUpdate& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GameUpdate* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GameUpdate* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  GameUpdate* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GameUpdate>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const GameUpdate& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GameUpdate& from) {
+    GameUpdate::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GameUpdate* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "GameUpdate";
+  }
+  protected:
+  explicit GameUpdate(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kElementFieldNumber = 1,
+    kEventFieldNumber = 8,
+    kStateFieldNumber = 12,
+    kPingFieldNumber = 2,
+    kPongFieldNumber = 3,
+    kInputFieldNumber = 7,
+    kStateHashFieldNumber = 9,
+    kLockstepInputFieldNumber = 10,
+    kLockstepStartFieldNumber = 11,
+    kTickFieldNumber = 4,
+    kSequenceFieldNumber = 5,
+    kAckFieldNumber = 6,
+  };
+  // repeated .GameElement element = 1;
+  int element_size() const;
+  private:
+  int _internal_element_size() const;
+  public:
+  void clear_element();
+  ::GameElement* mutable_element(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::GameElement >*
+      mutable_element();
+  private:
+  const ::GameElement& _internal_element(int index) const;
+  ::GameElement* _internal_add_element();
+  public:
+  const ::GameElement& element(int index) const;
+  ::GameElement* add_element();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::GameElement >&
+      element() const;
+
+  // repeated .GameEvent event = 8;
+  int event_size() const;
+  private:
+  int _internal_event_size() const;
+  public:
+  void clear_event();
+  ::GameEvent* mutable_event(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::GameEvent >*
+      mutable_event();
+  private:
+  const ::GameEvent& _internal_event(int index) const;
+  ::GameEvent* _internal_add_event();
+  public:
+  const ::GameEvent& event(int index) const;
+  ::GameEvent* add_event();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::GameEvent >&
+      event() const;
+
+  // bytes state = 12;
+  void clear_state();
+  const std::string& state() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_state(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_state();
+  PROTOBUF_NODISCARD std::string* release_state();
+  void set_allocated_state(std::string* state);
+  private:
+  const std::string& _internal_state() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_state(const std::string& value);
+  std::string* _internal_mutable_state();
+  public:
+
+  // .Ping ping = 2;
+  bool has_ping() const;
+  private:
+  bool _internal_has_ping() const;
+  public:
+  void clear_ping();
+  const ::Ping& ping() const;
+  PROTOBUF_NODISCARD ::Ping* release_ping();
+  ::Ping* mutable_ping();
+  void set_allocated_ping(::Ping* ping);
+  private:
+  const ::Ping& _internal_ping() const;
+  ::Ping* _internal_mutable_ping();
+  public:
+  void unsafe_arena_set_allocated_ping(
+      ::Ping* ping);
+  ::Ping* unsafe_arena_release_ping();
+
+  // .Pong pong = 3;
+  bool has_pong() const;
+  private:
+  bool _internal_has_pong() const;
+  public:
+  void clear_pong();
+  const ::Pong& pong() const;
+  PROTOBUF_NODISCARD ::Pong* release_pong();
+  ::Pong* mutable_pong();
+  void set_allocated_pong(::Pong* pong);
+  private:
+  const ::Pong& _internal_pong() const;
+  ::Pong* _internal_mutable_pong();
+  public:
+  void unsafe_arena_set_allocated_pong(
+      ::Pong* pong);
+  ::Pong* unsafe_arena_release_pong();
+
+  // .PlayerInput input = 7;
+  bool has_input() const;
+  private:
+  bool _internal_has_input() const;
+  public:
+  void clear_input();
+  const ::PlayerInput& input() const;
+  PROTOBUF_NODISCARD ::PlayerInput* release_input();
+  ::PlayerInput* mutable_input();
+  void set_allocated_input(::PlayerInput* input);
+  private:
+  const ::PlayerInput& _internal_input() const;
+  ::PlayerInput* _internal_mutable_input();
+  public:
+  void unsafe_arena_set_allocated_input(
+      ::PlayerInput* input);
+  ::PlayerInput* unsafe_arena_release_input();
+
+  // .StateHash state_hash = 9;
+  bool has_state_hash() const;
+  private:
+  bool _internal_has_state_hash() const;
+  public:
+  void clear_state_hash();
+  const ::StateHash& state_hash() const;
+  PROTOBUF_NODISCARD ::StateHash* release_state_hash();
+  ::StateHash* mutable_state_hash();
+  void set_allocated_state_hash(::StateHash* state_hash);
+  private:
+  const ::StateHash& _internal_state_hash() const;
+  ::StateHash* _internal_mutable_state_hash();
+  public:
+  void unsafe_arena_set_allocated_state_hash(
+      ::StateHash* state_hash);
+  ::StateHash* unsafe_arena_release_state_hash();
+
+  // .LockstepInput lockstep_input = 10;
+  bool has_lockstep_input() const;
+  private:
+  bool _internal_has_lockstep_input() const;
+  public:
+  void clear_lockstep_input();
+  const ::LockstepInput& lockstep_input() const;
+  PROTOBUF_NODISCARD ::LockstepInput* release_lockstep_input();
+  ::LockstepInput* mutable_lockstep_input();
+  void set_allocated_lockstep_input(::LockstepInput* lockstep_input);
+  private:
+  const ::LockstepInput& _internal_lockstep_input() const;
+  ::LockstepInput* _internal_mutable_lockstep_input();
+  public:
+  void unsafe_arena_set_allocated_lockstep_input(
+      ::LockstepInput* lockstep_input);
+  ::LockstepInput* unsafe_arena_release_lockstep_input();
+
+  // .LockstepStart lockstep_start = 11;
+  bool has_lockstep_start() const;
+  private:
+  bool _internal_has_lockstep_start() const;
+  public:
+  void clear_lockstep_start();
+  const ::LockstepStart& lockstep_start() const;
+  PROTOBUF_NODISCARD ::LockstepStart* release_lockstep_start();
+  ::LockstepStart* mutable_lockstep_start();
+  void set_allocated_lockstep_start(::LockstepStart* lockstep_start);
+  private:
+  const ::LockstepStart& _internal_lockstep_start() const;
+  ::LockstepStart* _internal_mutable_lockstep_start();
+  public:
+  void unsafe_arena_set_allocated_lockstep_start(
+      ::LockstepStart* lockstep_start);
+  ::LockstepStart* unsafe_arena_release_lockstep_start();
+
+  // int64 tick = 4;
+  void clear_tick();
+  int64_t tick() const;
+  void set_tick(int64_t value);
+  private:
+  int64_t _internal_tick() const;
+  void _internal_set_tick(int64_t value);
+  public:
+
+  // uint32 sequence = 5;
+  void clear_sequence();
+  uint32_t sequence() const;
+  void set_sequence(uint32_t value);
+  private:
+  uint32_t _internal_sequence() const;
+  void _internal_set_sequence(uint32_t value);
+  public:
+
+  // uint32 ack = 6;
+  void clear_ack();
+  uint32_t ack() const;
+  void set_ack(uint32_t value);
+  private:
+  uint32_t _internal_ack() const;
+  void _internal_set_ack(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:GameUpdate)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::GameElement > element_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::GameEvent > event_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr state_;
+    ::Ping* ping_;
+    ::Pong* pong_;
+    ::PlayerInput* input_;
+    ::StateHash* state_hash_;
+    ::LockstepInput* lockstep_input_;
+    ::LockstepStart* lockstep_start_;
+    int64_t tick_;
+    uint32_t sequence_;
+    uint32_t ack_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_arkanoid_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// NetBall
+
+// float velocity_x = 1;
+inline void NetBall::clear_velocity_x() {
+  _impl_.velocity_x_ = 0;
+}
+inline float NetBall::_internal_velocity_x() const {
+  return _impl_.velocity_x_;
+}
+inline float NetBall::velocity_x() const {
+  // @@protoc_insertion_point(field_get:NetBall.velocity_x)
+  return _internal_velocity_x();
+}
+inline void NetBall::_internal_set_velocity_x(float value) {
+  
+  _impl_.velocity_x_ = value;
+}
+inline void NetBall::set_velocity_x(float value) {
+  _internal_set_velocity_x(value);
+  // @@protoc_insertion_point(field_set:NetBall.velocity_x)
+}
+
+// float velocity_y = 2;
+inline void NetBall::clear_velocity_y() {
+  _impl_.velocity_y_ = 0;
+}
+inline float NetBall::_internal_velocity_y() const {
+  return _impl_.velocity_y_;
+}
+inline float NetBall::velocity_y() const {
+  // @@protoc_insertion_point(field_get:NetBall.velocity_y)
+  return _internal_velocity_y();
+}
+inline void NetBall::_internal_set_velocity_y(float value) {
+  
+  _impl_.velocity_y_ = value;
+}
+inline void NetBall::set_velocity_y(float value) {
+  _internal_set_velocity_y(value);
+  // @@protoc_insertion_point(field_set:NetBall.velocity_y)
+}
+
+// -------------------------------------------------------------------
+
+// NetPaddle
+
+// int32 score = 1;
+inline void NetPaddle::clear_score() {
+  _impl_.score_ = 0;
+}
+inline int32_t NetPaddle::_internal_score() const {
+  return _impl_.score_;
+}
+inline int32_t NetPaddle::score() const {
+  // @@protoc_insertion_point(field_get:NetPaddle.score)
+  return _internal_score();
+}
+inline void NetPaddle::_internal_set_score(int32_t value) {
+  
+  _impl_.score_ = value;
+}
+inline void NetPaddle::set_score(int32_t value) {
+  _internal_set_score(value);
+  // @@protoc_insertion_point(field_set:NetPaddle.score)
+}
+
+// bool controlled_by_sender = 2;
+inline void NetPaddle::clear_controlled_by_sender() {
+  _impl_.controlled_by_sender_ = false;
+}
+inline bool NetPaddle::_internal_controlled_by_sender() const {
+  return _impl_.controlled_by_sender_;
+}
+inline bool NetPaddle::controlled_by_sender() const {
+  // @@protoc_insertion_point(field_get:NetPaddle.controlled_by_sender)
+  return _internal_controlled_by_sender();
+}
+inline void NetPaddle::_internal_set_controlled_by_sender(bool value) {
+  
+  _impl_.controlled_by_sender_ = value;
+}
+inline void NetPaddle::set_controlled_by_sender(bool value) {
+  _internal_set_controlled_by_sender(value);
+  // @@protoc_insertion_point(field_set:NetPaddle.controlled_by_sender)
+}
+
+// -------------------------------------------------------------------
+
+// NetBrick
+
+// int32 duration = 1;
 inline void NetBrick::clear_duration() {
-  duration_ = 0;
+  _impl_.duration_ = 0;
+}
+inline int32_t NetBrick::_internal_duration() const {
+  return _impl_.duration_;
+}
+inline int32_t NetBrick::duration() const {
+  // @@protoc_insertion_point(field_get:NetBrick.duration)
+  return _internal_duration();
+}
+inline void NetBrick::_internal_set_duration(int32_t value) {
+  
+  _impl_.duration_ = value;
+}
+inline void NetBrick::set_duration(int32_t value) {
+  _internal_set_duration(value);
+  // @@protoc_insertion_point(field_set:NetBrick.duration)
+}
+
+// -------------------------------------------------------------------
+
+// ElementPosition
+
+// float x = 1;
+inline void ElementPosition::clear_x() {
+  _impl_.x_ = 0;
+}
+inline float ElementPosition::_internal_x() const {
+  return _impl_.x_;
+}
+inline float ElementPosition::x() const {
+  // @@protoc_insertion_point(field_get:ElementPosition.x)
+  return _internal_x();
+}
+inline void ElementPosition::_internal_set_x(float value) {
+  
+  _impl_.x_ = value;
+}
+inline void ElementPosition::set_x(float value) {
+  _internal_set_x(value);
+  // @@protoc_insertion_point(field_set:ElementPosition.x)
+}
+
+// float y = 2;
+inline void ElementPosition::clear_y() {
+  _impl_.y_ = 0;
+}
+inline float ElementPosition::_internal_y() const {
+  return _impl_.y_;
+}
+inline float ElementPosition::y() const {
+  // @@protoc_insertion_point(field_get:ElementPosition.y)
+  return _internal_y();
+}
+inline void ElementPosition::_internal_set_y(float value) {
+  
+  _impl_.y_ = value;
+}
+inline void ElementPosition::set_y(float value) {
+  _internal_set_y(value);
+  // @@protoc_insertion_point(field_set:ElementPosition.y)
+}
+
+// -------------------------------------------------------------------
+
+// GameElement
+
+// int32 id = 1;
+inline void GameElement::clear_id() {
+  _impl_.id_ = 0;
+}
+inline int32_t GameElement::_internal_id() const {
+  return _impl_.id_;
+}
+inline int32_t GameElement::id() const {
+  // @@protoc_insertion_point(field_get:GameElement.id)
+  return _internal_id();
+}
+inline void GameElement::_internal_set_id(int32_t value) {
+  
+  _impl_.id_ = value;
+}
+inline void GameElement::set_id(int32_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:GameElement.id)
+}
+
+// .ElementPosition element_position = 2;
+inline bool GameElement::_internal_has_element_position() const {
+  return this != internal_default_instance() && _impl_.element_position_ != nullptr;
+}
+inline bool GameElement::has_element_position() const {
+  return _internal_has_element_position();
+}
+inline void GameElement::clear_element_position() {
+  if (GetArenaForAllocation() == nullptr && _impl_.element_position_ != nullptr) {
+    delete _impl_.element_position_;
+  }
+  _impl_.element_position_ = nullptr;
+}
+inline const ::ElementPosition& GameElement::_internal_element_position() const {
+  const ::ElementPosition* p = _impl_.element_position_;
+  return p != nullptr ? *p : reinterpret_cast<const ::ElementPosition&>(
+      ::_ElementPosition_default_instance_);
+}
+inline const ::ElementPosition& GameElement::element_position() const {
+  // @@protoc_insertion_point(field_get:GameElement.element_position)
+  return _internal_element_position();
+}
+inline void GameElement::unsafe_arena_set_allocated_element_position(
+    ::ElementPosition* element_position) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.element_position_);
+  }
+  _impl_.element_position_ = element_position;
+  if (element_position) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:GameElement.element_position)
+}
+inline ::ElementPosition* GameElement::release_element_position() {
+  
+  ::ElementPosition* temp = _impl_.element_position_;
+  _impl_.element_position_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::ElementPosition* GameElement::unsafe_arena_release_element_position() {
+  // @@protoc_insertion_point(field_release:GameElement.element_position)
+  
+  ::ElementPosition* temp = _impl_.element_position_;
+  _impl_.element_position_ = nullptr;
+  return temp;
+}
+inline ::ElementPosition* GameElement::_internal_mutable_element_position() {
+  
+  if (_impl_.element_position_ == nullptr) {
+    auto* p = CreateMaybeMessage<::ElementPosition>(GetArenaForAllocation());
+    _impl_.element_position_ = p;
+  }
+  return _impl_.element_position_;
+}
+inline ::ElementPosition* GameElement::mutable_element_position() {
+  ::ElementPosition* _msg = _internal_mutable_element_position();
+  // @@protoc_insertion_point(field_mutable:GameElement.element_position)
+  return _msg;
+}
+inline void GameElement::set_allocated_element_position(::ElementPosition* element_position) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.element_position_;
+  }
+  if (element_position) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(element_position);
+    if (message_arena != submessage_arena) {
+      element_position = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, element_position, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.element_position_ = element_position;
+  // @@protoc_insertion_point(field_set_allocated:GameElement.element_position)
+}
+
+// .NetBall ball = 3;
+inline bool GameElement::_internal_has_ball() const {
+  return specific_case() == kBall;
+}
+inline bool GameElement::has_ball() const {
+  return _internal_has_ball();
+}
+inline void GameElement::set_has_ball() {
+  _impl_._oneof_case_[0] = kBall;
+}
+inline void GameElement::clear_ball() {
+  if (_internal_has_ball()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.specific_.ball_;
+    }
+    clear_has_specific();
+  }
+}
+inline ::NetBall* GameElement::release_ball() {
+  // @@protoc_insertion_point(field_release:GameElement.ball)
+  if (_internal_has_ball()) {
+    clear_has_specific();
+    ::NetBall* temp = _impl_.specific_.ball_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.specific_.ball_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::NetBall& GameElement::_internal_ball() const {
+  return _internal_has_ball()
+      ? *_impl_.specific_.ball_
+      : reinterpret_cast< ::NetBall&>(::_NetBall_default_instance_);
+}
+inline const ::NetBall& GameElement::ball() const {
+  // @@protoc_insertion_point(field_get:GameElement.ball)
+  return _internal_ball();
+}
+inline ::NetBall* GameElement::unsafe_arena_release_ball() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:GameElement.ball)
+  if (_internal_has_ball()) {
+    clear_has_specific();
+    ::NetBall* temp = _impl_.specific_.ball_;
+    _impl_.specific_.ball_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void GameElement::unsafe_arena_set_allocated_ball(::NetBall* ball) {
+  clear_specific();
+  if (ball) {
+    set_has_ball();
+    _impl_.specific_.ball_ = ball;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:GameElement.ball)
+}
+inline ::NetBall* GameElement::_internal_mutable_ball() {
+  if (!_internal_has_ball()) {
+    clear_specific();
+    set_has_ball();
+    _impl_.specific_.ball_ = CreateMaybeMessage< ::NetBall >(GetArenaForAllocation());
+  }
+  return _impl_.specific_.ball_;
+}
+inline ::NetBall* GameElement::mutable_ball() {
+  ::NetBall* _msg = _internal_mutable_ball();
+  // @@protoc_insertion_point(field_mutable:GameElement.ball)
+  return _msg;
+}
+
+// .NetPaddle paddle = 4;
+inline bool GameElement::_internal_has_paddle() const {
+  return specific_case() == kPaddle;
+}
+inline bool GameElement::has_paddle() const {
+  return _internal_has_paddle();
+}
+inline void GameElement::set_has_paddle() {
+  _impl_._oneof_case_[0] = kPaddle;
+}
+inline void GameElement::clear_paddle() {
+  if (_internal_has_paddle()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.specific_.paddle_;
+    }
+    clear_has_specific();
+  }
+}
+inline ::NetPaddle* GameElement::release_paddle() {
+  // @@protoc_insertion_point(field_release:GameElement.paddle)
+  if (_internal_has_paddle()) {
+    clear_has_specific();
+    ::NetPaddle* temp = _impl_.specific_.paddle_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.specific_.paddle_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::NetPaddle& GameElement::_internal_paddle() const {
+  return _internal_has_paddle()
+      ? *_impl_.specific_.paddle_
+      : reinterpret_cast< ::NetPaddle&>(::_NetPaddle_default_instance_);
+}
+inline const ::NetPaddle& GameElement::paddle() const {
+  // @@protoc_insertion_point(field_get:GameElement.paddle)
+  return _internal_paddle();
+}
+inline ::NetPaddle* GameElement::unsafe_arena_release_paddle() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:GameElement.paddle)
+  if (_internal_has_paddle()) {
+    clear_has_specific();
+    ::NetPaddle* temp = _impl_.specific_.paddle_;
+    _impl_.specific_.paddle_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void GameElement::unsafe_arena_set_allocated_paddle(::NetPaddle* paddle) {
+  clear_specific();
+  if (paddle) {
+    set_has_paddle();
+    _impl_.specific_.paddle_ = paddle;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:GameElement.paddle)
+}
+inline ::NetPaddle* GameElement::_internal_mutable_paddle() {
+  if (!_internal_has_paddle()) {
+    clear_specific();
+    set_has_paddle();
+    _impl_.specific_.paddle_ = CreateMaybeMessage< ::NetPaddle >(GetArenaForAllocation());
+  }
+  return _impl_.specific_.paddle_;
+}
+inline ::NetPaddle* GameElement::mutable_paddle() {
+  ::NetPaddle* _msg = _internal_mutable_paddle();
+  // @@protoc_insertion_point(field_mutable:GameElement.paddle)
+  return _msg;
+}
+
+// .NetBrick brick = 5;
+inline bool GameElement::_internal_has_brick() const {
+  return specific_case() == kBrick;
+}
+inline bool GameElement::has_brick() const {
+  return _internal_has_brick();
+}
+inline void GameElement::set_has_brick() {
+  _impl_._oneof_case_[0] = kBrick;
+}
+inline void GameElement::clear_brick() {
+  if (_internal_has_brick()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.specific_.brick_;
+    }
+    clear_has_specific();
+  }
+}
+inline ::NetBrick* GameElement::release_brick() {
+  // @@protoc_insertion_point(field_release:GameElement.brick)
+  if (_internal_has_brick()) {
+    clear_has_specific();
+    ::NetBrick* temp = _impl_.specific_.brick_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.specific_.brick_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::NetBrick& GameElement::_internal_brick() const {
+  return _internal_has_brick()
+      ? *_impl_.specific_.brick_
+      : reinterpret_cast< ::NetBrick&>(::_NetBrick_default_instance_);
+}
+inline const ::NetBrick& GameElement::brick() const {
+  // @@protoc_insertion_point(field_get:GameElement.brick)
+  return _internal_brick();
+}
+inline ::NetBrick* GameElement::unsafe_arena_release_brick() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:GameElement.brick)
+  if (_internal_has_brick()) {
+    clear_has_specific();
+    ::NetBrick* temp = _impl_.specific_.brick_;
+    _impl_.specific_.brick_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void GameElement::unsafe_arena_set_allocated_brick(::NetBrick* brick) {
+  clear_specific();
+  if (brick) {
+    set_has_brick();
+    _impl_.specific_.brick_ = brick;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:GameElement.brick)
+}
+inline ::NetBrick* GameElement::_internal_mutable_brick() {
+  if (!_internal_has_brick()) {
+    clear_specific();
+    set_has_brick();
+    _impl_.specific_.brick_ = CreateMaybeMessage< ::NetBrick >(GetArenaForAllocation());
+  }
+  return _impl_.specific_.brick_;
+}
+inline ::NetBrick* GameElement::mutable_brick() {
+  ::NetBrick* _msg = _internal_mutable_brick();
+  // @@protoc_insertion_point(field_mutable:GameElement.brick)
+  return _msg;
+}
+
+// uint32 baseline_age = 6;
+inline void GameElement::clear_baseline_age() {
+  _impl_.baseline_age_ = 0u;
+}
+inline uint32_t GameElement::_internal_baseline_age() const {
+  return _impl_.baseline_age_;
+}
+inline uint32_t GameElement::baseline_age() const {
+  // @@protoc_insertion_point(field_get:GameElement.baseline_age)
+  return _internal_baseline_age();
+}
+inline void GameElement::_internal_set_baseline_age(uint32_t value) {
+  
+  _impl_.baseline_age_ = value;
+}
+inline void GameElement::set_baseline_age(uint32_t value) {
+  _internal_set_baseline_age(value);
+  // @@protoc_insertion_point(field_set:GameElement.baseline_age)
+}
+
+// uint32 cleared = 7;
+inline void GameElement::clear_cleared() {
+  _impl_.cleared_ = 0u;
+}
+inline uint32_t GameElement::_internal_cleared() const {
+  return _impl_.cleared_;
+}
+inline uint32_t GameElement::cleared() const {
+  // @@protoc_insertion_point(field_get:GameElement.cleared)
+  return _internal_cleared();
+}
+inline void GameElement::_internal_set_cleared(uint32_t value) {
+  
+  _impl_.cleared_ = value;
+}
+inline void GameElement::set_cleared(uint32_t value) {
+  _internal_set_cleared(value);
+  // @@protoc_insertion_point(field_set:GameElement.cleared)
+}
+
+// bytes packed = 8;
+inline void GameElement::clear_packed() {
+  _impl_.packed_.ClearToEmpty();
+}
+inline const std::string& GameElement::packed() const {
+  // @@protoc_insertion_point(field_get:GameElement.packed)
+  return _internal_packed();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GameElement::set_packed(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.packed_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:GameElement.packed)
+}
+inline std::string* GameElement::mutable_packed() {
+  std::string* _s = _internal_mutable_packed();
+  // @@protoc_insertion_point(field_mutable:GameElement.packed)
+  return _s;
+}
+inline const std::string& GameElement::_internal_packed() const {
+  return _impl_.packed_.Get();
+}
+inline void GameElement::_internal_set_packed(const std::string& value) {
+  
+  _impl_.packed_.Set(value, GetArenaForAllocation());
+}
+inline std::string* GameElement::_internal_mutable_packed() {
+  
+  return _impl_.packed_.Mutable(GetArenaForAllocation());
+}
+inline std::string* GameElement::release_packed() {
+  // @@protoc_insertion_point(field_release:GameElement.packed)
+  return _impl_.packed_.Release();
+}
+inline void GameElement::set_allocated_packed(std::string* packed) {
+  if (packed != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.packed_.SetAllocated(packed, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.packed_.IsDefault()) {
+    _impl_.packed_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:GameElement.packed)
+}
+
+inline bool GameElement::has_specific() const {
+  return specific_case() != SPECIFIC_NOT_SET;
+}
+inline void GameElement::clear_has_specific() {
+  _impl_._oneof_case_[0] = SPECIFIC_NOT_SET;
+}
+inline GameElement::SpecificCase GameElement::specific_case() const {
+  return GameElement::SpecificCase(_impl_._oneof_case_[0]);
+}
+// -------------------------------------------------------------------
+
+// Ping
+
+// int64 sent_at = 1;
+inline void Ping::clear_sent_at() {
+  _impl_.sent_at_ = int64_t{0};
+}
+inline int64_t Ping::_internal_sent_at() const {
+  return _impl_.sent_at_;
+}
+inline int64_t Ping::sent_at() const {
+  // @@protoc_insertion_point(field_get:Ping.sent_at)
+  return _internal_sent_at();
+}
+inline void Ping::_internal_set_sent_at(int64_t value) {
+  
+  _impl_.sent_at_ = value;
+}
+inline void Ping::set_sent_at(int64_t value) {
+  _internal_set_sent_at(value);
+  // @@protoc_insertion_point(field_set:Ping.sent_at)
+}
+
+// int64 tick = 2;
+inline void Ping::clear_tick() {
+  _impl_.tick_ = int64_t{0};
+}
+inline int64_t Ping::_internal_tick() const {
+  return _impl_.tick_;
+}
+inline int64_t Ping::tick() const {
+  // @@protoc_insertion_point(field_get:Ping.tick)
+  return _internal_tick();
+}
+inline void Ping::_internal_set_tick(int64_t value) {
+  
+  _impl_.tick_ = value;
+}
+inline void Ping::set_tick(int64_t value) {
+  _internal_set_tick(value);
+  // @@protoc_insertion_point(field_set:Ping.tick)
+}
+
+// int64 tick_started_at = 3;
+inline void Ping::clear_tick_started_at() {
+  _impl_.tick_started_at_ = int64_t{0};
+}
+inline int64_t Ping::_internal_tick_started_at() const {
+  return _impl_.tick_started_at_;
+}
+inline int64_t Ping::tick_started_at() const {
+  // @@protoc_insertion_point(field_get:Ping.tick_started_at)
+  return _internal_tick_started_at();
+}
+inline void Ping::_internal_set_tick_started_at(int64_t value) {
+  
+  _impl_.tick_started_at_ = value;
+}
+inline void Ping::set_tick_started_at(int64_t value) {
+  _internal_set_tick_started_at(value);
+  // @@protoc_insertion_point(field_set:Ping.tick_started_at)
+}
+
+// -------------------------------------------------------------------
+
+// Pong
+
+// int64 ping_sent_at = 1;
+inline void Pong::clear_ping_sent_at() {
+  _impl_.ping_sent_at_ = int64_t{0};
+}
+inline int64_t Pong::_internal_ping_sent_at() const {
+  return _impl_.ping_sent_at_;
+}
+inline int64_t Pong::ping_sent_at() const {
+  // @@protoc_insertion_point(field_get:Pong.ping_sent_at)
+  return _internal_ping_sent_at();
+}
+inline void Pong::_internal_set_ping_sent_at(int64_t value) {
+  
+  _impl_.ping_sent_at_ = value;
+}
+inline void Pong::set_ping_sent_at(int64_t value) {
+  _internal_set_ping_sent_at(value);
+  // @@protoc_insertion_point(field_set:Pong.ping_sent_at)
+}
+
+// int64 ping_received_at = 2;
+inline void Pong::clear_ping_received_at() {
+  _impl_.ping_received_at_ = int64_t{0};
+}
+inline int64_t Pong::_internal_ping_received_at() const {
+  return _impl_.ping_received_at_;
+}
+inline int64_t Pong::ping_received_at() const {
+  // @@protoc_insertion_point(field_get:Pong.ping_received_at)
+  return _internal_ping_received_at();
+}
+inline void Pong::_internal_set_ping_received_at(int64_t value) {
+  
+  _impl_.ping_received_at_ = value;
+}
+inline void Pong::set_ping_received_at(int64_t value) {
+  _internal_set_ping_received_at(value);
+  // @@protoc_insertion_point(field_set:Pong.ping_received_at)
+}
+
+// int64 sent_at = 3;
+inline void Pong::clear_sent_at() {
+  _impl_.sent_at_ = int64_t{0};
+}
+inline int64_t Pong::_internal_sent_at() const {
+  return _impl_.sent_at_;
+}
+inline int64_t Pong::sent_at() const {
+  // @@protoc_insertion_point(field_get:Pong.sent_at)
+  return _internal_sent_at();
+}
+inline void Pong::_internal_set_sent_at(int64_t value) {
+  
+  _impl_.sent_at_ = value;
+}
+inline void Pong::set_sent_at(int64_t value) {
+  _internal_set_sent_at(value);
+  // @@protoc_insertion_point(field_set:Pong.sent_at)
+}
+
+// -------------------------------------------------------------------
+
+// PlayerInput
+
+// int32 mouse_x = 1;
+inline void PlayerInput::clear_mouse_x() {
+  _impl_.mouse_x_ = 0;
+}
+inline int32_t PlayerInput::_internal_mouse_x() const {
+  return _impl_.mouse_x_;
+}
+inline int32_t PlayerInput::mouse_x() const {
+  // @@protoc_insertion_point(field_get:PlayerInput.mouse_x)
+  return _internal_mouse_x();
+}
+inline void PlayerInput::_internal_set_mouse_x(int32_t value) {
+  
+  _impl_.mouse_x_ = value;
+}
+inline void PlayerInput::set_mouse_x(int32_t value) {
+  _internal_set_mouse_x(value);
+  // @@protoc_insertion_point(field_set:PlayerInput.mouse_x)
+}
+
+// -------------------------------------------------------------------
+
+// BrickHit
+
+// int32 id = 1;
+inline void BrickHit::clear_id() {
+  _impl_.id_ = 0;
+}
+inline int32_t BrickHit::_internal_id() const {
+  return _impl_.id_;
+}
+inline int32_t BrickHit::id() const {
+  // @@protoc_insertion_point(field_get:BrickHit.id)
+  return _internal_id();
+}
+inline void BrickHit::_internal_set_id(int32_t value) {
+  
+  _impl_.id_ = value;
+}
+inline void BrickHit::set_id(int32_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:BrickHit.id)
+}
+
+// int32 paddle_id = 2;
+inline void BrickHit::clear_paddle_id() {
+  _impl_.paddle_id_ = 0;
+}
+inline int32_t BrickHit::_internal_paddle_id() const {
+  return _impl_.paddle_id_;
+}
+inline int32_t BrickHit::paddle_id() const {
+  // @@protoc_insertion_point(field_get:BrickHit.paddle_id)
+  return _internal_paddle_id();
+}
+inline void BrickHit::_internal_set_paddle_id(int32_t value) {
+  
+  _impl_.paddle_id_ = value;
+}
+inline void BrickHit::set_paddle_id(int32_t value) {
+  _internal_set_paddle_id(value);
+  // @@protoc_insertion_point(field_set:BrickHit.paddle_id)
+}
+
+// int32 duration = 3;
+inline void BrickHit::clear_duration() {
+  _impl_.duration_ = 0;
+}
+inline int32_t BrickHit::_internal_duration() const {
+  return _impl_.duration_;
+}
+inline int32_t BrickHit::duration() const {
+  // @@protoc_insertion_point(field_get:BrickHit.duration)
+  return _internal_duration();
+}
+inline void BrickHit::_internal_set_duration(int32_t value) {
+  
+  _impl_.duration_ = value;
+}
+inline void BrickHit::set_duration(int32_t value) {
+  _internal_set_duration(value);
+  // @@protoc_insertion_point(field_set:BrickHit.duration)
+}
+
+// -------------------------------------------------------------------
+
+// ScoreDelta
+
+// int32 paddle_id = 1;
+inline void ScoreDelta::clear_paddle_id() {
+  _impl_.paddle_id_ = 0;
+}
+inline int32_t ScoreDelta::_internal_paddle_id() const {
+  return _impl_.paddle_id_;
+}
+inline int32_t ScoreDelta::paddle_id() const {
+  // @@protoc_insertion_point(field_get:ScoreDelta.paddle_id)
+  return _internal_paddle_id();
+}
+inline void ScoreDelta::_internal_set_paddle_id(int32_t value) {
+  
+  _impl_.paddle_id_ = value;
+}
+inline void ScoreDelta::set_paddle_id(int32_t value) {
+  _internal_set_paddle_id(value);
+  // @@protoc_insertion_point(field_set:ScoreDelta.paddle_id)
+}
+
+// int32 delta = 2;
+inline void ScoreDelta::clear_delta() {
+  _impl_.delta_ = 0;
+}
+inline int32_t ScoreDelta::_internal_delta() const {
+  return _impl_.delta_;
+}
+inline int32_t ScoreDelta::delta() const {
+  // @@protoc_insertion_point(field_get:ScoreDelta.delta)
+  return _internal_delta();
+}
+inline void ScoreDelta::_internal_set_delta(int32_t value) {
+  
+  _impl_.delta_ = value;
+}
+inline void ScoreDelta::set_delta(int32_t value) {
+  _internal_set_delta(value);
+  // @@protoc_insertion_point(field_set:ScoreDelta.delta)
+}
+
+// -------------------------------------------------------------------
+
+// GameEvent
+
+// uint32 id = 1;
+inline void GameEvent::clear_id() {
+  _impl_.id_ = 0u;
+}
+inline uint32_t GameEvent::_internal_id() const {
+  return _impl_.id_;
+}
+inline uint32_t GameEvent::id() const {
+  // @@protoc_insertion_point(field_get:GameEvent.id)
+  return _internal_id();
+}
+inline void GameEvent::_internal_set_id(uint32_t value) {
+  
+  _impl_.id_ = value;
+}
+inline void GameEvent::set_id(uint32_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:GameEvent.id)
+}
+
+// .BrickHit brick_hit = 2;
+inline bool GameEvent::_internal_has_brick_hit() const {
+  return event_case() == kBrickHit;
+}
+inline bool GameEvent::has_brick_hit() const {
+  return _internal_has_brick_hit();
+}
+inline void GameEvent::set_has_brick_hit() {
+  _impl_._oneof_case_[0] = kBrickHit;
+}
+inline void GameEvent::clear_brick_hit() {
+  if (_internal_has_brick_hit()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.event_.brick_hit_;
+    }
+    clear_has_event();
+  }
+}
+inline ::BrickHit* GameEvent::release_brick_hit() {
+  // @@protoc_insertion_point(field_release:GameEvent.brick_hit)
+  if (_internal_has_brick_hit()) {
+    clear_has_event();
+    ::BrickHit* temp = _impl_.event_.brick_hit_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.event_.brick_hit_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::BrickHit& GameEvent::_internal_brick_hit() const {
+  return _internal_has_brick_hit()
+      ? *_impl_.event_.brick_hit_
+      : reinterpret_cast< ::BrickHit&>(::_BrickHit_default_instance_);
+}
+inline const ::BrickHit& GameEvent::brick_hit() const {
+  // @@protoc_insertion_point(field_get:GameEvent.brick_hit)
+  return _internal_brick_hit();
+}
+inline ::BrickHit* GameEvent::unsafe_arena_release_brick_hit() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:GameEvent.brick_hit)
+  if (_internal_has_brick_hit()) {
+    clear_has_event();
+    ::BrickHit* temp = _impl_.event_.brick_hit_;
+    _impl_.event_.brick_hit_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 NetBrick::_internal_duration() const {
-  return duration_;
+inline void GameEvent::unsafe_arena_set_allocated_brick_hit(::BrickHit* brick_hit) {
+  clear_event();
+  if (brick_hit) {
+    set_has_brick_hit();
+    _impl_.event_.brick_hit_ = brick_hit;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:GameEvent.brick_hit)
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 NetBrick::duration() const {
-  // @@protoc_insertion_point(field_get:NetBrick.duration)
-  return _internal_duration();
+inline ::BrickHit* GameEvent::_internal_mutable_brick_hit() {
+  if (!_internal_has_brick_hit()) {
+    clear_event();
+    set_has_brick_hit();
+    _impl_.event_.brick_hit_ = CreateMaybeMessage< ::BrickHit >(GetArenaForAllocation());
+  }
+  return _impl_.event_.brick_hit_;
+}
+inline ::BrickHit* GameEvent::mutable_brick_hit() {
+  ::BrickHit* _msg = _internal_mutable_brick_hit();
+  // @@protoc_insertion_point(field_mutable:GameEvent.brick_hit)
+  return _msg;
+}
+
+// .ScoreDelta score_delta = 3;
+inline bool GameEvent::_internal_has_score_delta() const {
+  return event_case() == kScoreDelta;
+}
+inline bool GameEvent::has_score_delta() const {
+  return _internal_has_score_delta();
+}
+inline void GameEvent::set_has_score_delta() {
+  _impl_._oneof_case_[0] = kScoreDelta;
+}
+inline void GameEvent::clear_score_delta() {
+  if (_internal_has_score_delta()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.event_.score_delta_;
+    }
+    clear_has_event();
+  }
+}
+inline ::ScoreDelta* GameEvent::release_score_delta() {
+  // @@protoc_insertion_point(field_release:GameEvent.score_delta)
+  if (_internal_has_score_delta()) {
+    clear_has_event();
+    ::ScoreDelta* temp = _impl_.event_.score_delta_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.event_.score_delta_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::ScoreDelta& GameEvent::_internal_score_delta() const {
+  return _internal_has_score_delta()
+      ? *_impl_.event_.score_delta_
+      : reinterpret_cast< ::ScoreDelta&>(::_ScoreDelta_default_instance_);
+}
+inline const ::ScoreDelta& GameEvent::score_delta() const {
+  // @@protoc_insertion_point(field_get:GameEvent.score_delta)
+  return _internal_score_delta();
+}
+inline ::ScoreDelta* GameEvent::unsafe_arena_release_score_delta() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:GameEvent.score_delta)
+  if (_internal_has_score_delta()) {
+    clear_has_event();
+    ::ScoreDelta* temp = _impl_.event_.score_delta_;
+    _impl_.event_.score_delta_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void GameEvent::unsafe_arena_set_allocated_score_delta(::ScoreDelta* score_delta) {
+  clear_event();
+  if (score_delta) {
+    set_has_score_delta();
+    _impl_.event_.score_delta_ = score_delta;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:GameEvent.score_delta)
+}
+inline ::ScoreDelta* GameEvent::_internal_mutable_score_delta() {
+  if (!_internal_has_score_delta()) {
+    clear_event();
+    set_has_score_delta();
+    _impl_.event_.score_delta_ = CreateMaybeMessage< ::ScoreDelta >(GetArenaForAllocation());
+  }
+  return _impl_.event_.score_delta_;
+}
+inline ::ScoreDelta* GameEvent::mutable_score_delta() {
+  ::ScoreDelta* _msg = _internal_mutable_score_delta();
+  // @@protoc_insertion_point(field_mutable:GameEvent.score_delta)
+  return _msg;
 }
-inline void NetBrick::_internal_set_duration(::PROTOBUF_NAMESPACE_ID::int32 value) {
+
+inline bool GameEvent::has_event() const {
+  return event_case() != EVENT_NOT_SET;
+}
+inline void GameEvent::clear_has_event() {
+  _impl_._oneof_case_[0] = EVENT_NOT_SET;
+}
+inline GameEvent::EventCase GameEvent::event_case() const {
+  return GameEvent::EventCase(_impl_._oneof_case_[0]);
+}
+// -------------------------------------------------------------------
+
+// LockstepInput
+
+// int64 first_tick = 1;
+inline void LockstepInput::clear_first_tick() {
+  _impl_.first_tick_ = int64_t{0};
+}
+inline int64_t LockstepInput::_internal_first_tick() const {
+  return _impl_.first_tick_;
+}
+inline int64_t LockstepInput::first_tick() const {
+  // @@protoc_insertion_point(field_get:LockstepInput.first_tick)
+  return _internal_first_tick();
+}
+inline void LockstepInput::_internal_set_first_tick(int64_t value) {
   
-  duration_ = value;
+  _impl_.first_tick_ = value;
 }
-inline void NetBrick::set_duration(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  _internal_set_duration(value);
-  // @@protoc_insertion_point(field_set:NetBrick.duration)
+inline void LockstepInput::set_first_tick(int64_t value) {
+  _internal_set_first_tick(value);
+  // @@protoc_insertion_point(field_set:LockstepInput.first_tick)
+}
+
+// repeated sint32 mouse_x = 2;
+inline int LockstepInput::_internal_mouse_x_size() const {
+  return _impl_.mouse_x_.size();
+}
+inline int LockstepInput::mouse_x_size() const {
+  return _internal_mouse_x_size();
+}
+inline void LockstepInput::clear_mouse_x() {
+  _impl_.mouse_x_.Clear();
+}
+inline int32_t LockstepInput::_internal_mouse_x(int index) const {
+  return _impl_.mouse_x_.Get(index);
+}
+inline int32_t LockstepInput::mouse_x(int index) const {
+  // @@protoc_insertion_point(field_get:LockstepInput.mouse_x)
+  return _internal_mouse_x(index);
+}
+inline void LockstepInput::set_mouse_x(int index, int32_t value) {
+  _impl_.mouse_x_.Set(index, value);
+  // @@protoc_insertion_point(field_set:LockstepInput.mouse_x)
+}
+inline void LockstepInput::_internal_add_mouse_x(int32_t value) {
+  _impl_.mouse_x_.Add(value);
+}
+inline void LockstepInput::add_mouse_x(int32_t value) {
+  _internal_add_mouse_x(value);
+  // @@protoc_insertion_point(field_add:LockstepInput.mouse_x)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+LockstepInput::_internal_mouse_x() const {
+  return _impl_.mouse_x_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+LockstepInput::mouse_x() const {
+  // @@protoc_insertion_point(field_list:LockstepInput.mouse_x)
+  return _internal_mouse_x();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+LockstepInput::_internal_mutable_mouse_x() {
+  return &_impl_.mouse_x_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+LockstepInput::mutable_mouse_x() {
+  // @@protoc_insertion_point(field_mutable_list:LockstepInput.mouse_x)
+  return _internal_mutable_mouse_x();
 }
 
 // -------------------------------------------------------------------
 
-// ElementPosition
+// LockstepStart
 
-// float x = 1;
-inline void ElementPosition::clear_x() {
-  x_ = 0;
+// uint32 brick_seed = 1;
+inline void LockstepStart::clear_brick_seed() {
+  _impl_.brick_seed_ = 0u;
 }
-inline float ElementPosition::_internal_x() const {
-  return x_;
+inline uint32_t LockstepStart::_internal_brick_seed() const {
+  return _impl_.brick_seed_;
 }
-inline float ElementPosition::x() const {
-  // @@protoc_insertion_point(field_get:ElementPosition.x)
-  return _internal_x();
+inline uint32_t LockstepStart::brick_seed() const {
+  // @@protoc_insertion_point(field_get:LockstepStart.brick_seed)
+  return _internal_brick_seed();
 }
-inline void ElementPosition::_internal_set_x(float value) {
+inline void LockstepStart::_internal_set_brick_seed(uint32_t value) {
   
-  x_ = value;
+  _impl_.brick_seed_ = value;
 }
-inline void ElementPosition::set_x(float value) {
-  _internal_set_x(value);
-  // @@protoc_insertion_point(field_set:ElementPosition.x)
+inline void LockstepStart::set_brick_seed(uint32_t value) {
+  _internal_set_brick_seed(value);
+  // @@protoc_insertion_point(field_set:LockstepStart.brick_seed)
 }
 
-// float y = 2;
-inline void ElementPosition::clear_y() {
-  y_ = 0;
+// -------------------------------------------------------------------
+
+// StateHash
+
+// int64 tick = 1;
+inline void StateHash::clear_tick() {
+  _impl_.tick_ = int64_t{0};
 }
-inline float ElementPosition::_internal_y() const {
-  return y_;
+inline int64_t StateHash::_internal_tick() const {
+  return _impl_.tick_;
 }
-inline float ElementPosition::y() const {
-  // @@protoc_insertion_point(field_get:ElementPosition.y)
-  return _internal_y();
+inline int64_t StateHash::tick() const {
+  // @@protoc_insertion_point(field_get:StateHash.tick)
+  return _internal_tick();
 }
-inline void ElementPosition::_internal_set_y(float value) {
+inline void StateHash::_internal_set_tick(int64_t value) {
   
-  y_ = value;
+  _impl_.tick_ = value;
 }
-inline void ElementPosition::set_y(float value) {
-  _internal_set_y(value);
-  // @@protoc_insertion_point(field_set:ElementPosition.y)
+inline void StateHash::set_tick(int64_t value) {
+  _internal_set_tick(value);
+  // @@protoc_insertion_point(field_set:StateHash.tick)
+}
+
+// fixed64 value = 2;
+inline void StateHash::clear_value() {
+  _impl_.value_ = uint64_t{0u};
+}
+inline uint64_t StateHash::_internal_value() const {
+  return _impl_.value_;
+}
+inline uint64_t StateHash::value() const {
+  // @@protoc_insertion_point(field_get:StateHash.value)
+  return _internal_value();
+}
+inline void StateHash::_internal_set_value(uint64_t value) {
+  
+  _impl_.value_ = value;
+}
+inline void StateHash::set_value(uint64_t value) {
+  _internal_set_value(value);
+  // @@protoc_insertion_point(field_set:StateHash.value)
 }
 
 // -------------------------------------------------------------------
 
-// GameElement
+// GameUpdate
 
-// int32 id = 1;
-inline void GameElement::clear_id() {
-  id_ = 0;
+// repeated .GameElement element = 1;
+inline int GameUpdate::_internal_element_size() const {
+  return _impl_.element_.size();
+}
+inline int GameUpdate::element_size() const {
+  return _internal_element_size();
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 GameElement::_internal_id() const {
-  return id_;
+inline void GameUpdate::clear_element() {
+  _impl_.element_.Clear();
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 GameElement::id() const {
-  // @@protoc_insertion_point(field_get:GameElement.id)
-  return _internal_id();
+inline ::GameElement* GameUpdate::mutable_element(int index) {
+  // @@protoc_insertion_point(field_mutable:GameUpdate.element)
+  return _impl_.element_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::GameElement >*
+GameUpdate::mutable_element() {
+  // @@protoc_insertion_point(field_mutable_list:GameUpdate.element)
+  return &_impl_.element_;
+}
+inline const ::GameElement& GameUpdate::_internal_element(int index) const {
+  return _impl_.element_.Get(index);
+}
+inline const ::GameElement& GameUpdate::element(int index) const {
+  // @@protoc_insertion_point(field_get:GameUpdate.element)
+  return _internal_element(index);
+}
+inline ::GameElement* GameUpdate::_internal_add_element() {
+  return _impl_.element_.Add();
+}
+inline ::GameElement* GameUpdate::add_element() {
+  ::GameElement* _add = _internal_add_element();
+  // @@protoc_insertion_point(field_add:GameUpdate.element)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::GameElement >&
+GameUpdate::element() const {
+  // @@protoc_insertion_point(field_list:GameUpdate.element)
+  return _impl_.element_;
+}
+
+// .Ping ping = 2;
+inline bool GameUpdate::_internal_has_ping() const {
+  return this != internal_default_instance() && _impl_.ping_ != nullptr;
+}
+inline bool GameUpdate::has_ping() const {
+  return _internal_has_ping();
+}
+inline void GameUpdate::clear_ping() {
+  if (GetArenaForAllocation() == nullptr && _impl_.ping_ != nullptr) {
+    delete _impl_.ping_;
+  }
+  _impl_.ping_ = nullptr;
+}
+inline const ::Ping& GameUpdate::_internal_ping() const {
+  const ::Ping* p = _impl_.ping_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Ping&>(
+      ::_Ping_default_instance_);
+}
+inline const ::Ping& GameUpdate::ping() const {
+  // @@protoc_insertion_point(field_get:GameUpdate.ping)
+  return _internal_ping();
 }
-inline void GameElement::_internal_set_id(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void GameUpdate::unsafe_arena_set_allocated_ping(
+    ::Ping* ping) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.ping_);
+  }
+  _impl_.ping_ = ping;
+  if (ping) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:GameUpdate.ping)
+}
+inline ::Ping* GameUpdate::release_ping() {
+  
+  ::Ping* temp = _impl_.ping_;
+  _impl_.ping_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Ping* GameUpdate::unsafe_arena_release_ping() {
+  // @@protoc_insertion_point(field_release:GameUpdate.ping)
   
-  id_ = value;
+  ::Ping* temp = _impl_.ping_;
+  _impl_.ping_ = nullptr;
+  return temp;
 }
-inline void GameElement::set_id(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  _internal_set_id(value);
-  // @@protoc_insertion_point(field_set:GameElement.id)
+inline ::Ping* GameUpdate::_internal_mutable_ping() {
+  
+  if (_impl_.ping_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Ping>(GetArenaForAllocation());
+    _impl_.ping_ = p;
+  }
+  return _impl_.ping_;
+}
+inline ::Ping* GameUpdate::mutable_ping() {
+  ::Ping* _msg = _internal_mutable_ping();
+  // @@protoc_insertion_point(field_mutable:GameUpdate.ping)
+  return _msg;
+}
+inline void GameUpdate::set_allocated_ping(::Ping* ping) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.ping_;
+  }
+  if (ping) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(ping);
+    if (message_arena != submessage_arena) {
+      ping = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, ping, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.ping_ = ping;
+  // @@protoc_insertion_point(field_set_allocated:GameUpdate.ping)
+}
+
+// .Pong pong = 3;
+inline bool GameUpdate::_internal_has_pong() const {
+  return this != internal_default_instance() && _impl_.pong_ != nullptr;
+}
+inline bool GameUpdate::has_pong() const {
+  return _internal_has_pong();
+}
+inline void GameUpdate::clear_pong() {
+  if (GetArenaForAllocation() == nullptr && _impl_.pong_ != nullptr) {
+    delete _impl_.pong_;
+  }
+  _impl_.pong_ = nullptr;
+}
+inline const ::Pong& GameUpdate::_internal_pong() const {
+  const ::Pong* p = _impl_.pong_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Pong&>(
+      ::_Pong_default_instance_);
+}
+inline const ::Pong& GameUpdate::pong() const {
+  // @@protoc_insertion_point(field_get:GameUpdate.pong)
+  return _internal_pong();
+}
+inline void GameUpdate::unsafe_arena_set_allocated_pong(
+    ::Pong* pong) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.pong_);
+  }
+  _impl_.pong_ = pong;
+  if (pong) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:GameUpdate.pong)
+}
+inline ::Pong* GameUpdate::release_pong() {
+  
+  ::Pong* temp = _impl_.pong_;
+  _impl_.pong_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Pong* GameUpdate::unsafe_arena_release_pong() {
+  // @@protoc_insertion_point(field_release:GameUpdate.pong)
+  
+  ::Pong* temp = _impl_.pong_;
+  _impl_.pong_ = nullptr;
+  return temp;
+}
+inline ::Pong* GameUpdate::_internal_mutable_pong() {
+  
+  if (_impl_.pong_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Pong>(GetArenaForAllocation());
+    _impl_.pong_ = p;
+  }
+  return _impl_.pong_;
+}
+inline ::Pong* GameUpdate::mutable_pong() {
+  ::Pong* _msg = _internal_mutable_pong();
+  // @@protoc_insertion_point(field_mutable:GameUpdate.pong)
+  return _msg;
+}
+inline void GameUpdate::set_allocated_pong(::Pong* pong) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.pong_;
+  }
+  if (pong) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(pong);
+    if (message_arena != submessage_arena) {
+      pong = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, pong, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.pong_ = pong;
+  // @@protoc_insertion_point(field_set_allocated:GameUpdate.pong)
+}
+
+// int64 tick = 4;
+inline void GameUpdate::clear_tick() {
+  _impl_.tick_ = int64_t{0};
+}
+inline int64_t GameUpdate::_internal_tick() const {
+  return _impl_.tick_;
+}
+inline int64_t GameUpdate::tick() const {
+  // @@protoc_insertion_point(field_get:GameUpdate.tick)
+  return _internal_tick();
+}
+inline void GameUpdate::_internal_set_tick(int64_t value) {
+  
+  _impl_.tick_ = value;
+}
+inline void GameUpdate::set_tick(int64_t value) {
+  _internal_set_tick(value);
+  // @@protoc_insertion_point(field_set:GameUpdate.tick)
+}
+
+// uint32 sequence = 5;
+inline void GameUpdate::clear_sequence() {
+  _impl_.sequence_ = 0u;
+}
+inline uint32_t GameUpdate::_internal_sequence() const {
+  return _impl_.sequence_;
+}
+inline uint32_t GameUpdate::sequence() const {
+  // @@protoc_insertion_point(field_get:GameUpdate.sequence)
+  return _internal_sequence();
+}
+inline void GameUpdate::_internal_set_sequence(uint32_t value) {
+  
+  _impl_.sequence_ = value;
+}
+inline void GameUpdate::set_sequence(uint32_t value) {
+  _internal_set_sequence(value);
+  // @@protoc_insertion_point(field_set:GameUpdate.sequence)
+}
+
+// uint32 ack = 6;
+inline void GameUpdate::clear_ack() {
+  _impl_.ack_ = 0u;
+}
+inline uint32_t GameUpdate::_internal_ack() const {
+  return _impl_.ack_;
+}
+inline uint32_t GameUpdate::ack() const {
+  // @@protoc_insertion_point(field_get:GameUpdate.ack)
+  return _internal_ack();
+}
+inline void GameUpdate::_internal_set_ack(uint32_t value) {
+  
+  _impl_.ack_ = value;
+}
+inline void GameUpdate::set_ack(uint32_t value) {
+  _internal_set_ack(value);
+  // @@protoc_insertion_point(field_set:GameUpdate.ack)
+}
+
+// .PlayerInput input = 7;
+inline bool GameUpdate::_internal_has_input() const {
+  return this != internal_default_instance() && _impl_.input_ != nullptr;
+}
+inline bool GameUpdate::has_input() const {
+  return _internal_has_input();
+}
+inline void GameUpdate::clear_input() {
+  if (GetArenaForAllocation() == nullptr && _impl_.input_ != nullptr) {
+    delete _impl_.input_;
+  }
+  _impl_.input_ = nullptr;
+}
+inline const ::PlayerInput& GameUpdate::_internal_input() const {
+  const ::PlayerInput* p = _impl_.input_;
+  return p != nullptr ? *p : reinterpret_cast<const ::PlayerInput&>(
+      ::_PlayerInput_default_instance_);
+}
+inline const ::PlayerInput& GameUpdate::input() const {
+  // @@protoc_insertion_point(field_get:GameUpdate.input)
+  return _internal_input();
+}
+inline void GameUpdate::unsafe_arena_set_allocated_input(
+    ::PlayerInput* input) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.input_);
+  }
+  _impl_.input_ = input;
+  if (input) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:GameUpdate.input)
+}
+inline ::PlayerInput* GameUpdate::release_input() {
+  
+  ::PlayerInput* temp = _impl_.input_;
+  _impl_.input_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::PlayerInput* GameUpdate::unsafe_arena_release_input() {
+  // @@protoc_insertion_point(field_release:GameUpdate.input)
+  
+  ::PlayerInput* temp = _impl_.input_;
+  _impl_.input_ = nullptr;
+  return temp;
+}
+inline ::PlayerInput* GameUpdate::_internal_mutable_input() {
+  
+  if (_impl_.input_ == nullptr) {
+    auto* p = CreateMaybeMessage<::PlayerInput>(GetArenaForAllocation());
+    _impl_.input_ = p;
+  }
+  return _impl_.input_;
+}
+inline ::PlayerInput* GameUpdate::mutable_input() {
+  ::PlayerInput* _msg = _internal_mutable_input();
+  // @@protoc_insertion_point(field_mutable:GameUpdate.input)
+  return _msg;
+}
+inline void GameUpdate::set_allocated_input(::PlayerInput* input) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.input_;
+  }
+  if (input) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(input);
+    if (message_arena != submessage_arena) {
+      input = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, input, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.input_ = input;
+  // @@protoc_insertion_point(field_set_allocated:GameUpdate.input)
+}
+
+// repeated .GameEvent event = 8;
+inline int GameUpdate::_internal_event_size() const {
+  return _impl_.event_.size();
+}
+inline int GameUpdate::event_size() const {
+  return _internal_event_size();
+}
+inline void GameUpdate::clear_event() {
+  _impl_.event_.Clear();
+}
+inline ::GameEvent* GameUpdate::mutable_event(int index) {
+  // @@protoc_insertion_point(field_mutable:GameUpdate.event)
+  return _impl_.event_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::GameEvent >*
+GameUpdate::mutable_event() {
+  // @@protoc_insertion_point(field_mutable_list:GameUpdate.event)
+  return &_impl_.event_;
+}
+inline const ::GameEvent& GameUpdate::_internal_event(int index) const {
+  return _impl_.event_.Get(index);
+}
+inline const ::GameEvent& GameUpdate::event(int index) const {
+  // @@protoc_insertion_point(field_get:GameUpdate.event)
+  return _internal_event(index);
+}
+inline ::GameEvent* GameUpdate::_internal_add_event() {
+  return _impl_.event_.Add();
+}
+inline ::GameEvent* GameUpdate::add_event() {
+  ::GameEvent* _add = _internal_add_event();
+  // @@protoc_insertion_point(field_add:GameUpdate.event)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::GameEvent >&
+GameUpdate::event() const {
+  // @@protoc_insertion_point(field_list:GameUpdate.event)
+  return _impl_.event_;
 }
 
-// .ElementPosition element_position = 2;
-inline bool GameElement::_internal_has_element_position() const {
-  return this != internal_default_instance() && element_position_ != nullptr;
+// .StateHash state_hash = 9;
+inline bool GameUpdate::_internal_has_state_hash() const {
+  return this != internal_default_instance() && _impl_.state_hash_ != nullptr;
 }
-inline bool GameElement::has_element_position() const {
-  return _internal_has_element_position();
+inline bool GameUpdate::has_state_hash() const {
+  return _internal_has_state_hash();
 }
-inline void GameElement::clear_element_position() {
-  if (GetArena() == nullptr && element_position_ != nullptr) {
-    delete element_position_;
+inline void GameUpdate::clear_state_hash() {
+  if (GetArenaForAllocation() == nullptr && _impl_.state_hash_ != nullptr) {
+    delete _impl_.state_hash_;
   }
-  element_position_ = nullptr;
+  _impl_.state_hash_ = nullptr;
 }
-inline const ::ElementPosition& GameElement::_internal_element_position() const {
-  const ::ElementPosition* p = element_position_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::ElementPosition*>(
-      &::_ElementPosition_default_instance_);
+inline const ::StateHash& GameUpdate::_internal_state_hash() const {
+  const ::StateHash* p = _impl_.state_hash_;
+  return p != nullptr ? *p : reinterpret_cast<const ::StateHash&>(
+      ::_StateHash_default_instance_);
 }
-inline const ::ElementPosition& GameElement::element_position() const {
-  // @@protoc_insertion_point(field_get:GameElement.element_position)
-  return _internal_element_position();
+inline const ::StateHash& GameUpdate::state_hash() const {
+  // @@protoc_insertion_point(field_get:GameUpdate.state_hash)
+  return _internal_state_hash();
 }
-inline void GameElement::unsafe_arena_set_allocated_element_position(
-    ::ElementPosition* element_position) {
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(element_position_);
+inline void GameUpdate::unsafe_arena_set_allocated_state_hash(
+    ::StateHash* state_hash) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.state_hash_);
   }
-  element_position_ = element_position;
-  if (element_position) {
+  _impl_.state_hash_ = state_hash;
+  if (state_hash) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:GameElement.element_position)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:GameUpdate.state_hash)
 }
-inline ::ElementPosition* GameElement::release_element_position() {
-  auto temp = unsafe_arena_release_element_position();
-  if (GetArena() != nullptr) {
+inline ::StateHash* GameUpdate::release_state_hash() {
+  
+  ::StateHash* temp = _impl_.state_hash_;
+  _impl_.state_hash_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::ElementPosition* GameElement::unsafe_arena_release_element_position() {
-  // @@protoc_insertion_point(field_release:GameElement.element_position)
+inline ::StateHash* GameUpdate::unsafe_arena_release_state_hash() {
+  // @@protoc_insertion_point(field_release:GameUpdate.state_hash)
   
-  ::ElementPosition* temp = element_position_;
-  element_position_ = nullptr;
+  ::StateHash* temp = _impl_.state_hash_;
+  _impl_.state_hash_ = nullptr;
   return temp;
 }
-inline ::ElementPosition* GameElement::_internal_mutable_element_position() {
+inline ::StateHash* GameUpdate::_internal_mutable_state_hash() {
   
-  if (element_position_ == nullptr) {
-    auto* p = CreateMaybeMessage<::ElementPosition>(GetArena());
-    element_position_ = p;
+  if (_impl_.state_hash_ == nullptr) {
+    auto* p = CreateMaybeMessage<::StateHash>(GetArenaForAllocation());
+    _impl_.state_hash_ = p;
   }
-  return element_position_;
+  return _impl_.state_hash_;
 }
-inline ::ElementPosition* GameElement::mutable_element_position() {
-  // @@protoc_insertion_point(field_mutable:GameElement.element_position)
-  return _internal_mutable_element_position();
+inline ::StateHash* GameUpdate::mutable_state_hash() {
+  ::StateHash* _msg = _internal_mutable_state_hash();
+  // @@protoc_insertion_point(field_mutable:GameUpdate.state_hash)
+  return _msg;
 }
-inline void GameElement::set_allocated_element_position(::ElementPosition* element_position) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+inline void GameUpdate::set_allocated_state_hash(::StateHash* state_hash) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete element_position_;
+    delete _impl_.state_hash_;
   }
-  if (element_position) {
+  if (state_hash) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(element_position);
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(state_hash);
     if (message_arena != submessage_arena) {
-      element_position = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, element_position, submessage_arena);
+      state_hash = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, state_hash, submessage_arena);
     }
     
   } else {
     
   }
-  element_position_ = element_position;
-  // @@protoc_insertion_point(field_set_allocated:GameElement.element_position)
+  _impl_.state_hash_ = state_hash;
+  // @@protoc_insertion_point(field_set_allocated:GameUpdate.state_hash)
 }
 
-// .NetBall ball = 3;
-inline bool GameElement::_internal_has_ball() const {
-  return specific_case() == kBall;
-}
-inline bool GameElement::has_ball() const {
-  return _internal_has_ball();
+// .LockstepInput lockstep_input = 10;
+inline bool GameUpdate::_internal_has_lockstep_input() const {
+  return this != internal_default_instance() && _impl_.lockstep_input_ != nullptr;
 }
-inline void GameElement::set_has_ball() {
-  _oneof_case_[0] = kBall;
-}
-inline void GameElement::clear_ball() {
-  if (_internal_has_ball()) {
-    if (GetArena() == nullptr) {
-      delete specific_.ball_;
-    }
-    clear_has_specific();
-  }
+inline bool GameUpdate::has_lockstep_input() const {
+  return _internal_has_lockstep_input();
 }
-inline ::NetBall* GameElement::release_ball() {
-  // @@protoc_insertion_point(field_release:GameElement.ball)
-  if (_internal_has_ball()) {
-    clear_has_specific();
-      ::NetBall* temp = specific_.ball_;
-    if (GetArena() != nullptr) {
-      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-    }
-    specific_.ball_ = nullptr;
-    return temp;
-  } else {
-    return nullptr;
+inline void GameUpdate::clear_lockstep_input() {
+  if (GetArenaForAllocation() == nullptr && _impl_.lockstep_input_ != nullptr) {
+    delete _impl_.lockstep_input_;
   }
+  _impl_.lockstep_input_ = nullptr;
 }
-inline const ::NetBall& GameElement::_internal_ball() const {
-  return _internal_has_ball()
-      ? *specific_.ball_
-      : *reinterpret_cast< ::NetBall*>(&::_NetBall_default_instance_);
+inline const ::LockstepInput& GameUpdate::_internal_lockstep_input() const {
+  const ::LockstepInput* p = _impl_.lockstep_input_;
+  return p != nullptr ? *p : reinterpret_cast<const ::LockstepInput&>(
+      ::_LockstepInput_default_instance_);
 }
-inline const ::NetBall& GameElement::ball() const {
-  // @@protoc_insertion_point(field_get:GameElement.ball)
-  return _internal_ball();
+inline const ::LockstepInput& GameUpdate::lockstep_input() const {
+  // @@protoc_insertion_point(field_get:GameUpdate.lockstep_input)
+  return _internal_lockstep_input();
 }
-inline ::NetBall* GameElement::unsafe_arena_release_ball() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:GameElement.ball)
-  if (_internal_has_ball()) {
-    clear_has_specific();
-    ::NetBall* temp = specific_.ball_;
-    specific_.ball_ = nullptr;
-    return temp;
-  } else {
-    return nullptr;
+inline void GameUpdate::unsafe_arena_set_allocated_lockstep_input(
+    ::LockstepInput* lockstep_input) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.lockstep_input_);
   }
-}
-inline void GameElement::unsafe_arena_set_allocated_ball(::NetBall* ball) {
-  clear_specific();
-  if (ball) {
-    set_has_ball();
-    specific_.ball_ = ball;
+  _impl_.lockstep_input_ = lockstep_input;
+  if (lockstep_input) {
+    
+  } else {
+    
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:GameElement.ball)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:GameUpdate.lockstep_input)
 }
-inline ::NetBall* GameElement::_internal_mutable_ball() {
-  if (!_internal_has_ball()) {
-    clear_specific();
-    set_has_ball();
-    specific_.ball_ = CreateMaybeMessage< ::NetBall >(GetArena());
+inline ::LockstepInput* GameUpdate::release_lockstep_input() {
+  
+  ::LockstepInput* temp = _impl_.lockstep_input_;
+  _impl_.lockstep_input_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
-  return specific_.ball_;
-}
-inline ::NetBall* GameElement::mutable_ball() {
-  // @@protoc_insertion_point(field_mutable:GameElement.ball)
-  return _internal_mutable_ball();
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-
-// .NetPaddle paddle = 4;
-inline bool GameElement::_internal_has_paddle() const {
-  return specific_case() == kPaddle;
+inline ::LockstepInput* GameUpdate::unsafe_arena_release_lockstep_input() {
+  // @@protoc_insertion_point(field_release:GameUpdate.lockstep_input)
+  
+  ::LockstepInput* temp = _impl_.lockstep_input_;
+  _impl_.lockstep_input_ = nullptr;
+  return temp;
 }
-inline bool GameElement::has_paddle() const {
-  return _internal_has_paddle();
+inline ::LockstepInput* GameUpdate::_internal_mutable_lockstep_input() {
+  
+  if (_impl_.lockstep_input_ == nullptr) {
+    auto* p = CreateMaybeMessage<::LockstepInput>(GetArenaForAllocation());
+    _impl_.lockstep_input_ = p;
+  }
+  return _impl_.lockstep_input_;
 }
-inline void GameElement::set_has_paddle() {
-  _oneof_case_[0] = kPaddle;
+inline ::LockstepInput* GameUpdate::mutable_lockstep_input() {
+  ::LockstepInput* _msg = _internal_mutable_lockstep_input();
+  // @@protoc_insertion_point(field_mutable:GameUpdate.lockstep_input)
+  return _msg;
 }
-inline void GameElement::clear_paddle() {
-  if (_internal_has_paddle()) {
-    if (GetArena() == nullptr) {
-      delete specific_.paddle_;
-    }
-    clear_has_specific();
+inline void GameUpdate::set_allocated_lockstep_input(::LockstepInput* lockstep_input) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.lockstep_input_;
   }
-}
-inline ::NetPaddle* GameElement::release_paddle() {
-  // @@protoc_insertion_point(field_release:GameElement.paddle)
-  if (_internal_has_paddle()) {
-    clear_has_specific();
-      ::NetPaddle* temp = specific_.paddle_;
-    if (GetArena() != nullptr) {
-      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (lockstep_input) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(lockstep_input);
+    if (message_arena != submessage_arena) {
+      lockstep_input = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, lockstep_input, submessage_arena);
     }
-    specific_.paddle_ = nullptr;
-    return temp;
+    
   } else {
-    return nullptr;
+    
   }
+  _impl_.lockstep_input_ = lockstep_input;
+  // @@protoc_insertion_point(field_set_allocated:GameUpdate.lockstep_input)
 }
-inline const ::NetPaddle& GameElement::_internal_paddle() const {
-  return _internal_has_paddle()
-      ? *specific_.paddle_
-      : *reinterpret_cast< ::NetPaddle*>(&::_NetPaddle_default_instance_);
-}
-inline const ::NetPaddle& GameElement::paddle() const {
-  // @@protoc_insertion_point(field_get:GameElement.paddle)
-  return _internal_paddle();
-}
-inline ::NetPaddle* GameElement::unsafe_arena_release_paddle() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:GameElement.paddle)
-  if (_internal_has_paddle()) {
-    clear_has_specific();
-    ::NetPaddle* temp = specific_.paddle_;
-    specific_.paddle_ = nullptr;
-    return temp;
-  } else {
-    return nullptr;
-  }
+
+// .LockstepStart lockstep_start = 11;
+inline bool GameUpdate::_internal_has_lockstep_start() const {
+  return this != internal_default_instance() && _impl_.lockstep_start_ != nullptr;
 }
-inline void GameElement::unsafe_arena_set_allocated_paddle(::NetPaddle* paddle) {
-  clear_specific();
-  if (paddle) {
-    set_has_paddle();
-    specific_.paddle_ = paddle;
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:GameElement.paddle)
+inline bool GameUpdate::has_lockstep_start() const {
+  return _internal_has_lockstep_start();
 }
-inline ::NetPaddle* GameElement::_internal_mutable_paddle() {
-  if (!_internal_has_paddle()) {
-    clear_specific();
-    set_has_paddle();
-    specific_.paddle_ = CreateMaybeMessage< ::NetPaddle >(GetArena());
+inline void GameUpdate::clear_lockstep_start() {
+  if (GetArenaForAllocation() == nullptr && _impl_.lockstep_start_ != nullptr) {
+    delete _impl_.lockstep_start_;
   }
-  return specific_.paddle_;
-}
-inline ::NetPaddle* GameElement::mutable_paddle() {
-  // @@protoc_insertion_point(field_mutable:GameElement.paddle)
-  return _internal_mutable_paddle();
+  _impl_.lockstep_start_ = nullptr;
 }
-
-// .NetBrick brick = 5;
-inline bool GameElement::_internal_has_brick() const {
-  return specific_case() == kBrick;
+inline const ::LockstepStart& GameUpdate::_internal_lockstep_start() const {
+  const ::LockstepStart* p = _impl_.lockstep_start_;
+  return p != nullptr ? *p : reinterpret_cast<const ::LockstepStart&>(
+      ::_LockstepStart_default_instance_);
 }
-inline bool GameElement::has_brick() const {
-  return _internal_has_brick();
-}
-inline void GameElement::set_has_brick() {
-  _oneof_case_[0] = kBrick;
+inline const ::LockstepStart& GameUpdate::lockstep_start() const {
+  // @@protoc_insertion_point(field_get:GameUpdate.lockstep_start)
+  return _internal_lockstep_start();
 }
-inline void GameElement::clear_brick() {
-  if (_internal_has_brick()) {
-    if (GetArena() == nullptr) {
-      delete specific_.brick_;
-    }
-    clear_has_specific();
+inline void GameUpdate::unsafe_arena_set_allocated_lockstep_start(
+    ::LockstepStart* lockstep_start) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.lockstep_start_);
   }
-}
-inline ::NetBrick* GameElement::release_brick() {
-  // @@protoc_insertion_point(field_release:GameElement.brick)
-  if (_internal_has_brick()) {
-    clear_has_specific();
-      ::NetBrick* temp = specific_.brick_;
-    if (GetArena() != nullptr) {
-      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-    }
-    specific_.brick_ = nullptr;
-    return temp;
+  _impl_.lockstep_start_ = lockstep_start;
+  if (lockstep_start) {
+    
   } else {
-    return nullptr;
+    
   }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:GameUpdate.lockstep_start)
 }
-inline const ::NetBrick& GameElement::_internal_brick() const {
-  return _internal_has_brick()
-      ? *specific_.brick_
-      : *reinterpret_cast< ::NetBrick*>(&::_NetBrick_default_instance_);
-}
-inline const ::NetBrick& GameElement::brick() const {
-  // @@protoc_insertion_point(field_get:GameElement.brick)
-  return _internal_brick();
-}
-inline ::NetBrick* GameElement::unsafe_arena_release_brick() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:GameElement.brick)
-  if (_internal_has_brick()) {
-    clear_has_specific();
-    ::NetBrick* temp = specific_.brick_;
-    specific_.brick_ = nullptr;
-    return temp;
-  } else {
-    return nullptr;
+inline ::LockstepStart* GameUpdate::release_lockstep_start() {
+  
+  ::LockstepStart* temp = _impl_.lockstep_start_;
+  _impl_.lockstep_start_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline void GameElement::unsafe_arena_set_allocated_brick(::NetBrick* brick) {
-  clear_specific();
-  if (brick) {
-    set_has_brick();
-    specific_.brick_ = brick;
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:GameElement.brick)
+inline ::LockstepStart* GameUpdate::unsafe_arena_release_lockstep_start() {
+  // @@protoc_insertion_point(field_release:GameUpdate.lockstep_start)
+  
+  ::LockstepStart* temp = _impl_.lockstep_start_;
+  _impl_.lockstep_start_ = nullptr;
+  return temp;
 }
-inline ::NetBrick* GameElement::_internal_mutable_brick() {
-  if (!_internal_has_brick()) {
-    clear_specific();
-    set_has_brick();
-    specific_.brick_ = CreateMaybeMessage< ::NetBrick >(GetArena());
+inline ::LockstepStart* GameUpdate::_internal_mutable_lockstep_start() {
+  
+  if (_impl_.lockstep_start_ == nullptr) {
+    auto* p = CreateMaybeMessage<::LockstepStart>(GetArenaForAllocation());
+    _impl_.lockstep_start_ = p;
   }
-  return specific_.brick_;
-}
-inline ::NetBrick* GameElement::mutable_brick() {
-  // @@protoc_insertion_point(field_mutable:GameElement.brick)
-  return _internal_mutable_brick();
+  return _impl_.lockstep_start_;
 }
-
-inline bool GameElement::has_specific() const {
-  return specific_case() != SPECIFIC_NOT_SET;
-}
-inline void GameElement::clear_has_specific() {
-  _oneof_case_[0] = SPECIFIC_NOT_SET;
+inline ::LockstepStart* GameUpdate::mutable_lockstep_start() {
+  ::LockstepStart* _msg = _internal_mutable_lockstep_start();
+  // @@protoc_insertion_point(field_mutable:GameUpdate.lockstep_start)
+  return _msg;
 }
-inline GameElement::SpecificCase GameElement::specific_case() const {
-  return GameElement::SpecificCase(_oneof_case_[0]);
+inline void GameUpdate::set_allocated_lockstep_start(::LockstepStart* lockstep_start) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.lockstep_start_;
+  }
+  if (lockstep_start) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(lockstep_start);
+    if (message_arena != submessage_arena) {
+      lockstep_start = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, lockstep_start, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.lockstep_start_ = lockstep_start;
+  // @@protoc_insertion_point(field_set_allocated:GameUpdate.lockstep_start)
 }
-// -------------------------------------------------------------------
 
-// GameUpdate
-
-// repeated .GameElement element = 1;
-inline int GameUpdate::_internal_element_size() const {
-  return element_.size();
+// bytes state = 12;
+inline void GameUpdate::clear_state() {
+  _impl_.state_.ClearToEmpty();
 }
-inline int GameUpdate::element_size() const {
-  return _internal_element_size();
-}
-inline void GameUpdate::clear_element() {
-  element_.Clear();
+inline const std::string& GameUpdate::state() const {
+  // @@protoc_insertion_point(field_get:GameUpdate.state)
+  return _internal_state();
 }
-inline ::GameElement* GameUpdate::mutable_element(int index) {
-  // @@protoc_insertion_point(field_mutable:GameUpdate.element)
-  return element_.Mutable(index);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GameUpdate::set_state(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.state_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:GameUpdate.state)
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::GameElement >*
-GameUpdate::mutable_element() {
-  // @@protoc_insertion_point(field_mutable_list:GameUpdate.element)
-  return &element_;
+inline std::string* GameUpdate::mutable_state() {
+  std::string* _s = _internal_mutable_state();
+  // @@protoc_insertion_point(field_mutable:GameUpdate.state)
+  return _s;
 }
-inline const ::GameElement& GameUpdate::_internal_element(int index) const {
-  return element_.Get(index);
+inline const std::string& GameUpdate::_internal_state() const {
+  return _impl_.state_.Get();
 }
-inline const ::GameElement& GameUpdate::element(int index) const {
-  // @@protoc_insertion_point(field_get:GameUpdate.element)
-  return _internal_element(index);
+inline void GameUpdate::_internal_set_state(const std::string& value) {
+  
+  _impl_.state_.Set(value, GetArenaForAllocation());
 }
-inline ::GameElement* GameUpdate::_internal_add_element() {
-  return element_.Add();
+inline std::string* GameUpdate::_internal_mutable_state() {
+  
+  return _impl_.state_.Mutable(GetArenaForAllocation());
 }
-inline ::GameElement* GameUpdate::add_element() {
-  // @@protoc_insertion_point(field_add:GameUpdate.element)
-  return _internal_add_element();
+inline std::string* GameUpdate::release_state() {
+  // @@protoc_insertion_point(field_release:GameUpdate.state)
+  return _impl_.state_.Release();
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::GameElement >&
-GameUpdate::element() const {
-  // @@protoc_insertion_point(field_list:GameUpdate.element)
-  return element_;
+inline void GameUpdate::set_allocated_state(std::string* state) {
+  if (state != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.state_.SetAllocated(state, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.state_.IsDefault()) {
+    _impl_.state_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:GameUpdate.state)
 }
 
 #ifdef __GNUC__
@@ -1597,6 +4794,24 @@ GameUpdate::element() const {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
@@ -7,11 +7,21 @@
 #include "box2d-incl/box2d/b2_math.h"
 #include "box2d-incl/box2d/b2_polygon_shape.h"
 #include "box2d-incl/box2d/b2_world.h"
+#include <algorithm>
 #include <cmath>
+#include <cstddef>
+#include <cstdint>
 #include <cstring>
 #include <ftxui/screen/color.hpp>
 #include <iostream>
-
+#include <limits>
+#include <memory>
+#include <new>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+#include "quantization.hpp"
 #include "utils.hpp"
 
 namespace arkanoid {
@@ -30,6 +40,15 @@ float constexpr ball_velocity_x{ 2.0F }, ball_velocity_y{ 2.5F };
 float constexpr ball_force_y{ 0.05F }, ball_force_push_when_zero{ 0.7F };
 bool constexpr ball_forces{ true };
 
+// splitmix64-Finalizer: verteilt auch benachbarte Werte wie ids gleichmäßig. Für Prüfsummen, siehe state_hash.hpp.
+[[nodiscard]] std::uint64_t hash_mix(std::uint64_t value)
+{
+  value += 0x9E3779B97F4A7C15ULL;
+  value = (value ^ (value >> 30U)) * 0xBF58476D1CE4E5B9ULL;
+  value = (value ^ (value >> 27U)) * 0x94D049BB133111EBULL;
+  return value ^ (value >> 31U);
+}
+
 class IdGenerator
 {
 private:
@@ -95,10 +114,13 @@ public:
 
 
 enum ElementType { BALL, BRICK, PADDLE };
+
 class Element
 {
+private:
+  ElementType const m_type;
+
 public:
-  [[nodiscard]] virtual ElementType get_type() const = 0;
   virtual bool did_update() = 0;
   virtual void set_position(Vector const) = 0;
   [[nodiscard]] virtual Vector center_position() const = 0;
@@ -112,16 +134,17 @@ protected:
   ftxui::Color m_color;
 
   friend void fill_game_element(GameElement *const &, arkanoid::Element const *);// todo: außerhalb von namespace ??
-  friend void parse_game_update(std::map<int, std::unique_ptr<Element>> &,
-    GameUpdate const &,
-    b2World *,
-    std::map<b2Fixture *, arkanoid::Element *> &);
   friend void parse_game_element(Element *, GameElement const &);
+  friend class ElementStore;
 
 public:
-  IdGenerator static id_generator;
+  // Die id vergibt der ElementStore, in den das Element eingefügt wird; bis dahin ist sie -1.
+  explicit Element(ElementType const type, ftxui::Color const color = ftxui::Color::White)
+    : m_type{ type }, m_id{ -1 }, m_color{ color }
+  {}
 
-  explicit Element(ftxui::Color const color = ftxui::Color::White) : m_color{ color }, m_id{ id_generator.next() } {}
+  // Nicht virtuell: Die Art wird beim Erzeugen festgelegt und ersetzt dynamic_cast, siehe element_cast.
+  [[nodiscard]] ElementType get_type() const { return m_type; }
 
   void invert_position()
   {
@@ -139,22 +162,38 @@ public:
   [[nodiscard]] int bottom() const { return top() + height(); }
 
   [[nodiscard]] int id() const { return m_id; }
+
+protected:
+  // Verweist Fixture und Körper auf dieses Element, siehe element_of. Die Adresse bleibt im ElementStore gültig.
+  void attach(b2Fixture *const fixture)
+  {
+    auto const pointer = reinterpret_cast<std::uintptr_t>(this);
+    fixture->GetUserData().pointer = pointer;
+    fixture->GetBody()->GetUserData().pointer = pointer;
+  }
 };
 
-IdGenerator Element::id_generator = IdGenerator{ 0 };
+// Das Element zu einer Fixture, ohne Nachschlagen; nullptr für Fixtures ohne Element wie die Spielfeldränder.
+[[nodiscard]] Element *element_of(b2Fixture const *fixture)
+{
+  return reinterpret_cast<Element *>(fixture->GetUserData().pointer);
+}
 
 
-class Paddle : public Element
+class Paddle final : public Element
 {
 private:
   b2Body *m_body_ptr = nullptr;
   bool m_updated{ false };
   bool m_is_controlled_by_this_game_instance{ false };
+  bool m_moving{ false };
   int m_score{ 0 };
   friend void parse_game_element(Element *, GameElement const &);
 
 public:
-  explicit Paddle(Vector const pos, b2World *arkanoid_world, std::map<b2Fixture *, Element *> &map) : Element{}
+  static ElementType constexpr type{ PADDLE };
+
+  explicit Paddle(Vector const pos, b2World *arkanoid_world) : Element{ type }
   {
     auto const position = convert_to_b2_coords(pos);
     b2BodyDef groundBodyDef;
@@ -167,9 +206,8 @@ public:
 
     auto fixture = m_body_ptr->CreateFixture(&groundBox, 0.0f);
 
-    map.insert({ fixture, this });
+    attach(fixture);
   }
-  [[nodiscard]] ElementType get_type() const override { return PADDLE; }
 
   [[nodiscard]] bool update_x(int const new_x)
   {
@@ -178,8 +216,14 @@ public:
 
     pos.x = new_x;
     set_position(pos);
-    if (old_position.x < new_x + 1.0F && old_position.x > new_x - 1.0F) { return false; }// todo: möglicher feinschliff
+    if (old_position.x < new_x + 1.0F && old_position.x > new_x - 1.0F) {// todo: möglicher feinschliff
+      // Stillstand einmal mitteilen, damit die Gegenstelle nicht weiter extrapoliert.
+      m_updated = m_updated || m_moving;
+      m_moving = false;
+      return false;
+    }
 
+    m_moving = true;
     m_updated = true;
     return true;
   }
@@ -223,8 +267,9 @@ public:
     return (is_controlled_by_this_game_instance()) ? ftxui::Color::White : ftxui::Color::GrayDark;
   }
   [[nodiscard]] int score() const { return m_score; }
+  void set_score(int const score) { m_score = score; }
 };
-class Ball : public Element
+class Ball final : public Element
 {
 
 private:
@@ -235,14 +280,15 @@ private:
   friend void parse_game_element(Element *, GameElement const &);
 
 public:
-  explicit Ball(Vector const pos, b2World *arkanoid_world, std::map<b2Fixture *, Element *> &map, Vector const velocity)
-    : Element{ ftxui::Color::Red }
+  static ElementType constexpr type{ BALL };
+
+  explicit Ball(Vector const pos, b2World *arkanoid_world, Vector const velocity)
+    : Element{ type, ftxui::Color::Red }
   {
     auto const position = convert_to_b2_coords(pos);
     b2BodyDef bodyDef;
     bodyDef.type = b2_dynamicBody;
     bodyDef.position.Set(position.x, position.y);
-    // bodyDef.userData = b2BodyUserData{}; // todo: verlinkung auf dieses objekt.
     m_body_ptr = arkanoid_world->CreateBody(&bodyDef);
     bodyDef.linearDamping = 0.0F;
     bodyDef.angularDamping = 0.0F;
@@ -260,20 +306,18 @@ public:
     m_body_ptr->SetAngularVelocity(0);
     m_body_ptr->SetFixedRotation(true);
 
-    map.insert({ fixture, this });
+    attach(fixture);
   }
 
-  [[nodiscard]] ElementType get_type() const override { return BALL; }
-
   [[nodiscard]] Vector velocity() const
   {
     auto vel = m_body_ptr->GetLinearVelocity();
     return { vel.x, vel.y };
   }
 
-  bool did_update() override
+  // Kräfte wirken bis zum nächsten Step; nach dem Zurücksetzen der Welt müssen sie erneut angewendet werden.
+  void apply_forces()
   {
-
     if (ball_forces && m_body_ptr != nullptr) {
 
       float const middle_y = ((playing_field_bottom - playing_field_top) / 2.0F) + playing_field_top;
@@ -296,7 +340,11 @@ public:
         m_body_ptr->ApplyForceToCenter({ -gravity.x + correct_direction_x, -gravity.y + corrent_direction_y }, false);
       }
     }
+  }
 
+  bool did_update() override
+  {
+    apply_forces();
 
     if (m_updated) {
       m_updated = false;
@@ -331,19 +379,34 @@ public:
   [[nodiscard]] Paddle *last_paddle() const { return m_paddle_ptr; }
 };
 
-class Brick : public Element
+class Brick;
+
+// Lebende Steine eines ElementStore. Zerstörte werden vorgemerkt, weil ihre Körper nicht während b2World::Step
+// abgeschaltet werden dürfen, siehe ElementStore::disable_destroyed_bricks.
+struct BrickTally
+{
+  std::size_t live{ 0 };
+  std::vector<Brick *> destroyed;
+  std::uint64_t hash{ 0 };// XOR von Brick::state_hash() aller Steine
+};
+
+class Brick final : public Element
 {
 
 private:
   b2Body *m_body_ptr{ nullptr };
   int m_duration;
   bool m_updated{ false };
+  BrickTally *m_tally{ nullptr };
 
   friend void parse_game_element(Element *, GameElement const &);
+  friend class ElementStore;
 
 public:
-  explicit Brick(Vector const pos, b2World *arkanoid_world, std::map<b2Fixture *, Element *> &map, int const duration)
-    : Element{}, m_duration{ duration }
+  static ElementType constexpr type{ BRICK };
+
+  explicit Brick(Vector const pos, b2World *arkanoid_world, int const duration)
+    : Element{ type }, m_duration{ duration }
   // todo: b2world muss als pointer, da sonst make_unique nicht funktioniert
   {
 
@@ -358,24 +421,22 @@ public:
 
     auto *fixture = m_body_ptr->CreateFixture(&groundBox, 0.0f);
 
-    map.insert({ fixture, this });
+    attach(fixture);
   }
 
-  void hit(Ball *ball)
+  // Gibt zurück, ob der Treffer gezählt wurde. Zerstören darf nur, wer den Ball zuletzt gespielt hat.
+  bool hit(Ball const *ball)
   {
     if ((ball->last_paddle() != nullptr && ball->last_paddle()->is_controlled_by_this_game_instance())
         || m_duration > 1) {
-      --m_duration;
-
-      if (m_duration <= 0) {
-        m_updated = true;
-        ball->add_to_next_update();
-      }
+      set_duration(m_duration - 1);
+      return true;
     }
+    return false;
   }
 
+  void add_to_next_update() { m_updated = true; }
 
-  [[nodiscard]] ElementType get_type() const override { return BRICK; }
   void set_position(Vector const pos) override
   {
     auto const position = convert_to_b2_coords(pos);
@@ -405,6 +466,29 @@ public:
     return false;
   }
   [[nodiscard]] int duration() const { return m_duration; }
+  // Steine bewegen sich nicht; ihr Zustand ist allein die Haltbarkeit.
+  [[nodiscard]] std::uint64_t state_hash() const
+  {
+    auto const id = std::uint64_t{ static_cast<std::uint32_t>(m_id) };
+    return hash_mix((id << 32U) | static_cast<std::uint32_t>(m_duration));
+  }
+  void set_duration(int const duration)
+  {
+    bool const was_live = m_duration > 0;
+    if (m_tally != nullptr) { m_tally->hash ^= state_hash(); }
+    m_duration = duration;
+    if (m_tally == nullptr) { return; }
+
+    m_tally->hash ^= state_hash();
+    if (was_live == (m_duration > 0)) { return; }
+
+    if (was_live) {
+      --m_tally->live;
+      m_tally->destroyed.push_back(this);
+    } else {
+      ++m_tally->live;
+    }
+  }
   [[nodiscard]] ftxui::Color color() const override
   {
     auto const duration = static_cast<float>(m_duration);
@@ -420,47 +504,442 @@ public:
   }
 };
 
-void fill_game_element(GameElement *const &game_element, arkanoid::Element const *element)
+// Ersetzt dynamic_cast: liefert nullptr, wenn das Element nicht von der Art T ist.
+template<typename T>//
+[[nodiscard]] T *element_cast(Element *element)
 {
-  auto *position = new ElementPosition;
+  return (element != nullptr && element->get_type() == T::type) ? static_cast<T *>(element) : nullptr;
+}
 
-  auto const pos = element->center_position();
+template<typename T>//
+[[nodiscard]] T const *element_cast(Element const *element)
+{
+  return (element != nullptr && element->get_type() == T::type) ? static_cast<T const *>(element) : nullptr;
+}
 
-  float const x = pos.x;
-  float const y = pos.y;
+// Für Kontakte zweier Elemente: dasjenige der Art T, sonst nullptr.
+template<typename T>//
+[[nodiscard]] T *element_cast_either(Element *first, Element *second)
+{
+  auto *element = element_cast<T>(first);
+  return (element != nullptr) ? element : element_cast<T>(second);
+}
 
-  position->set_x(x);
-  position->set_y(y);
+// Ruft visitor mit der konkreten Art des Elements auf. Da die Arten final sind, werden auch deren virtuelle
+// Methoden im Besucher direkt aufgerufen.
+template<typename Visitor>//
+decltype(auto) visit_element(Element &element, Visitor &&visitor)
+{
+  switch (element.get_type()) {
+  case BALL:
+    return visitor(static_cast<Ball &>(element));
+  case BRICK:
+    return visitor(static_cast<Brick &>(element));
+  case PADDLE:
+    break;
+  }
+  return visitor(static_cast<Paddle &>(element));
+}
 
-  game_element->set_id(element->id());
-  game_element->set_allocated_element_position(position);
+template<typename Visitor>//
+decltype(auto) visit_element(Element const &element, Visitor &&visitor)
+{
+  switch (element.get_type()) {
+  case BALL:
+    return visitor(static_cast<Ball const &>(element));
+  case BRICK:
+    return visitor(static_cast<Brick const &>(element));
+  case PADDLE:
+    break;
+  }
+  return visitor(static_cast<Paddle const &>(element));
+}
+
+// Nur wachsende Ablage für Elemente einer Art. Die Elemente liegen zusammenhängend in Blöcken fester Größe und
+// behalten beim Wachsen ihre Adresse, da box2d und andere Elemente (Ball::last_paddle) auf sie zeigen. Es sind ganze
+// Objekte je Art, keine Spalten je Feld: Die Position liegt ohnehin im b2Body, und Haltbarkeit, Farbe und Körper
+// werden in den Durchgängen pro Frame zusammen mit dem Objekt gelesen.
+template<typename T>//
+class ElementPool
+{
+private:
+  static std::size_t constexpr block_size{ 128 };
+
+  struct Block
+  {
+    alignas(T) std::byte storage[sizeof(T) * block_size];
+  };
+
+  std::vector<std::unique_ptr<Block>> m_blocks;
+  std::size_t m_size{ 0 };
+
+  [[nodiscard]] T *slot(std::size_t const index) const
+  {
+    return std::launder(
+      reinterpret_cast<T *>(m_blocks[index / block_size]->storage + ((index % block_size) * sizeof(T))));
+  }
+
+public:
+  ElementPool() = default;
+  ElementPool(ElementPool const &) = delete;
+  ElementPool &operator=(ElementPool const &) = delete;
+  ~ElementPool() { clear(); }
+
+  template<typename... Args>//
+  T &emplace(Args &&...args)
+  {
+    if (m_size == m_blocks.size() * block_size) { m_blocks.push_back(std::make_unique<Block>()); }
+
+    auto *address = m_blocks[m_size / block_size]->storage + ((m_size % block_size) * sizeof(T));
+    auto *element = ::new (static_cast<void *>(address)) T(std::forward<Args>(args)...);
+    ++m_size;
+    return *element;
+  }
+
+  // Blockweise, damit die innere Schleife nur einen Zeiger weiterschiebt.
+  template<typename Function>//
+  void for_each(Function &&function) const
+  {
+    for (std::size_t first{ 0 }; first < m_size; first += block_size) {
+      auto *elements = slot(first);
+      auto const count = std::min(block_size, m_size - first);
+      for (std::size_t i{ 0 }; i < count; ++i) { function(elements[i]); }
+    }
+  }
+
+  // Behält die Blöcke, damit eine neue Partie nicht erneut alloziert.
+  void clear()
+  {
+    for (auto index = m_size; index > 0; --index) { std::destroy_at(slot(index - 1)); }
+    m_size = 0;
+  }
+
+  [[nodiscard]] T &operator[](std::size_t const index) const { return *slot(index); }
+  [[nodiscard]] std::size_t size() const { return m_size; }
+  [[nodiscard]] bool empty() const { return m_size == 0; }
+};
+
+// Stabiler Verweis auf ein Element im ElementStore: Art und Platz im Array dieser Art.
+struct ElementHandle
+{
+  static std::uint32_t constexpr invalid_index{ std::numeric_limits<std::uint32_t>::max() };
+
+  ElementType kind{ BALL };
+  std::uint32_t index{ invalid_index };
 
-  if (element->get_type() == BALL) {
-    auto const *ball = dynamic_cast<const Ball *>(element);
-    auto *net_ball = new NetBall;
+  [[nodiscard]] bool valid() const { return index != invalid_index; }
+};
+
+// Alle Elemente einer Partie, je Art zusammenhängend abgelegt: Schleifen über alle Elemente laufen Art für Art
+// linear durch den Speicher und rufen den Besucher mit der konkreten Art auf. ids sind klein und fortlaufend, daher
+// führt eine Tabelle von der id zum Handle. Elemente werden nie einzeln entfernt; Handles und Adressen bleiben bis
+// clear() gültig. Jeder Store vergibt seine ids selbst, daher teilen sich gleichzeitig laufende Partien keinen
+// Zustand und eine neue Partie beginnt immer bei id 0.
+class ElementStore
+{
+private:
+  ElementPool<Paddle> m_paddles;
+  ElementPool<Ball> m_balls;
+  ElementPool<Brick> m_bricks;
+  std::vector<ElementHandle> m_handles;// nach id
+  BrickTally m_brick_tally;
+  IdGenerator m_ids{ 0 };
+
+  template<typename T>//
+  [[nodiscard]] ElementPool<T> &pool()
+  {
+    if constexpr (std::is_same_v<T, Paddle>) {
+      return m_paddles;
+    } else if constexpr (std::is_same_v<T, Ball>) {
+      return m_balls;
+    } else {
+      return m_bricks;
+    }
+  }
+
+  template<typename T>//
+  T &insert(int const id, T &element)
+  {
+    auto const index = static_cast<std::size_t>(id);
+    if (index >= m_handles.size()) { m_handles.resize(index + 1); }
+    m_handles[index] = { T::type, static_cast<std::uint32_t>(pool<T>().size() - 1) };
+
+    if constexpr (std::is_same_v<T, Brick>) {
+      element.m_tally = &m_brick_tally;
+      m_brick_tally.hash ^= element.state_hash();
+      if (element.duration() > 0) { ++m_brick_tally.live; }
+    }
+    return element;
+  }
+
+public:
+  // Größte zulässige id; größere von der Gegenstelle werden ignoriert, damit die Tabelle nicht beliebig wächst.
+  static int constexpr max_id{ 1 << 16 };
+
+  ElementStore() = default;
+  ElementStore(ElementStore const &) = delete;
+  ElementStore &operator=(ElementStore const &) = delete;
+
+  [[nodiscard]] static bool valid_id(int const id) { return id >= 0 && id <= max_id; }
+
+  // Legt ein Element mit der nächsten freien id an.
+  template<typename T, typename... Args>//
+  T &emplace(Args &&...args)
+  {
+    auto &element = pool<T>().emplace(std::forward<Args>(args)...);
+    element.m_id = m_ids.next();
+    return insert(element.m_id, element);
+  }
+
+  // Für Elemente der Gegenstelle. Die id muss gültig und noch nicht vergeben sein; später lokal angelegte Elemente
+  // erhalten größere ids.
+  template<typename T, typename... Args>//
+  T &emplace_with_id(int const id, Args &&...args)
+  {
+    auto &element = pool<T>().emplace(std::forward<Args>(args)...);
+    element.m_id = id;
+    if (id > m_ids.current()) { m_ids = IdGenerator{ id + 1 }; }
+    return insert(id, element);
+  }
+
+  // Zuletzt vergebene id, für Spielstände, siehe MatchSnapshot.
+  [[nodiscard]] int current_id() const { return m_ids.current(); }
+  void restore_current_id(int const id) { m_ids = IdGenerator{ id + 1 }; }
+
+  [[nodiscard]] ElementHandle handle(int const id) const
+  {
+    return (id >= 0 && static_cast<std::size_t>(id) < m_handles.size()) ? m_handles[static_cast<std::size_t>(id)]
+                                                                          : ElementHandle{};
+  }
+
+  [[nodiscard]] Element *get(ElementHandle const handle) const
+  {
+    if (!handle.valid()) { return nullptr; }
+
+    switch (handle.kind) {
+    case BALL:
+      return &m_balls[handle.index];
+    case BRICK:
+      return &m_bricks[handle.index];
+    case PADDLE:
+      break;
+    }
+    return &m_paddles[handle.index];
+  }
+
+  [[nodiscard]] Element *find(int const id) const { return get(handle(id)); }
+  [[nodiscard]] bool contains(int const id) const { return handle(id).valid(); }
+
+  // Ruft function für jedes Element mit dessen konkreter Art auf, in der Reihenfolge Schläger, Bälle, Steine.
+  template<typename Function>//
+  void for_each(Function &&function) const
+  {
+    m_paddles.for_each(function);
+    m_balls.for_each(function);
+    m_bricks.for_each(function);
+  }
+
+  [[nodiscard]] ElementPool<Paddle> const &paddles() const { return m_paddles; }
+  [[nodiscard]] ElementPool<Ball> const &balls() const { return m_balls; }
+  [[nodiscard]] ElementPool<Brick> const &bricks() const { return m_bricks; }
+
+  [[nodiscard]] std::size_t size() const { return m_paddles.size() + m_balls.size() + m_bricks.size(); }
+
+  [[nodiscard]] std::size_t count(ElementType const kind) const
+  {
+    switch (kind) {
+    case BALL:
+      return m_balls.size();
+    case BRICK:
+      return m_bricks.size();
+    case PADDLE:
+      break;
+    }
+    return m_paddles.size();
+  }
 
-    auto vel = ball->velocity();
+  // Wird bei jeder Änderung einer Haltbarkeit mitgezählt, auch durch Updates der Gegenstelle und Rollbacks.
+  [[nodiscard]] std::size_t live_bricks() const { return m_brick_tally.live; }
+  // Wird wie live_bricks bei jeder Änderung nachgeführt, siehe state_hash in state_hash.hpp.
+  [[nodiscard]] std::uint64_t bricks_hash() const { return m_brick_tally.hash; }
 
-    net_ball->set_velocity_x(vel.x);
-    net_ball->set_velocity_y(vel.y);
+  // Schaltet die Körper der seit dem letzten Aufruf zerstörten Steine ab. Nicht während b2World::Step aufrufen.
+  void disable_destroyed_bricks()
+  {
+    for (auto *brick : m_brick_tally.destroyed) { (void)brick->exists(); }
+    m_brick_tally.destroyed.clear();
+  }
+
+  // Für Schnittstellen, die eine Liste von Elementen erwarten, z. B. fill_game_update.
+  [[nodiscard]] std::vector<Element *> values() const
+  {
+    std::vector<Element *> elements;
+    elements.reserve(size());
+    for_each([&elements](Element &element) { elements.push_back(&element); });
+    return elements;
+  }
+
+  void clear()
+  {
+    m_bricks.clear();
+    m_balls.clear();
+    m_paddles.clear();
+    m_handles.clear();
+    m_brick_tally.live = 0;
+    m_brick_tally.destroyed.clear();
+    m_brick_tally.hash = 0;
+    m_ids = IdGenerator{ 0 };
+  }
+};
+
+// Positionen liegen mit etwas Rand im Spielfeld; die Auflösungen sind Zweierpotenzen, damit 0 exakt darstellbar ist.
+[[nodiscard]] connection::Quantization wire_quantization(float const position_precision = 1.0F / 64.0F,
+  float const velocity_precision = 1.0F / 1024.0F,
+  float const max_velocity = 16.0F)
+{
+  float constexpr margin{ 16.0F };
+  return { { -margin, canvas_width + margin, position_precision },
+    { -margin, canvas_height + margin, position_precision },
+    { -max_velocity, max_velocity, velocity_precision } };
+}
+
+// Zustand eines Elements unabhängig vom Übertragungsformat, siehe codec.hpp. Nicht benötigte Felder bleiben 0.
+struct ElementState
+{
+  int id{ 0 };
+  ElementType type{ BALL };
+  float x{ 0.0F }, y{ 0.0F };
+  float velocity_x{ 0.0F }, velocity_y{ 0.0F };// Ball
+  int duration{ 0 };// Stein
+  int score{ 0 };// Schläger
+  bool controlled_by_sender{ false };// Schläger
+};
+
+[[nodiscard]] ElementState capture_element_state(Element const *element)
+{
+  ElementState state;
+  auto const position = element->center_position();
+  state.id = element->id();
+  state.type = element->get_type();
+  state.x = position.x;
+  state.y = position.y;
+
+  if (state.type == BALL) {
+    auto const velocity = element_cast<Ball>(element)->velocity();
+    state.velocity_x = velocity.x;
+    state.velocity_y = velocity.y;
+  } else if (state.type == BRICK) {
+    state.duration = element_cast<Brick>(element)->duration();
+  } else if (state.type == PADDLE) {
+    auto const *paddle = element_cast<Paddle>(element);
+    state.score = paddle->score();
+    state.controlled_by_sender = paddle->is_controlled_by_this_game_instance();
+  }
+
+  return state;
+}
 
-    game_element->set_allocated_ball(net_ball);
-  } else if (element->get_type() == BRICK) {
-    auto const *brick = dynamic_cast<const Brick *>(element);
-    auto *net_brick = new NetBrick;
+// Leer, wenn das GameElement keine Art trägt.
+[[nodiscard]] std::optional<ElementState> element_state(GameElement const &net_element)
+{
+  ElementState state;
+  state.id = net_element.id();
+  state.x = net_element.element_position().x();
+  state.y = net_element.element_position().y();
+
+  if (net_element.has_ball()) {
+    state.type = BALL;
+    state.velocity_x = net_element.ball().velocity_x();
+    state.velocity_y = net_element.ball().velocity_y();
+  } else if (net_element.has_brick()) {
+    state.type = BRICK;
+    state.duration = net_element.brick().duration();
+  } else if (net_element.has_paddle()) {
+    state.type = PADDLE;
+    state.score = net_element.paddle().score();
+    state.controlled_by_sender = net_element.paddle().controlled_by_sender();
+  } else {
+    return std::nullopt;
+  }
 
-    net_brick->set_duration(brick->duration());
+  return state;
+}
+
+// Die Felder der Art werden nur übernommen, wenn sie zur Art des Elements passt.
+void apply_element_state(Element &element, ElementState const &state)
+{
+  Vector const position{ state.x, state.y };
+  bool const same_type = element.get_type() == state.type;
+
+  visit_element(element,
+    overloaded{ [&](Ball &ball) {
+                 ball.set_position(position);
+                 if (same_type) { ball.set_velocity({ state.velocity_x, state.velocity_y }); }
+               },
+      [&](Brick &brick) {
+        brick.set_position(position);
+        if (same_type) { brick.set_duration(state.duration); }
+      },
+      [&](Paddle &paddle) {
+        paddle.set_position(position);
+        if (same_type) {
+          paddle.set_is_controlled_by_this_game_instance(!state.controlled_by_sender);
+          paddle.set_score(state.score);
+        }
+      } });
+}
 
-    game_element->set_allocated_brick(net_brick);
-  } else if (element->get_type() == PADDLE) {
-    auto const *paddle = dynamic_cast<const Paddle *>(element);
-    auto *net_paddle = new NetPaddle;
+// Legt das Element bei unbekannter id an, sonst wird es aktualisiert.
+void apply_element_state(ElementStore &elements, ElementState const &state, b2World *world)
+{
+  if (!ElementStore::valid_id(state.id)) { return; }
 
-    net_paddle->set_controlled_by_sender(paddle->is_controlled_by_this_game_instance());
-    net_paddle->set_score(paddle->score());
+  auto *element = elements.find(state.id);
+  if (element == nullptr) {
+    Vector const position{ state.x, state.y };
 
-    game_element->set_allocated_paddle(net_paddle);
+    if (state.type == BALL) {
+      element =
+        &elements.emplace_with_id<Ball>(state.id, position, world, Vector{ state.velocity_x, state.velocity_y });
+    } else if (state.type == BRICK) {
+      element = &elements.emplace_with_id<Brick>(state.id, position, world, state.duration);
+    } else {
+      element = &elements.emplace_with_id<Paddle>(state.id, position, world);
+    }
   }
+
+  apply_element_state(*element, state);
+}
+
+void fill_game_element(GameElement *const &game_element, arkanoid::Element const *element)
+{
+  // Über die mutable_-Zugriffe liegen alle Teilnachrichten auf derselben Arena wie game_element, falls es eine hat.
+  auto *position = game_element->mutable_element_position();
+  game_element->set_id(element->id());
+
+  auto set_position = [position](Vector const pos) {
+    position->set_x(pos.x);
+    position->set_y(pos.y);
+  };
+
+  visit_element(*element,
+    overloaded{ [&](Ball const &ball) {
+                 set_position(ball.center_position());
+                 auto const vel = ball.velocity();
+                 auto *net_ball = game_element->mutable_ball();
+                 net_ball->set_velocity_x(vel.x);
+                 net_ball->set_velocity_y(vel.y);
+               },
+      [&](Brick const &brick) {
+        set_position(brick.center_position());
+        game_element->mutable_brick()->set_duration(brick.duration());
+      },
+      [&](Paddle const &paddle) {
+        set_position(paddle.center_position());
+        auto *net_paddle = game_element->mutable_paddle();
+        net_paddle->set_controlled_by_sender(paddle.is_controlled_by_this_game_instance());
+        net_paddle->set_score(paddle.score());
+      } });
 }
 
 void fill_game_update(GameUpdate *update, std::vector<arkanoid::Element *> const &elements)
@@ -476,51 +955,13 @@ void fill_game_update(GameUpdate *update, std::vector<arkanoid::Element *> const
 
 void parse_game_element(Element *element, GameElement const &net_element)
 {
-  element->set_position({ net_element.element_position().x(), net_element.element_position().y() });
-  // element->invert_position();
-
-  if (element->get_type() == BALL && net_element.has_ball()) {
-    auto *ball = dynamic_cast<Ball *>(element);
-    ball->set_velocity(
-      arkanoid::Vector{ net_element.ball().velocity_x(), net_element.ball().velocity_y() } /*.invert()*/);
-  } else if (element->get_type() == BRICK && net_element.has_brick()) {
-    auto *brick = dynamic_cast<Brick *>(element);
-    brick->m_duration = net_element.brick().duration();
-  } else if (element->get_type() == PADDLE && net_element.has_paddle()) {
-    auto *paddle = dynamic_cast<Paddle *>(element);
-    paddle->set_is_controlled_by_this_game_instance(!net_element.paddle().controlled_by_sender());
-    paddle->m_score = net_element.paddle().score();
-  }
+  if (auto const state = element_state(net_element)) { apply_element_state(*element, *state); }
 }
 
-void parse_game_update(std::map<int, std::unique_ptr<Element>> &map,
-  GameUpdate const &update,
-  b2World *world,
-  std::map<b2Fixture *, arkanoid::Element *> &b2_map)
+void parse_game_update(ElementStore &elements, GameUpdate const &update, b2World *world)
 {
-  for (int i = 0; i < update.element_size(); ++i) {
-    auto const net_element = update.element(i);
-    Vector position{ net_element.element_position().x(), net_element.element_position().y() };
-
-    bool new_id{ !map.contains(net_element.id()) };
-
-    if (new_id) {
-      std::unique_ptr<Element> arkanoid_element_ptr = nullptr;
-
-      if (net_element.has_ball()) {
-        arkanoid_element_ptr = std::make_unique<Ball>(
-          position, world, b2_map, Vector{ net_element.ball().velocity_x(), net_element.ball().velocity_y() });
-      } else if (net_element.has_brick()) {
-        arkanoid_element_ptr = std::make_unique<Brick>(position, world, b2_map, net_element.brick().duration());
-      } else if (net_element.has_paddle()) {
-        arkanoid_element_ptr = std::make_unique<Paddle>(position, world, b2_map);
-      }
-      arkanoid_element_ptr->m_id = net_element.id();
-      parse_game_element(arkanoid_element_ptr.get(), net_element);
-      insert_element(map, arkanoid_element_ptr);
-    } else {
-      parse_game_element(map.find(net_element.id())->second.get(), net_element);
-    }
+  for (auto const &net_element : update.element()) {
+    if (auto const state = element_state(net_element)) { apply_element_state(elements, *state, world); }
   }
 }
 
@@ -0,0 +1,314 @@
+#ifndef ARKANOID_GAME_CPP
+#define ARKANOID_GAME_CPP
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <random>
+#include <utility>
+
+#include "box2d-incl/box2d/b2_body.h"
+#include "box2d-incl/box2d/b2_contact.h"
+#include "box2d-incl/box2d/b2_fixture.h"
+#include "box2d-incl/box2d/b2_polygon_shape.h"
+#include "box2d-incl/box2d/b2_world.h"
+#include "box2d-incl/box2d/b2_world_callbacks.h"
+
+#include "arkanoid_elements.hpp"
+#include "events.hpp"
+#include "utils.hpp"
+
+// Gleicher seed, gleiche Steine: Im Lockstep erzeugen beide Seiten die Partie daraus, statt sie zu übertragen. Setzt
+// dieselbe Standardbibliothek auf beiden Seiten voraus, da die Verteilungen dort implementiert sind.
+void generate_bricks(arkanoid::ElementStore &elements, b2World *world, std::uint32_t const seed)
+{
+  using namespace arkanoid;
+  std::default_random_engine random_engine{ seed };
+  std::uniform_int_distribution<int> uni_dist{ brick_min_duration, brick_max_duration };
+
+  int const num_bricks_x =
+    (playing_field_right - playing_field_left - brick_distance_x) / (brick_width + brick_distance_x);
+
+  int const total_brick_height = (num_bricks_y * (brick_height + brick_distance_y)) + brick_distance_y;
+  int const total_brick_width = (num_bricks_x * (brick_width + brick_distance_x)) - brick_distance_x;
+  int const top = std::round(((playing_field_bottom - playing_field_top) / 2.0F) - (total_brick_height / 2.0F));
+  int const left = std::round(((playing_field_right - playing_field_left) - total_brick_width) / 2.0F);
+
+  for (int i_x{ 0 }; i_x < num_bricks_x; ++i_x) {
+    for (int i_y{ 0 }; i_y < num_bricks_y; ++i_y) {
+
+      int const x{ playing_field_left + left + ((brick_distance_x + brick_width) * i_x) };
+      int const y{ playing_field_top + top + ((brick_distance_y + brick_height) * i_y) };
+
+      elements.emplace<arkanoid::Brick>(arkanoid::Vector{ x, y }, world, uni_dist(random_engine));
+    }
+  }
+}
+
+void generate_arkanoid_elements(arkanoid::Vector const paddle_position,
+  int const paddle_y,
+  arkanoid::Vector const ball_position_add,
+  arkanoid::Vector const ball_velocity,
+  b2World *arkanoid_world,
+  arkanoid::ElementStore &element_map,
+  std::uint32_t const brick_seed = std::random_device{}())
+{
+  using namespace arkanoid;
+
+  auto &paddle = element_map.emplace<Paddle>(paddle_position, arkanoid_world);
+  paddle.set_is_controlled_by_this_game_instance(true);
+
+  auto &paddle_enemy =
+    element_map.emplace<Paddle>(paddle_position.sub(0, paddle_y).add(0, playing_field_top), arkanoid_world);
+  paddle_enemy.set_is_controlled_by_this_game_instance(false);
+
+  element_map.emplace<Ball>(paddle_position.add(ball_position_add), arkanoid_world, ball_velocity);
+  element_map.emplace<Ball>(
+    paddle_position.sub(0, paddle_y).add(0, playing_field_top).add({ ball_position_add.x, -ball_position_add.y }),
+    arkanoid_world,
+    ball_velocity.invert());
+
+  generate_bricks(element_map, arkanoid_world, brick_seed);
+}
+
+
+class ContactListener : public b2ContactListener
+{
+private:
+  // Rückwände und der Schläger, dem ein Treffer dort Punkte kostet. Sie gehören zu keinem Element.
+  std::array<std::pair<b2Fixture *, arkanoid::Paddle *>, 2> m_back_plates{};
+  arkanoid::EventLog *m_events{ nullptr };
+
+  void BackPlateHit(arkanoid::Paddle *const paddle)
+  {
+    if (m_events != nullptr) {
+      m_events->score_delta(*paddle, -5);
+    } else {
+      paddle->add_score(-5);
+    }
+  }
+
+  void UpdateElementsAfterContact(arkanoid::Element *first_element_ptr, arkanoid::Element *secound_element_ptr)
+  {
+    using namespace arkanoid;
+
+    if (first_element_ptr->get_type() == secound_element_ptr->get_type()) { return; }
+
+    auto *brick_ptr = element_cast_either<Brick>(first_element_ptr, secound_element_ptr);
+    auto *ball_ptr = element_cast_either<Ball>(first_element_ptr, secound_element_ptr);
+    auto *paddle_ptr = element_cast_either<Paddle>(first_element_ptr, secound_element_ptr);
+
+
+    if (brick_ptr != nullptr && ball_ptr != nullptr) {
+      auto *last_paddle = ball_ptr->last_paddle();
+
+      if (m_events != nullptr) {
+        // Gezählt und gemeldet wird nur vom Spieler, der den Ball zuletzt gespielt hat; die Gegenstelle übernimmt
+        // den Treffer aus dem BrickHit, statt ihn vorherzusagen. Den Abprall am Stein berechnen beide selbst.
+        if (last_paddle != nullptr && last_paddle->is_controlled_by_this_game_instance() && brick_ptr->hit(ball_ptr)) {
+          m_events->brick_hit(*brick_ptr, *last_paddle);
+        }
+      } else {
+        bool const counted = brick_ptr->hit(ball_ptr);
+        if (counted && brick_ptr->duration() <= 0) {
+          brick_ptr->add_to_next_update();
+          ball_ptr->add_to_next_update();
+        }
+        if (last_paddle != nullptr) { last_paddle->add_score(1); }
+      }
+    }
+    if (ball_ptr != nullptr && paddle_ptr != nullptr) {
+      if (paddle_ptr->is_controlled_by_this_game_instance()) {
+        ball_ptr->set_last_paddle(paddle_ptr);
+        ball_ptr->add_to_next_update();
+      }
+    }
+  }
+
+
+  [[nodiscard]] arkanoid::Paddle *back_plate_owner(b2Fixture const *fixture) const
+  {
+    for (auto const &[plate, paddle] : m_back_plates) {
+      if (plate == fixture) { return paddle; }
+    }
+    return nullptr;
+  }
+
+  void CheckIfBackPlateWasHit(b2Fixture *fixture_a, b2Fixture *fixture_b)
+  {
+    arkanoid::Paddle *paddle_ptr{ nullptr };
+    arkanoid::Ball *ball_ptr{ nullptr };
+    if (auto *owner = back_plate_owner(fixture_a)) {
+      paddle_ptr = owner;
+      ball_ptr = arkanoid::element_cast<arkanoid::Ball>(arkanoid::element_of(fixture_b));
+    } else if (auto *owner_b = back_plate_owner(fixture_b)) {
+      paddle_ptr = owner_b;
+      ball_ptr = arkanoid::element_cast<arkanoid::Ball>(arkanoid::element_of(fixture_a));
+    }
+
+    if (paddle_ptr != nullptr && ball_ptr != nullptr && ball_ptr->last_paddle() != nullptr
+        && ball_ptr->last_paddle()->is_controlled_by_this_game_instance()) {
+      BackPlateHit(paddle_ptr);
+    }
+  }
+
+public:
+  // Eine bereits zugeordnete Rückwand behält ihren Schläger.
+  void add_back_plate(b2Fixture *const fixture, arkanoid::Paddle *const paddle)
+  {
+    if (back_plate_owner(fixture) != nullptr) { return; }
+    for (auto &plate : m_back_plates) {
+      if (plate.first == nullptr) {
+        plate = { fixture, paddle };
+        return;
+      }
+    }
+  }
+
+  // Mit einem EventLog werden Treffer und Punkte als Ereignisse gemeldet, statt die betroffenen Elemente vollständig
+  // zu senden. Bälle gehen nach einem Abprall am eigenen Schläger in beiden Fällen als Element mit.
+  void set_event_log(arkanoid::EventLog *const events) { m_events = events; }
+
+
+  void PreSolve(b2Contact *contact, const b2Manifold *oldManifold) override
+  {
+    contact->SetFriction(0.0F);
+    contact->SetRestitution(1.0F);
+    contact->SetTangentSpeed(0.5F);
+  }
+
+  void EndContact(b2Contact *contact) override { EndContact(contact->GetFixtureA(), contact->GetFixtureB()); }
+
+  // Auch für Berührungen, deren Kontakt es nicht mehr gibt, siehe WorldSnapshot::restore_contacts.
+  void EndContact(b2Fixture *fixture_a, b2Fixture *fixture_b)
+  {
+    auto *element_a = arkanoid::element_of(fixture_a);
+    auto *element_b = arkanoid::element_of(fixture_b);
+    if (element_a != nullptr && element_b != nullptr) {
+      UpdateElementsAfterContact(element_a, element_b);
+      return;
+    }
+
+    CheckIfBackPlateWasHit(fixture_a, fixture_b);
+  }
+};
+
+std::array<b2Fixture *, 2> build_b2_world_border(b2World *world)
+{
+  int const playing_field_width = arkanoid::playing_field_right - arkanoid::playing_field_left;
+  int const playing_field_height = arkanoid::playing_field_bottom - arkanoid::playing_field_top;
+
+
+  auto generate = [&world](float const x, float const y, float width, float height) {
+    auto const position = arkanoid::convert_to_b2_coords(arkanoid::Vector{ x, y });
+    width *= arkanoid::b2_coord_convertion_rate;
+    height *= arkanoid::b2_coord_convertion_rate;
+
+    b2BodyDef def;
+    def.position.Set(position.x, position.y);
+    b2Body *body = world->CreateBody(&def);
+    b2PolygonShape box;
+    box.SetAsBox(width, height);
+    return body->CreateFixture(&box, 1.0f);
+  };
+
+  // links
+  generate(arkanoid::playing_field_left - 2, arkanoid::playing_field_top - 12, 1, playing_field_height + 24);
+  // rechts
+  generate(arkanoid::playing_field_right + 1, arkanoid::playing_field_top - 12, 1, playing_field_height + 24);
+  // oben
+  auto *const fix_1 =
+    generate(arkanoid::playing_field_left - 2, arkanoid::playing_field_top - 11, playing_field_width + 4, 1);
+  // unten
+  auto *const fix_2 =
+    generate(arkanoid::playing_field_left - 2, arkanoid::playing_field_bottom + 10, playing_field_width + 4, 1);
+
+  return { fix_1, fix_2 };
+}
+
+[[nodiscard]] bool find_paddle_ptrs(std::array<arkanoid::Paddle *, 2> &paddle_ptrs,
+  std::array<b2Fixture *, 2> const &back_plates,
+  arkanoid::ElementStore const &element_map,
+  ContactListener &listener)
+{
+  using namespace arkanoid;
+  if (paddle_ptrs[0] == nullptr || paddle_ptrs[1] == nullptr) {
+    if (!element_map.paddles().empty()) {
+      element_map.paddles().for_each([&paddle_ptrs](Paddle &paddle) {
+        paddle_ptrs[paddle.is_controlled_by_this_game_instance() ? 0 : 1] = &paddle;
+      });
+
+      if (paddle_ptrs[0] != nullptr && paddle_ptrs[1] != nullptr && back_plates[0] != nullptr
+          && back_plates[1] != nullptr) {
+        auto const distance_paddle_0_to_plate_0 =
+          std::abs(arkanoid::convert_to_arkanoid_coords(back_plates[0]->GetBody()->GetPosition()).y
+                   - paddle_ptrs[0]->center_position().y);
+        auto const distance_paddle_1_to_plate_0 =
+          std::abs(arkanoid::convert_to_arkanoid_coords(back_plates[0]->GetBody()->GetPosition()).y
+                   - paddle_ptrs[1]->center_position().y);
+        if (distance_paddle_0_to_plate_0 <= distance_paddle_1_to_plate_0) {
+          listener.add_back_plate(back_plates[0], paddle_ptrs[0]);
+          listener.add_back_plate(back_plates[1], paddle_ptrs[1]);
+        } else {
+          listener.add_back_plate(back_plates[0], paddle_ptrs[1]);
+          listener.add_back_plate(back_plates[1], paddle_ptrs[0]);
+        }
+      }
+    }
+  }
+
+  return paddle_ptrs[0] != nullptr;
+}
+
+void update_paddle_position(arkanoid::Paddle *paddle_ptr, int const mouse_x)
+{
+  using namespace arkanoid;
+  int new_paddle_x = mouse_x;
+  int const half_width = paddle_ptr->width() / 2;
+  std::pair<int, int> constrains{ playing_field_left + half_width, playing_field_right - half_width };
+
+  if (new_paddle_x < constrains.first) { new_paddle_x = constrains.first; }
+  if (new_paddle_x > constrains.second) { new_paddle_x = constrains.second; }// todo: auslagern
+  paddle_ptr->update_x(new_paddle_x);
+}
+
+// Eingabe eines einfachen Bots: folgt dem Ball, der dem Schläger am nächsten ist.
+[[nodiscard]] int bot_input(arkanoid::ElementStore const &elements, arkanoid::Paddle const &paddle)
+{
+  auto const position = paddle.center_position();
+  float nearest_distance{ std::numeric_limits<float>::max() };
+  float target_x{ position.x };
+
+  elements.balls().for_each([&](arkanoid::Ball const &element) {
+    auto const ball = element.center_position();
+    if (std::abs(ball.y - position.y) < nearest_distance) {
+      nearest_distance = std::abs(ball.y - position.y);
+      target_x = ball.x;
+    }
+  });
+
+  return static_cast<int>(std::lround(target_x));
+}
+
+// Kostet nur einen Vergleich und kann daher jeden Tick aufgerufen werden.
+[[nodiscard]] int get_winner(arkanoid::ElementStore const &elements, std::array<arkanoid::Paddle *, 2> const &paddles)
+{
+  if (elements.live_bricks() == 0) {
+    if (paddles[0] != nullptr && paddles[1] != nullptr) {
+      if (paddles[0]->score() > paddles[1]->score()) {
+        return 0;
+      } else if (paddles[0]->score() < paddles[1]->score()) {
+        return 1;
+      }
+
+      return paddles.max_size();
+    }
+  }
+
+  return -1;
+}
+
+#endif
@@ -0,0 +1,118 @@
+#ifndef AUTHORITATIVE_MATCH_CPP
+#define AUTHORITATIVE_MATCH_CPP
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "box2d-incl/box2d/b2_world.h"
+
+#include "arkanoid.pb.h"
+#include "arkanoid_elements.hpp"
+#include "arkanoid_game.hpp"
+#include "utils.hpp"
+
+namespace arkanoid {
+
+// Eine Partie ohne Bildschirm, deren beide Schläger über Eingaben der Spieler gesteuert werden. Spieler 0 spielt
+// unten, Spieler 1 oben. Die Spielregeln gelten für beide Seiten, daher zählen alle Schläger als lokal gesteuert.
+// Teilt keinen Zustand mit anderen Partien; Erzeugen und step() dürfen parallel zu anderen Partien laufen.
+class AuthoritativeMatch
+{
+private:
+  b2World m_world{ { 0, 0 } };
+  ElementStore m_elements;
+  ContactListener m_listener;
+  std::array<Paddle *, 2> m_paddles{ nullptr, nullptr };
+  std::array<std::atomic<int>, 2> m_inputs{};
+  std::vector<Element *> m_updated;
+  long m_tick{ 0 };
+  int m_winner{ -1 };
+
+public:
+  // Gleicher seed, gleiche Steine; für wiederholbare Läufe, siehe BatchRunner.
+  explicit AuthoritativeMatch(std::uint32_t const brick_seed = std::random_device{}())
+  {
+    int const paddle_y{ playing_field_bottom - paddle_height };
+    Vector const paddle_position{ (canvas_width / 2) - (paddle_width / 2), paddle_y };
+
+    m_world.SetContactListener(&m_listener);
+    auto const back_plates = build_b2_world_border(&m_world);
+    generate_arkanoid_elements(paddle_position,
+      { playing_field_bottom - paddle_height },
+      { paddle_width / 2, -10 },
+      { ball_velocity_x, ball_velocity_y },
+      &m_world,
+      m_elements,
+      brick_seed);
+
+    m_elements.paddles().for_each(
+      [this](Paddle &paddle) { m_paddles[paddle.is_controlled_by_this_game_instance() ? 0 : 1] = &paddle; });
+    for (auto *paddle : m_paddles) { paddle->set_is_controlled_by_this_game_instance(true); }
+
+    m_listener.add_back_plate(back_plates[0], m_paddles[1]);// oben
+    m_listener.add_back_plate(back_plates[1], m_paddles[0]);// unten
+
+    for (std::size_t player{ 0 }; player < m_paddles.size(); ++player) {
+      m_inputs[player] = m_paddles[player]->center_position().x_i();
+    }
+  }
+
+  AuthoritativeMatch(AuthoritativeMatch const &) = delete;
+  AuthoritativeMatch &operator=(AuthoritativeMatch const &) = delete;
+
+  // Darf von beliebigen Threads aufgerufen werden; wirkt ab dem nächsten Tick.
+  void set_input(int const player, int const mouse_x) { m_inputs[static_cast<std::size_t>(player)] = mouse_x; }
+
+  // Berechnet einen Tick; danach enthält updated_elements() alle Elemente, die sich geändert haben.
+  void step(int const frame_rate)
+  {
+    m_updated.clear();
+
+    for (std::size_t player{ 0 }; player < m_paddles.size(); ++player) {
+      update_paddle_position(m_paddles[player], m_inputs[player]);
+    }
+
+    m_world.Step(1.0F / static_cast<float>(frame_rate), 4, 2);
+
+    m_elements.for_each([this](auto &element) {
+      if (element.did_update()) { m_updated.push_back(&element); }
+    });
+
+    m_elements.disable_destroyed_bricks();
+    m_winner = get_winner(m_elements, m_paddles);
+    ++m_tick;
+  }
+
+  // Zustand aus Sicht eines Spielers: nur dessen Schläger gilt beim Empfänger als selbst gesteuert.
+  void fill_update(GameUpdate &update, int const player, bool const full) const
+  {
+    update.set_tick(m_tick);
+    fill_game_update(&update, full ? m_elements.values() : m_updated);
+
+    int const own_paddle_id = m_paddles[static_cast<std::size_t>(player)]->id();
+    for (auto &element : *update.mutable_element()) {
+      if (element.has_paddle()) { element.mutable_paddle()->set_controlled_by_sender(element.id() != own_paddle_id); }
+    }
+  }
+
+  // Eingabe eines einfachen Bots, siehe ::bot_input.
+  [[nodiscard]] int bot_input(int const player) const
+  {
+    return ::bot_input(m_elements, *m_paddles[static_cast<std::size_t>(player)]);
+  }
+
+  [[nodiscard]] std::vector<Element *> const &updated_elements() const { return m_updated; }
+  [[nodiscard]] bool finished() const { return m_winner >= 0; }
+  [[nodiscard]] int winner() const { return m_winner; }
+  [[nodiscard]] long tick() const { return m_tick; }
+  [[nodiscard]] int score(int const player) const { return m_paddles[static_cast<std::size_t>(player)]->score(); }
+  [[nodiscard]] std::size_t live_bricks() const { return m_elements.live_bricks(); }
+};
+
+}// namespace arkanoid
+
+#endif
@@ -0,0 +1,205 @@
+#ifndef BATCH_CPP
+#define BATCH_CPP
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include "arkanoid_elements.hpp"
+#include "authoritative_match.hpp"
+
+namespace arkanoid {
+
+// Verteilt unabhängige Aufgaben auf mehrere Threads. Jeder Thread arbeitet seine eigene Warteschlange von hinten ab
+// und stiehlt erst, wenn sie leer ist, von vorn aus den Warteschlangen der anderen. Unterschiedlich lange Aufgaben
+// gleichen sich so aus, ohne dass sich die Threads im Normalfall eine Sperre teilen.
+class WorkStealingScheduler
+{
+private:
+  struct alignas(64) Worker
+  {
+    std::mutex mutex;
+    std::deque<std::size_t> tasks;
+    std::size_t executed{ 0 }, stolen{ 0 };
+    double busy_ms{ 0 };
+  };
+
+  std::vector<std::unique_ptr<Worker>> m_workers;
+
+  [[nodiscard]] std::optional<std::size_t> pop(Worker &worker)
+  {
+    std::lock_guard<std::mutex> lock{ worker.mutex };
+    if (worker.tasks.empty()) { return std::nullopt; }
+
+    auto const task = worker.tasks.back();
+    worker.tasks.pop_back();
+    return task;
+  }
+
+  [[nodiscard]] std::optional<std::size_t> steal(std::size_t const thief)
+  {
+    for (std::size_t offset{ 1 }; offset < m_workers.size(); ++offset) {
+      auto &victim = *m_workers[(thief + offset) % m_workers.size()];
+      std::lock_guard<std::mutex> lock{ victim.mutex };
+      if (victim.tasks.empty()) { continue; }
+
+      auto const task = victim.tasks.front();
+      victim.tasks.pop_front();
+      return task;
+    }
+    return std::nullopt;
+  }
+
+public:
+  explicit WorkStealingScheduler(std::size_t const threads)
+  {
+    for (std::size_t i{ 0 }; i < std::max<std::size_t>(threads, 1); ++i) {
+      m_workers.push_back(std::make_unique<Worker>());
+    }
+  }
+
+  // Ruft task(index, thread) für alle index von 0 bis count - 1 auf und kehrt zurück, wenn alle erledigt sind. Da
+  // keine Aufgaben nachkommen, endet ein Thread, sobald er weder bei sich noch bei anderen etwas findet.
+  template<typename Task>//
+  void run(std::size_t const count, Task &&task)
+  {
+    for (auto &worker : m_workers) {
+      worker->tasks.clear();
+      worker->executed = worker->stolen = 0;
+      worker->busy_ms = 0;
+    }
+    // Aufeinanderfolgende Aufgaben landen beim selben Thread, gestohlen wird vom anderen Ende.
+    for (std::size_t index{ 0 }; index < count; ++index) {
+      m_workers[index * m_workers.size() / count]->tasks.push_front(index);
+    }
+
+    auto work = [this, &task](std::size_t const thread) {
+      auto &self = *m_workers[thread];
+      auto const start = std::chrono::steady_clock::now();
+      while (true) {
+        auto index = pop(self);
+        if (!index) {
+          index = steal(thread);
+          if (!index) { break; }
+          ++self.stolen;
+        }
+        task(*index, thread);
+        ++self.executed;
+      }
+      self.busy_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    };
+
+    std::vector<std::thread> threads;
+    for (std::size_t thread{ 1 }; thread < m_workers.size(); ++thread) { threads.emplace_back(work, thread); }
+    work(0);
+    for (auto &thread : threads) { thread.join(); }
+  }
+
+  [[nodiscard]] std::size_t threads() const { return m_workers.size(); }
+  [[nodiscard]] std::size_t executed(std::size_t const thread) const { return m_workers[thread]->executed; }
+  [[nodiscard]] std::size_t stolen(std::size_t const thread) const { return m_workers[thread]->stolen; }
+  [[nodiscard]] double busy_ms(std::size_t const thread) const { return m_workers[thread]->busy_ms; }
+};
+
+// Ausgang einer Partie zwischen zwei Bots. Endet sie nicht bis max_ticks, entscheiden die Punkte.
+struct BatchResult
+{
+  std::uint32_t seed{ 0 };
+  int winner{ -1 };// 0 unten, 1 oben, 2 unentschieden
+  bool finished{ false };// alle Steine zerstört
+  long ticks{ 0 };
+  std::array<int, 2> scores{};
+  std::size_t bricks_left{ 0 };
+};
+
+struct BatchSummary
+{
+  std::size_t matches{ 0 }, finished{ 0 };
+  std::array<std::size_t, 3> outcomes{};// Siege unten, Siege oben, unentschieden
+  long ticks{ 0 };
+  std::array<long, 2> scores{};
+  std::size_t bricks_left{ 0 };
+  std::uint64_t checksum{ 0 };// hängt nur von den Ergebnissen ab, nicht von der Zahl der Threads
+
+  void add(BatchResult const &result)
+  {
+    ++matches;
+    finished += result.finished ? 1 : 0;
+    ++outcomes[static_cast<std::size_t>(std::clamp(result.winner, 0, 2))];
+    ticks += result.ticks;
+    scores[0] += result.scores[0];
+    scores[1] += result.scores[1];
+    bricks_left += result.bricks_left;
+
+    auto const outcome = (static_cast<std::uint64_t>(result.winner + 1) << 56U)
+                         ^ (static_cast<std::uint64_t>(result.ticks) << 24U)
+                         ^ static_cast<std::uint64_t>(result.scores[0] * 4096 + result.scores[1]);
+    checksum = hash_mix(checksum ^ outcome);
+  }
+};
+
+// Spielt Partien zwischen zwei Bots parallel. Jede Partie hat ihre eigene b2World, ihren ElementStore und ihren
+// ContactListener (siehe AuthoritativeMatch), daher teilen sich die Threads nur die Ergebnisliste, in die jede Partie
+// an ihren eigenen Platz schreibt. Partie i verwendet den seed first_seed + i; dieselben Argumente ergeben bei jeder
+// Zahl von Threads dieselben Ergebnisse.
+class BatchRunner
+{
+private:
+  WorkStealingScheduler m_scheduler;
+  std::vector<BatchResult> m_results;
+  double m_seconds{ 0 };
+
+public:
+  explicit BatchRunner(std::size_t const threads) : m_scheduler{ threads } {}
+
+  [[nodiscard]] static BatchResult play(std::uint32_t const seed, int const frame_rate, long const max_ticks)
+  {
+    AuthoritativeMatch match{ seed };
+    while (!match.finished() && match.tick() < max_ticks) {
+      match.set_input(0, match.bot_input(0));
+      match.set_input(1, match.bot_input(1));
+      match.step(frame_rate);
+    }
+
+    BatchResult result{ seed, match.winner(), match.finished(), match.tick(), { match.score(0), match.score(1) } };
+    result.bricks_left = match.live_bricks();
+    if (!result.finished) {
+      result.winner = result.scores[0] > result.scores[1] ? 0 : result.scores[0] < result.scores[1] ? 1 : 2;
+    }
+    return result;
+  }
+
+  void run(std::size_t const matches, std::uint32_t const first_seed, int const frame_rate, long const max_ticks)
+  {
+    m_results.assign(matches, {});
+    auto const start = std::chrono::steady_clock::now();
+    m_scheduler.run(matches, [&](std::size_t const index, std::size_t /*thread*/) {
+      m_results[index] = play(first_seed + static_cast<std::uint32_t>(index), frame_rate, max_ticks);
+    });
+    m_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  }
+
+  // In der Reihenfolge der seeds, damit die Prüfsumme nicht von der Verteilung auf die Threads abhängt.
+  [[nodiscard]] BatchSummary summary() const
+  {
+    BatchSummary summary;
+    for (auto const &result : m_results) { summary.add(result); }
+    return summary;
+  }
+
+  [[nodiscard]] std::vector<BatchResult> const &results() const { return m_results; }
+  [[nodiscard]] WorkStealingScheduler const &scheduler() const { return m_scheduler; }
+  [[nodiscard]] double seconds() const { return m_seconds; }
+};
+
+}// namespace arkanoid
+
+#endif
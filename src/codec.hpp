@@ -0,0 +1,206 @@
+#ifndef CODEC_CPP
+#define CODEC_CPP
+
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "box2d-incl/box2d/b2_world.h"
+
+#include "arkanoid.pb.h"
+#include "arkanoid_elements.hpp"
+#include "update_arena.hpp"
+#include "utils.hpp"
+
+namespace arkanoid {
+
+// Schnittstelle der Codecs: encode schreibt den Zustand der Elemente nach out, decode ruft für jedes gelesene
+// Element visit(ElementState const &) auf. decode liefert false für ungültige Daten; bereits besuchte Elemente
+// bleiben dann übernommen.
+template<typename C>//
+concept Codec = requires(C &codec,
+  std::int64_t const tick,
+  std::vector<Element *> const &elements,
+  std::string &out,
+  std::string_view const in,
+  std::int64_t &decoded_tick,
+  void (*visit)(ElementState const &)) {
+  codec.encode(tick, elements, out);
+  { codec.decode(in, decoded_tick, visit) } -> std::same_as<bool>;
+};
+
+// Das bisherige Format: GameUpdate mit einem GameElement je Element. Nachrichten liegen auf wiederverwendeten
+// Arenen, damit auch dieser Weg nach dem ersten Update ohne Heap-Allokationen auskommt.
+class ProtobufCodec
+{
+private:
+  connection::UpdateArena m_encode_arena, m_decode_arena;
+
+public:
+  void encode(std::int64_t const tick, std::vector<Element *> const &elements, std::string &out)
+  {
+    auto &update = m_encode_arena.create();
+    update.set_tick(tick);
+    fill_game_update(&update, elements);
+    update.SerializeToString(&out);
+  }
+
+  template<typename Visitor>//
+  bool decode(std::string_view const in, std::int64_t &tick, Visitor &&visit)
+  {
+    auto &update = m_decode_arena.create();
+    if (!update.ParseFromArray(in.data(), static_cast<int>(in.size()))) { return false; }
+
+    tick = update.tick();
+    for (auto const &net_element : update.element()) {
+      auto const state = element_state(net_element);
+      if (!state) { return false; }
+      visit(*state);
+    }
+
+    return true;
+  }
+};
+
+// Festes Binärformat, das direkt im Empfangspuffer gelesen wird. Little-Endian, ohne Ausrichtung:
+//   Kopf:    magic u32 | Anzahl u32 | tick i64
+//   Element: id i32 | Art u8 | Flags u8 | Haltbarkeit i16 | Punkte i32 | x f32 | y f32 | vx f32 | vy f32
+class FlatCodec
+{
+private:
+  static_assert(std::endian::native == std::endian::little, "FlatCodec schreibt den Speicher unverändert");
+
+  template<typename T>//
+  [[nodiscard]] static T load(char const *data)
+  {
+    T value;
+    std::memcpy(&value, data, sizeof(T));
+    return value;
+  }
+
+  template<typename T>//
+  static void store(char *data, T const value)
+  {
+    std::memcpy(data, &value, sizeof(T));
+  }
+
+public:
+  static std::uint32_t constexpr magic{ 0x314B5241 };// "ARK1"
+  static std::size_t constexpr header_size{ 16 };
+  static std::size_t constexpr element_size{ 28 };
+  static std::uint8_t constexpr controlled_by_sender_flag{ 1U << 0U };
+
+  // Sicht auf ein Element im Puffer; die Felder werden erst beim Zugriff gelesen.
+  class ElementView
+  {
+  private:
+    char const *m_data;
+
+  public:
+    explicit ElementView(char const *data) : m_data{ data } {}
+
+    [[nodiscard]] int id() const { return load<std::int32_t>(m_data); }
+    [[nodiscard]] ElementType type() const { return static_cast<ElementType>(load<std::uint8_t>(m_data + 4)); }
+    [[nodiscard]] bool controlled_by_sender() const
+    {
+      return (load<std::uint8_t>(m_data + 5) & controlled_by_sender_flag) != 0;
+    }
+    [[nodiscard]] int duration() const { return load<std::int16_t>(m_data + 6); }
+    [[nodiscard]] int score() const { return load<std::int32_t>(m_data + 8); }
+    [[nodiscard]] float x() const { return load<float>(m_data + 12); }
+    [[nodiscard]] float y() const { return load<float>(m_data + 16); }
+    [[nodiscard]] float velocity_x() const { return load<float>(m_data + 20); }
+    [[nodiscard]] float velocity_y() const { return load<float>(m_data + 24); }
+  };
+
+  // Sicht auf ein ganzes Update; valid() prüft nur Kopf und Länge, der Inhalt wird nicht kopiert.
+  class UpdateView
+  {
+  private:
+    std::string_view m_data;
+
+  public:
+    explicit UpdateView(std::string_view const data) : m_data{ data } {}
+
+    [[nodiscard]] bool valid() const
+    {
+      return m_data.size() >= header_size && load<std::uint32_t>(m_data.data()) == magic
+             && m_data.size() == header_size + (size() * element_size);
+    }
+    [[nodiscard]] std::size_t size() const { return load<std::uint32_t>(m_data.data() + 4); }
+    [[nodiscard]] std::int64_t tick() const { return load<std::int64_t>(m_data.data() + 8); }
+    [[nodiscard]] ElementView operator[](std::size_t const index) const
+    {
+      return ElementView{ m_data.data() + header_size + (index * element_size) };
+    }
+  };
+
+  static void encode(std::int64_t const tick, std::vector<Element *> const &elements, std::string &out)
+  {
+    out.resize(header_size + (elements.size() * element_size));
+    char *data = out.data();
+    store<std::uint32_t>(data, magic);
+    store<std::uint32_t>(data + 4, static_cast<std::uint32_t>(elements.size()));
+    store<std::int64_t>(data + 8, tick);
+
+    data += header_size;
+    for (auto const *element : elements) {
+      auto const state = capture_element_state(element);
+      store<std::int32_t>(data, state.id);
+      store<std::uint8_t>(data + 4, static_cast<std::uint8_t>(state.type));
+      store<std::uint8_t>(data + 5, state.controlled_by_sender ? controlled_by_sender_flag : 0U);
+      store<std::int16_t>(data + 6, static_cast<std::int16_t>(state.duration));
+      store<std::int32_t>(data + 8, state.score);
+      store<float>(data + 12, state.x);
+      store<float>(data + 16, state.y);
+      store<float>(data + 20, state.velocity_x);
+      store<float>(data + 24, state.velocity_y);
+      data += element_size;
+    }
+  }
+
+  template<typename Visitor>//
+  static bool decode(std::string_view const in, std::int64_t &tick, Visitor &&visit)
+  {
+    UpdateView const view{ in };
+    if (!view.valid()) { return false; }
+
+    tick = view.tick();
+    for (std::size_t i{ 0 }; i < view.size(); ++i) {
+      auto const element = view[i];
+      if (element.type() != BALL && element.type() != BRICK && element.type() != PADDLE) { return false; }
+
+      ElementState state;
+      state.id = element.id();
+      state.type = element.type();
+      state.x = element.x();
+      state.y = element.y();
+      state.velocity_x = element.velocity_x();
+      state.velocity_y = element.velocity_y();
+      state.duration = element.duration();
+      state.score = element.score();
+      state.controlled_by_sender = element.controlled_by_sender();
+      visit(state);
+    }
+
+    return true;
+  }
+};
+
+static_assert(Codec<ProtobufCodec> && Codec<FlatCodec>);
+
+// Übernimmt ein mit codec kodiertes Update in die Elemente, wie parse_game_update für GameUpdates.
+template<Codec StateCodec>//
+bool apply_update(StateCodec &codec, std::string_view const in, ElementStore &elements, b2World *world)
+{
+  std::int64_t tick{ 0 };
+  return codec.decode(in, tick, [&](ElementState const &state) { apply_element_state(elements, state, world); });
+}
+
+}// namespace arkanoid
+
+#endif
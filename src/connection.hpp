@@ -2,234 +2,703 @@
 #define CONNECTION_CPP
 
 #include "asio.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <fmt/format.h>
+#include <functional>
 #include <iostream>
+#include <limits>
 #include <queue>
+#include <span>
 
 #include "arkanoid.pb.h"
+#include "codec.hpp"
+#include "delta.hpp"
+#include "framing.hpp"
+#include "latency.hpp"
+#include "mpsc_queue.hpp"
+#include "reliable_udp.hpp"
+#include "update_arena.hpp"
+#include "asio/as_tuple.hpp"
+#include "asio/awaitable.hpp"
 #include "asio/buffer.hpp"
-#include "asio/completion_condition.hpp"
-#include "asio/execution/execute.hpp"
-#include "asio/impl/read_until.hpp"
-#include "asio/io_service.hpp"
+#include "asio/co_spawn.hpp"
+#include "asio/detached.hpp"
+#include "asio/executor_work_guard.hpp"
+#include "asio/experimental/awaitable_operators.hpp"
+#include "asio/io_context.hpp"
 #include "asio/ip/address.hpp"
 #include "asio/ip/tcp.hpp"
 #include "asio/ip/udp.hpp"
 #include "asio/read.hpp"
-#include "asio/read_until.hpp"
-#include "asio/registered_buffer.hpp"
-#include "asio/streambuf.hpp"
+#include "asio/redirect_error.hpp"
+#include "asio/steady_timer.hpp"
 #include "asio/system_error.hpp"
+#include "asio/use_awaitable.hpp"
+#include "asio/use_future.hpp"
 #include "asio/write.hpp"
 
 namespace connection {
 
 int constexpr default_port{ 45678 };
-std::string const end_of_message{ "\n\r\r" };
 std::string const default_host{ "127.0.0.1" };
 bool constexpr debug_networking{ false };
+std::size_t constexpr max_send_queue_depth{ 64 };
+std::size_t constexpr spare_updates{ 8 };
+std::size_t constexpr pooled_update_arena_size{ 1 << 13 };
+auto constexpr connect_timeout{ std::chrono::seconds(5) };
 
-void debug(std::string const &message)
+using asio::awaitable;
+using asio::use_awaitable;
+
+enum class Transport { TCP, UDP };
+
+// Formatiert erst, wenn die Ausgabe eingeschaltet ist; der Schreibpfad ruft das für jeden Frame auf.
+template<typename... Args>//
+void debug(fmt::format_string<Args...> format, Args &&...args)
 {
-  if (debug_networking) { fmt::print("[DEBUG] [NET] {}", message); }
+  if constexpr (debug_networking) {
+    fmt::print("[DEBUG] [NET] {}", fmt::format(format, std::forward<Args>(args)...));
+  }
 }
 
+// Liefert nur Ports, die in asio::ip::port_type passen, sonst den Standardport.
 [[nodiscard]] int calculate_port_from_string(std::string const &str)
 {
 
   try {
-    return std::stoi(str);
+    auto const port = std::stoi(str);
+    if (port > 0 && port <= std::numeric_limits<asio::ip::port_type>::max()) { return port; }
   } catch (std::exception &e) {}
   return connection::default_port;
 }
 
-class Connection
+// Ein Update in der Sendewarteschlange: eigenständig oder aus dem Vorrat, dann liegt es in dessen Arena und kehrt
+// nach dem Schreiben dorthin zurück.
+class OutgoingUpdate
 {
 private:
-  asio::io_service m_io_service;
-  asio::ip::tcp::socket m_socket{ m_io_service };
-  std::vector<std::function<void(GameUpdate const &)>> m_receivers;
-  bool m_connected{ false }, m_sending{ false };
-  std::mutex m_receivers_mutex, m_conntected_mutex, m_send_mutex, m_send_c_mutex, m_receive_c_mutex;
-  int m_gu_send_counter{ 0 }, m_gu_receive_counter{ 0 };
+  GameUpdate m_owned;
+  PooledUpdate m_pooled;
+
+public:
+  OutgoingUpdate(GameUpdate update) : m_owned{ std::move(update) } {}
+  OutgoingUpdate(PooledUpdate update) : m_pooled{ std::move(update) } {}
+
+  [[nodiscard]] GameUpdate &message() { return m_pooled != nullptr ? m_pooled->update() : m_owned; }
+};
+
+[[nodiscard]] GameUpdate &message_of(GameUpdate &update) { return update; }
+
+[[nodiscard]] GameUpdate &message_of(OutgoingUpdate &update) { return update.message(); }
 
-  void connect_to_on_this_thread(std::string const &host, int const &port)
+// Entfernt Ball- und Schlägerzustände, die von einem späteren Update überholt wurden. Steine bleiben erhalten.
+// Updates, die dadurch leer werden, werden verworfen. Gibt die Anzahl der entfernten Zustände zurück.
+template<typename Pending>// GameUpdate oder OutgoingUpdate
+[[nodiscard]] int coalesce_game_updates(std::vector<Pending> &pending)
+{
+  // Nur Bälle und Schläger, also wenige; der Vektor behält seine Kapazität von Aufruf zu Aufruf.
+  thread_local std::vector<int> newer_states;
+  newer_states.clear();
+  int coalesced{ 0 };
+
+  for (auto it = pending.rbegin(); it != pending.rend(); ++it) {
+    auto *elements = message_of(*it).mutable_element();
+
+    for (int i = elements->size() - 1; i >= 0; --i) {
+      auto const &element = elements->Get(i);
+      if (element.has_brick()) { continue; }
+
+      if (std::find(newer_states.begin(), newer_states.end(), element.id()) != newer_states.end()) {
+        elements->DeleteSubrange(i, 1);
+        ++coalesced;
+      } else {
+        newer_states.push_back(element.id());
+      }
+    }
+  }
+
+  std::erase_if(pending, [](Pending &update) { return message_of(update).ByteSizeLong() == 0; });
+
+  return coalesced;
+}
+
+class Connection
+{
+private:
+  asio::io_context m_io_context{ 1 };
+  asio::executor_work_guard<asio::io_context::executor_type> m_work_guard{ m_io_context.get_executor() };
+  Transport const m_transport;
+  asio::ip::tcp::socket m_socket{ m_io_context };
+  asio::ip::tcp::acceptor m_acceptor{ m_io_context };
+  asio::ip::udp::socket m_udp_socket{ m_io_context };
+  asio::ip::udp::endpoint m_peer_endpoint;
+  asio::steady_timer m_write_signal{ m_io_context };
+
+  ReliableEndpoint m_reliable_endpoint;
+  DeliveryClassifier m_delivery_classifier;
+  DeltaEncoder m_delta_encoder;
+  DeltaDecoder m_delta_decoder;
+  std::vector<std::string> m_frames;
+  std::vector<asio::const_buffer> m_buffers;
+  GameUpdate m_reliable_part;
+  std::string m_datagram;
+
+  std::atomic<bool> m_connected{ false };
+
+  UpdatePool m_update_pool{ spare_updates, pooled_update_arena_size };// vor der Warteschlange, die ihn benutzt
+  MpscQueue<OutgoingUpdate> m_send_queue;
+  MpscQueue<GameUpdate> m_received_queue;// dekodierte Zustände, abgeholt von drain_received()
+  LatencyEstimator m_latency;
+  TickMapping m_ticks;
+  std::atomic<int> m_gu_send_counter{ 0 }, m_gu_receive_counter{ 0 }, m_states_coalesced{ 0 }, m_gu_dropped{ 0 };
+  std::atomic<std::size_t> m_bytes_sent{ 0 };
+  std::function<void(GameUpdate const &, bool)> m_observer;// nur im Spiel-Thread, siehe set_observer
+  std::string m_state_buffer;// nur im Spiel-Thread, siehe send_state
+
+  std::thread m_io_thread;
+
+  awaitable<bool> connect_coroutine(std::string const host, int const port)
   {
-    try {
-      if (has_connected()) { return; }
+    asio::error_code ec;
+    asio::steady_timer timeout{ m_io_context, connect_timeout };
+    timeout.async_wait([this](asio::error_code const &timer_ec) {
+      if (!timer_ec) { m_socket.close(); }
+    });
+
+    auto const address = asio::ip::make_address(host, ec);
+    if (!ec) {
+      asio::ip::tcp::endpoint const endpoint{ address, static_cast<asio::ip::port_type>(port) };
+      co_await m_socket.async_connect(endpoint, asio::redirect_error(use_awaitable, ec));
+    }
+    timeout.cancel();
 
-      std::lock_guard<std::mutex> lock{ m_conntected_mutex };
-      m_socket.connect(asio::ip::tcp::endpoint(asio::ip::address::from_string(host), port));
-      m_connected = true;
-    } catch (asio::system_error &e) {
+    if (ec) {
       fmt::print("Fehler beim Verbinden.");
+      co_return false;
+    }
+
+    co_return true;
+  }
+
+  awaitable<bool> accept_coroutine(int const port)
+  {
+    try {
+      asio::ip::tcp::endpoint const endpoint{ asio::ip::tcp::v4(), static_cast<asio::ip::port_type>(port) };
+      m_acceptor.open(endpoint.protocol());
+      m_acceptor.set_option(asio::ip::tcp::acceptor::reuse_address(true));
+      m_acceptor.bind(endpoint);
+      m_acceptor.listen();
+
+      co_await m_acceptor.async_accept(m_socket, use_awaitable);
+      m_acceptor.close();
+    } catch (asio::system_error const &e) {
+      fmt::print("Fehler beim Warten auf Verbindung.");
+      co_return false;
     }
+
+    co_return true;
+  }
+
+  awaitable<void> send_datagram(PacketHeader const &header, std::string const &payload)
+  {
+    std::array<std::uint8_t, PacketHeader::max_size> header_bytes{};
+    auto const header_length = header.encode(header_bytes.data());
+    std::array<asio::const_buffer, 2> const buffers{ asio::buffer(header_bytes.data(), header_length),
+      asio::buffer(payload) };
+
+    auto const [ec, t] = co_await m_udp_socket.async_send_to(buffers, m_peer_endpoint, asio::as_tuple(use_awaitable));
+    m_bytes_sent += t;
+    if (ec) { debug("Datagramm konnte nicht versendet werden: {}\n", ec.message()); }
+  }
+
+  awaitable<bool> udp_connect_coroutine(std::string const host, int const port)
+  {
+    using namespace asio::experimental::awaitable_operators;
+
+    try {
+      m_peer_endpoint = { asio::ip::make_address(host), static_cast<asio::ip::port_type>(port) };
+      m_udp_socket.open(asio::ip::udp::v4());
+
+      std::array<std::uint8_t, PacketHeader::max_size> buffer{};
+      auto const deadline = std::chrono::steady_clock::now() + connect_timeout;
+
+      while (std::chrono::steady_clock::now() < deadline) {
+        co_await send_datagram(m_reliable_endpoint.next_header(HELLO), {});
+
+        asio::ip::udp::endpoint sender;
+        asio::steady_timer timer{ m_io_context, hello_interval };
+        auto const result = co_await (m_udp_socket.async_receive_from(asio::buffer(buffer), sender, use_awaitable)
+                                      || timer.async_wait(use_awaitable));
+
+        PacketHeader header;
+        if (result.index() == 0 && sender == m_peer_endpoint
+            && header.decode(buffer.data(), std::get<0>(result)) > 0 && header.kind == HELLO_ACK) {
+          co_return true;
+        }
+      }
+    } catch (asio::system_error const &e) {}
+
+    fmt::print("Fehler beim Verbinden.");
+    co_return false;
   }
 
-  void wait_for_connection_on_this_thread(int const &port)
+  awaitable<bool> udp_accept_coroutine(int const port)
   {
     try {
-      if (has_connected()) { return; }
+      m_udp_socket.open(asio::ip::udp::v4());
+      m_udp_socket.bind({ asio::ip::udp::v4(), static_cast<asio::ip::port_type>(port) });
 
-      asio::ip::tcp::acceptor acceptor{ m_io_service, asio::ip::tcp::endpoint(asio::ip::tcp::v4(), port) };
+      std::array<std::uint8_t, PacketHeader::max_size> buffer{};
 
+      while (true) {
+        asio::ip::udp::endpoint sender;
+        auto const size = co_await m_udp_socket.async_receive_from(asio::buffer(buffer), sender, use_awaitable);
 
-      std::lock_guard<std::mutex> lock{ m_conntected_mutex };
-      acceptor.accept(m_socket);
-      m_connected = true;
-    } catch (asio::system_error &e) {
+        PacketHeader header;
+        if (header.decode(buffer.data(), size) > 0 && header.kind == HELLO) {
+          m_peer_endpoint = sender;
+          co_await send_datagram(m_reliable_endpoint.next_header(HELLO_ACK), {});
+          co_return true;
+        }
+      }
+    } catch (asio::system_error const &e) {
       fmt::print("Fehler beim Warten auf Verbindung.");
     }
+
+    co_return false;
+  }
+
+  [[nodiscard]] bool accepts(bool const add_to_queue_if_currently_in_use) const
+  {
+    return m_connected && (add_to_queue_if_currently_in_use || m_send_queue.size() < max_send_queue_depth);
+  }
+
+  // Reiht ein Update zum Senden ein; aus jedem Thread, aber ohne Beobachter, siehe send().
+  void enqueue(OutgoingUpdate game_update, bool const add_to_queue_if_currently_in_use)
+  {
+    if (!accepts(add_to_queue_if_currently_in_use)) {
+      ++m_gu_dropped;
+      return;
+    }
+
+    if (m_send_queue.push(std::move(game_update)) == 1) {
+      asio::post(m_io_context, [this]() { m_write_signal.cancel(); });
+    }
+  }
+
+  void handle_update(GameUpdate &update)
+  {
+    auto const received_at = now_microseconds();
+
+    m_delta_encoder.acknowledge(update.ack());
+    m_delta_decoder.decode(update);
+
+    if (update.has_ping()) {
+      auto const &ping = update.ping();
+      if (ping.tick() >= 0 && ping.tick_started_at() != 0) {
+        m_ticks.set_remote_tick(ping.tick(), m_latency.to_local_time(ping.tick_started_at()));
+      }
+
+      GameUpdate reply;
+      auto *pong = reply.mutable_pong();
+      pong->set_ping_sent_at(update.ping().sent_at());
+      pong->set_ping_received_at(received_at);
+      pong->set_sent_at(now_microseconds());
+      enqueue(std::move(reply), true);
+    }
+
+    if (update.has_pong()) {
+      auto const &pong = update.pong();
+      m_latency.add_sample(pong.ping_sent_at(), pong.ping_received_at(), pong.sent_at(), received_at);
+    }
+
+    if (update.element_size() > 0 || !update.state().empty() || update.event_size() > 0 || update.has_state_hash()
+        || update.has_lockstep_input() || update.has_lockstep_start()) {
+      // Ohne Kopie: Die Nachricht wird beim nächsten Empfang ohnehin neu befüllt.
+      (void)m_received_queue.push(std::move(update));
+      ++m_gu_receive_counter;
+    }
+  }
+
+  awaitable<void> read_loop()
+  {
+    FrameReader reader;
+    GameUpdate update;
+
+    while (true) {
+      auto const [ec, bytes_transferred] =
+        co_await m_socket.async_read_some(reader.prepare(), asio::as_tuple(use_awaitable));
+
+      if (ec) { break; }
+
+      reader.commit(bytes_transferred);
+
+      bool const valid = reader.consume_frames([this, &update](char const *data, int const size) {
+        if (update.ParseFromArray(data, size)) { handle_update(update); }
+
+        debug("Nachricht empfangen: {} Bytes\n", size);
+      });
+
+      if (!valid) { break; }
+    }
+
+    m_connected = false;
+    m_write_signal.cancel();
+  }
+
+  awaitable<void> udp_read_loop()
+  {
+    std::vector<std::uint8_t> buffer(std::numeric_limits<std::uint16_t>::max());
+    GameUpdate update;
+
+    while (true) {
+      asio::ip::udp::endpoint sender;
+      auto const [ec, size] =
+        co_await m_udp_socket.async_receive_from(asio::buffer(buffer), sender, asio::as_tuple(use_awaitable));
+
+      if (ec == asio::error::operation_aborted || !m_udp_socket.is_open()) { break; }
+      if (ec || sender != m_peer_endpoint) { continue; }
+
+      PacketHeader header;
+      auto const header_length = header.decode(buffer.data(), size);
+      if (header_length == 0) { continue; }
+
+      if (header.kind == HELLO) {
+        co_await send_datagram(m_reliable_endpoint.next_header(HELLO_ACK), {});
+      } else if (header.kind == DATA) {
+        std::string_view const payload{ reinterpret_cast<char const *>(buffer.data()) + header_length,
+          size - header_length };
+        m_reliable_endpoint.receive(header, payload, [this, &update](std::string_view const message) {
+          if (update.ParseFromArray(message.data(), static_cast<int>(message.size()))) { handle_update(update); }
+        });
+
+        if (m_reliable_endpoint.ack_due(ReliableEndpoint::Clock::now())) {
+          co_await send_datagram(m_reliable_endpoint.next_header(), {});
+        }
+      }
+    }
+
+    m_connected = false;
+    m_write_signal.cancel();
+  }
+
+  // Wiederholt unbestätigte zuverlässige Nachrichten und sendet reine Acks, wenn sonst nichts gesendet wird.
+  awaitable<void> udp_maintenance_loop()
+  {
+    asio::steady_timer timer{ m_io_context };
+
+    while (m_connected) {
+      timer.expires_after(ack_interval / 2);
+      co_await timer.async_wait(asio::as_tuple(use_awaitable));
+
+      auto const now = ReliableEndpoint::Clock::now();
+      std::vector<std::pair<PacketHeader, std::string>> due;
+      m_reliable_endpoint.resend_due(
+        now, [&due](PacketHeader const &header, std::string const &payload) { due.emplace_back(header, payload); });
+
+      for (auto const &[header, payload] : due) { co_await send_datagram(header, payload); }
+      if (m_reliable_endpoint.ack_due(now)) { co_await send_datagram(m_reliable_endpoint.next_header(), {}); }
+    }
+  }
+
+  awaitable<void> ping_loop()
+  {
+    asio::steady_timer timer{ m_io_context };
+
+    while (m_connected) {
+      GameUpdate update;
+      auto const [tick, started_at] = m_ticks.local_tick();
+      auto *ping = update.mutable_ping();
+      ping->set_sent_at(now_microseconds());
+      ping->set_tick(tick);
+      ping->set_tick_started_at(started_at);
+      enqueue(std::move(update), true);
+
+      timer.expires_after(ping_interval);
+      co_await timer.async_wait(asio::as_tuple(use_awaitable));
+    }
+  }
+
+  awaitable<bool> write_stream(std::vector<OutgoingUpdate> &pending)
+  {
+    if (m_frames.size() < pending.size()) { m_frames.resize(pending.size()); }
+    m_buffers.clear();
+
+    for (std::size_t i{ 0 }; i < pending.size(); ++i) {
+      auto &update = pending[i].message();
+      m_delta_encoder.encode(update, m_delta_decoder.ack());
+      m_frames[i].clear();
+      append_frame(update, m_frames[i]);
+      m_buffers.push_back(asio::buffer(m_frames[i]));
+    }
+
+    // Als span, denn async_write kopiert die Pufferfolge; ein std::vector kostete so zwei Allokationen je Aufruf.
+    auto const [ec, t] = co_await asio::async_write(
+      m_socket, std::span<asio::const_buffer const>{ m_buffers }, asio::as_tuple(use_awaitable));
+    m_bytes_sent += t;
+    debug("{} Bytes in {} Nachrichten versendet.", t, pending.size());
+
+    co_return !ec;
   }
 
-  void call_receivers(GameUpdate const &update)
+  awaitable<void> write_datagram(GameUpdate &part, bool const reliable)
   {
-    std::lock_guard<std::mutex> lock{ m_receivers_mutex };
-    std::for_each(m_receivers.begin(),
-      m_receivers.end(),
-      [update](std::function<void(GameUpdate const &)> const &receiver) { receiver(update); });
+    m_delta_encoder.encode(part, m_delta_decoder.ack());
+    part.SerializeToString(&m_datagram);// behält die Kapazität des letzten Datagramms
+    auto const header =
+      reliable ? m_reliable_endpoint.next_reliable_header(m_datagram) : m_reliable_endpoint.next_header();
+    co_await send_datagram(header, m_datagram);
   }
 
-  void read_listener()
+  // Jedes Datagramm wird einzeln kodiert, damit ein Ack genau die enthaltenen Zustände bestätigt. Was in ein
+  // Datagramm passt, geht ohne Kopie.
+  awaitable<void> write_parts(GameUpdate &update, bool const reliable)
   {
-    std::thread{
-      [this]() {
-        while (true) {
-          asio::streambuf buffer;
-          asio::error_code ec;
-          GameUpdate update;
+    auto const size = update.ByteSizeLong();
+    if (size == 0) { co_return; }
+    if (size <= max_datagram_payload) {
+      co_await write_datagram(update, reliable);
+      co_return;
+    }
 
-          try {
-            std::size_t const bytes_transferred = asio::read_until(m_socket, buffer, end_of_message, ec);
+    for (auto &part : split_into_datagrams(update)) {
+      if (part.ByteSizeLong() != 0) { co_await write_datagram(part, reliable); }
+    }
+  }
 
-            if (ec) { break; }
+  awaitable<bool> write_datagrams(std::vector<OutgoingUpdate> &pending)
+  {
+    for (auto &outgoing : pending) {
+      auto &update = outgoing.message();
+      m_reliable_part.Clear();
+      m_delivery_classifier.split(update, m_reliable_part);
 
-            std::string message{ buffers_begin(buffer.data()),
-              buffers_begin(buffer.data()) + (bytes_transferred - end_of_message.size()) };
-            buffer.consume(bytes_transferred);
+      co_await write_parts(m_reliable_part, true);
+      co_await write_parts(update, false);
+    }
 
-            if (update.ParseFromString(message)) { call_receivers(update); }
-            {
-              std::lock_guard<std::mutex> c_lock{ m_receive_c_mutex };
-              ++m_gu_receive_counter;
-            }
+    co_return m_udp_socket.is_open();
+  }
 
-            debug(fmt::format("Nachricht empfangen: {}\n", message));
-          } catch (asio::system_error const &e) {
+  awaitable<void> write_loop()
+  {
+    std::vector<OutgoingUpdate> pending;
 
-            {
-              std::lock_guard<std::mutex> lock{ m_conntected_mutex };
-              m_connected = false;
-            }
+    while (m_connected) {
+      while (auto item = m_send_queue.pop()) { pending.push_back(std::move(*item)); }
 
-            break;
-          }
+      if (pending.empty()) {
+        if (!m_send_queue.empty()) {
+          // Ein Produzent hat bereits gezählt, das Element aber noch nicht verkettet.
+          co_await asio::post(m_io_context, use_awaitable);
+          continue;
         }
+
+        m_write_signal.expires_at(asio::steady_timer::time_point::max());
+        co_await m_write_signal.async_wait(asio::as_tuple(use_awaitable));
+        continue;
+      }
+
+      m_states_coalesced += coalesce_game_updates(pending);
+
+      bool const written =
+        (m_transport == Transport::UDP) ? co_await write_datagrams(pending) : co_await write_stream(pending);
+
+      auto const game_updates =
+        static_cast<int>(std::count_if(pending.begin(), pending.end(), [](OutgoingUpdate &update) {
+          return update.message().element_size() > 0 || !update.message().state().empty();
+        }));
+
+      if (written) {
+        m_gu_send_counter += game_updates;
+      } else {
+        m_gu_dropped += game_updates;
+        m_connected = false;
       }
-    }.detach();
+
+      pending.clear();
+    }
   }
 
+  void start_io_loops(bool const connected)
+  {
+    if (!connected) { return; }
+
+    m_connected = true;
+    asio::co_spawn(m_io_context, write_loop(), asio::detached);
+    asio::co_spawn(m_io_context, ping_loop(), asio::detached);
+
+    if (m_transport == Transport::UDP) {
+      asio::co_spawn(m_io_context, udp_read_loop(), asio::detached);
+      asio::co_spawn(m_io_context, udp_maintenance_loop(), asio::detached);
+    } else {
+      asio::co_spawn(m_io_context, read_loop(), asio::detached);
+    }
+  }
+
+  // Führt die Funktion auf dem I/O-Thread aus und wartet auf deren Ende.
+  template<typename Function>//
+  void run_on_io_thread(Function &&function)
+  {
+    if (m_io_context.get_executor().running_in_this_thread()) {
+      function();
+      return;
+    }
+
+    asio::post(m_io_context, asio::use_future(std::forward<Function>(function))).get();
+  }
 
 public:
-  explicit Connection() = default;
+  // Beide Seiten müssen dieselbe Quantisierung verwenden.
+  explicit Connection(Transport const transport = Transport::TCP, Quantization const quantization = {})
+    : m_transport{ transport }, m_delta_encoder{ quantization }, m_delta_decoder{ quantization },
+      m_io_thread{ [this]() { m_io_context.run(); } }
+  {}
 
   Connection(Connection const &) = delete;
   Connection &operator=(Connection const &) = delete;
 
+  ~Connection()
+  {
+    close();
+    m_work_guard.reset();
+    m_io_context.stop();
+    m_io_thread.join();
+  }
+
   void connect_to(
     std::string const &host,
     int const &port,
     std::function<void()> const &on_finish = []() {})
   {
-    std::thread{
-      [host, port, this, on_finish]() {
-        connect_to_on_this_thread(host, port);
-        on_finish();
-      }
-    }.join();
+    if (has_connected()) { return; }
 
-    if (has_connected()) {
-      read_listener();
-      m_io_service.run();
-    }
+    auto coroutine = (m_transport == Transport::UDP) ? udp_connect_coroutine(host, port) : connect_coroutine(host, port);
+    bool const connected = asio::co_spawn(m_io_context, std::move(coroutine), asio::use_future).get();
+    on_finish();
+    start_io_loops(connected);
   }
 
   void wait_for_connection(
     int const &port,
     std::function<void()> const &on_finish = []() {})
   {
-    std::thread{
-      [port, this, on_finish]() {
-        wait_for_connection_on_this_thread(port);
-        on_finish();
-      }
-    }.join();
+    if (has_connected()) { return; }
 
-    if (has_connected()) {
-      read_listener();
-      m_io_service.run();
-    }
+    auto coroutine = (m_transport == Transport::UDP) ? udp_accept_coroutine(port) : accept_coroutine(port);
+    bool const connected = asio::co_spawn(m_io_context, std::move(coroutine), asio::use_future).get();
+    on_finish();
+    start_io_loops(connected);
   }
 
   void close()
   {
-    std::lock_guard<std::mutex> lock{ m_conntected_mutex };
-    m_socket.close();
+    run_on_io_thread([this]() {
+      asio::error_code ec;
+      m_connected = false;
+      m_acceptor.close(ec);
+      m_socket.close(ec);
+      m_udp_socket.close(ec);
+      m_write_signal.cancel();
+    });
   }
 
+  // Übergibt das Update dem Schreib-Koroutine. Nicht erforderliche Updates werden verworfen, solange die
+  // Warteschlange voll ist; überholte Ball- und Schlägerzustände werden vor dem Senden zusammengefasst.
+  // Nur aus dem Spiel-Thread; Ping und Pong des Netzwerk-Threads gehen über enqueue() am Beobachter vorbei.
   void send(GameUpdate game_update, bool const add_to_queue_if_currently_in_use = false)
   {
-    {
-      std::lock_guard<std::mutex> lock{ m_send_mutex };
-      if (!add_to_queue_if_currently_in_use && m_sending) { return; }
-    }
-    auto message = game_update.SerializeAsString();
-
-    std::thread([this, message]() {
-      {
-        std::lock_guard<std::mutex> lock{ m_send_mutex };
-        m_sending = true;
-      }
-      try {
-        std::size_t const t = m_socket.write_some(asio::buffer(message + end_of_message));
-        debug(fmt::format("{} Bytes versendet.", t));
-      } catch (asio::system_error const &e) {}
-
-      {
-        std::lock_guard<std::mutex> lock{ m_send_mutex };
-        m_sending = false;
-      }
-      {
-        std::lock_guard<std::mutex> c_lock{ m_send_c_mutex };
-        ++m_gu_send_counter;
-      }
-    }).detach();
+    if (m_observer && accepts(add_to_queue_if_currently_in_use)) { m_observer(game_update, true); }
+    enqueue(std::move(game_update), add_to_queue_if_currently_in_use);
   }
 
-  void register_receiver(std::function<void(GameUpdate const &)> const &receiver)
+  // Wie send(GameUpdate), aber für ein Update aus take_update(). Die Arena gehört dem Spiel-Thread; was der I/O-Thread
+  // darin anlegte, käme aus einem eigenen Heap-Block. Die Felder, die er beim Kodieren füllt, entstehen deshalb hier.
+  void send(PooledUpdate game_update, bool const add_to_queue_if_currently_in_use = false)
   {
-    std::lock_guard<std::mutex> lock{ m_receivers_mutex };
-    m_receivers.push_back(receiver);
+    auto &update = game_update->update();
+    for (auto &element : *update.mutable_element()) { (void)element.mutable_packed(); }
+
+    if (m_observer && accepts(add_to_queue_if_currently_in_use)) { m_observer(update, true); }
+    enqueue(std::move(game_update), add_to_queue_if_currently_in_use);
   }
 
-  [[nodiscard]] bool has_connected()
+  // Sendet den Zustand der Elemente im Format von codec statt als GameElements. Die Gegenstelle übernimmt ihn mit
+  // demselben Codec, im Spiel über parse_remote_update() in main.cpp mit ProtobufCodec. Der Zustand geht ohne
+  // Deltas und wird nicht zusammengefasst; über UDP geht er unzuverlässig wie die Zustände von Bällen.
+  template<arkanoid::Codec StateCodec>//
+  void send_state(StateCodec &codec,
+    std::int64_t const tick,
+    std::vector<arkanoid::Element *> const &elements,
+    bool const add_to_queue_if_currently_in_use = false)
   {
-    std::lock_guard<std::mutex> lock{ m_conntected_mutex };
-    return m_connected;
+    auto game_update = take_update();
+    auto &update = game_update->update();
+    update.set_tick(tick);
+    codec.encode(tick, elements, m_state_buffer);
+    update.set_state(m_state_buffer);
+    send(std::move(game_update), add_to_queue_if_currently_in_use);
   }
 
-  [[nodiscard]] int game_updates_sent()
+  // Ein leeres Update aus dem Vorrat, nur für den Spiel-Thread. Es kehrt nach dem Schreiben samt Arena zurück,
+  // sodass Frame für Frame ohne Heap-Allokation gesendet wird.
+  [[nodiscard]] PooledUpdate take_update() { return m_update_pool.take(); }
+
+  // Übergibt alle seit dem letzten Aufruf empfangenen Zustände in Empfangsreihenfolge an apply. Darf nur von einem
+  // Thread aufgerufen werden, in der Regel zu Beginn eines Ticks; blockiert nie auf den Netzwerk-Thread.
+  template<typename Apply>//
+  std::size_t drain_received(Apply &&apply)
   {
-    std::lock_guard<std::mutex> lock{ m_send_c_mutex };
-    return m_gu_send_counter;
+    std::size_t applied{ 0 };
+    while (auto update = m_received_queue.pop()) {
+      if (m_observer) { m_observer(*update, false); }
+      apply(*update);
+      ++applied;
+    }
+    return applied;
   }
 
-  [[nodiscard]] int game_updates_received()
+  // Sieht jedes im Spiel-Thread gesendete (sent = true) und jedes abgeholte Update, z. B. für eine Aufzeichnung. Wird
+  // nur aus send() und drain_received() aufgerufen, nie für Ping und Pong; vor dem Verbinden setzen.
+  void set_observer(std::function<void(GameUpdate const &, bool sent)> observer) { m_observer = std::move(observer); }
+
+  [[nodiscard]] bool has_connected() const { return m_connected; }
+
+  [[nodiscard]] int game_updates_sent() const { return m_gu_send_counter; }
+
+  [[nodiscard]] int game_updates_received() const { return m_gu_receive_counter; }
+
+  [[nodiscard]] int game_updates_dropped() const { return m_gu_dropped; }
+
+  [[nodiscard]] int states_coalesced() const { return m_states_coalesced; }
+
+  [[nodiscard]] std::size_t bytes_sent() const { return m_bytes_sent; }
+
+  [[nodiscard]] int deltas_undecodable() const { return m_delta_decoder.failed(); }
+
+  [[nodiscard]] std::size_t send_queue_depth() const { return m_send_queue.size(); }
+
+  [[nodiscard]] Transport transport() const { return m_transport; }
+
+  [[nodiscard]] LatencyStats latency() const { return m_latency.stats(); }
+
+  [[nodiscard]] LatencyEstimator const &latency_estimator() const { return m_latency; }
+
+  // Im Spiel-Thread zu Beginn jedes Ticks, damit die Gegenstelle dessen Ticks zuordnen kann.
+  void set_local_tick(std::int64_t const tick) { m_ticks.set_local_tick(tick, now_microseconds()); }
+
+  // Der lokale Tick, der lief, als die Gegenstelle remote_tick begann, siehe TickMapping.
+  [[nodiscard]] std::optional<std::int64_t> to_local_tick(std::int64_t const remote_tick, int const frame_rate) const
   {
-    std::lock_guard<std::mutex> lock{ m_receive_c_mutex };
-    return m_gu_receive_counter;
+    return m_ticks.to_local_tick(remote_tick, frame_rate);
   }
+
+  [[nodiscard]] int packets_retransmitted() const { return m_reliable_endpoint.retransmitted(); }
+
+  [[nodiscard]] int stale_packets_discarded() const { return m_reliable_endpoint.stale_discarded(); }
 };
 
 }// namespace connection
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,255 @@
+#ifndef DELTA_CPP
+#define DELTA_CPP
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include "arkanoid.pb.h"
+#include "quantization.hpp"
+
+namespace connection {
+
+std::size_t constexpr delta_history_size{ 32 };
+
+enum ClearedField : std::uint32_t {
+  POSITION_X = 1U << 0U,
+  POSITION_Y = 1U << 1U,
+  VELOCITY_X = 1U << 2U,
+  VELOCITY_Y = 1U << 3U,
+  SCORE = 1U << 4U,
+  CONTROLLED_BY_SENDER = 1U << 5U,
+  DURATION = 1U << 6U
+};
+
+// Entfernt aus element alle Felder, die mit baseline übereinstimmen. Felder, die sich auf ihren Standardwert
+// geändert haben, würde proto3 nicht übertragen; sie werden in cleared vermerkt.
+void encode_delta(GameElement const &baseline, GameElement &element)
+{
+  std::uint32_t cleared{ 0 };
+
+  // Gibt zurück, ob das Feld übertragen werden muss.
+  auto compare = [&cleared](auto const current, auto const previous, ClearedField const field) {
+    if (current == previous) { return false; }
+    if (current == decltype(current){}) { cleared |= field; }
+    return true;
+  };
+
+  auto const &position = element.element_position();
+  bool const x_changed = compare(position.x(), baseline.element_position().x(), POSITION_X);
+  bool const y_changed = compare(position.y(), baseline.element_position().y(), POSITION_Y);
+  if (!x_changed && !y_changed) {
+    element.clear_element_position();
+  } else {
+    if (!x_changed) { element.mutable_element_position()->clear_x(); }
+    if (!y_changed) { element.mutable_element_position()->clear_y(); }
+  }
+
+  if (element.has_ball()) {
+    auto *ball = element.mutable_ball();
+    bool const vx_changed = compare(ball->velocity_x(), baseline.ball().velocity_x(), VELOCITY_X);
+    bool const vy_changed = compare(ball->velocity_y(), baseline.ball().velocity_y(), VELOCITY_Y);
+    if (!vx_changed) { ball->clear_velocity_x(); }
+    if (!vy_changed) { ball->clear_velocity_y(); }
+    if (!vx_changed && !vy_changed) { element.clear_ball(); }
+  } else if (element.has_paddle()) {
+    auto *paddle = element.mutable_paddle();
+    bool const score_changed = compare(paddle->score(), baseline.paddle().score(), SCORE);
+    bool const controlled_changed =
+      compare(paddle->controlled_by_sender(), baseline.paddle().controlled_by_sender(), CONTROLLED_BY_SENDER);
+    if (!score_changed) { paddle->clear_score(); }
+    if (!controlled_changed) { paddle->clear_controlled_by_sender(); }
+    if (!score_changed && !controlled_changed) { element.clear_paddle(); }
+  } else if (element.has_brick()) {
+    if (!compare(element.brick().duration(), baseline.brick().duration(), DURATION)) { element.clear_brick(); }
+  }
+
+  element.set_cleared(cleared);
+}
+
+// Gegenstück zu encode_delta: ergänzt element um die Felder aus baseline.
+void decode_delta(GameElement const &baseline, GameElement &element)
+{
+  GameElement delta;
+  delta.Swap(&element);
+  auto const cleared = delta.cleared();
+
+  element.CopyFrom(baseline);
+  delta.clear_baseline_age();
+  delta.clear_cleared();
+  element.MergeFrom(delta);
+
+  if ((cleared & POSITION_X) != 0) { element.mutable_element_position()->clear_x(); }
+  if ((cleared & POSITION_Y) != 0) { element.mutable_element_position()->clear_y(); }
+  if ((cleared & VELOCITY_X) != 0) { element.mutable_ball()->clear_velocity_x(); }
+  if ((cleared & VELOCITY_Y) != 0) { element.mutable_ball()->clear_velocity_y(); }
+  if ((cleared & SCORE) != 0) { element.mutable_paddle()->clear_score(); }
+  if ((cleared & CONTROLLED_BY_SENDER) != 0) { element.mutable_paddle()->clear_controlled_by_sender(); }
+  if ((cleared & DURATION) != 0) { element.mutable_brick()->clear_duration(); }
+}
+
+// Wie to.CopyFrom(from), gibt aber die Teilnachrichten von to nicht frei, solange dieselben vorhanden sind. Für
+// Verläufe, deren Einträge sonst bei jedem Überschreiben neu alloziert würden.
+void copy_element(GameElement const &from, GameElement &to)
+{
+  if (to.specific_case() != from.specific_case() || to.has_element_position() != from.has_element_position()) {
+    to.CopyFrom(from);
+    return;
+  }
+
+  to.set_id(from.id());
+  if (from.has_element_position()) { *to.mutable_element_position() = from.element_position(); }
+  if (from.has_ball()) {
+    *to.mutable_ball() = from.ball();
+  } else if (from.has_paddle()) {
+    *to.mutable_paddle() = from.paddle();
+  } else if (from.has_brick()) {
+    *to.mutable_brick() = from.brick();
+  }
+  to.set_baseline_age(from.baseline_age());
+  to.set_cleared(from.cleared());
+  to.set_packed(from.packed());
+}
+
+// Die letzten delta_history_size vollständigen Zustände eines Elements mit der Sequenznummer ihrer Nachricht.
+class ElementHistory
+{
+private:
+  std::array<std::pair<std::uint32_t, GameElement>, delta_history_size> m_states{};
+  std::size_t m_next{ 0 }, m_size{ 0 };
+
+public:
+  void push(std::uint32_t const sequence, GameElement const &element)
+  {
+    m_states[m_next].first = sequence;
+    copy_element(element, m_states[m_next].second);
+    m_next = (m_next + 1) % delta_history_size;
+    m_size = std::min(m_size + 1, delta_history_size);
+  }
+
+  // Der älteste Eintrag wird beim nächsten push() überschrieben und taugt daher nicht als Basis.
+  [[nodiscard]] GameElement const *find(std::uint32_t const sequence) const
+  {
+    std::size_t const usable = (m_size == delta_history_size) ? m_size - 1 : m_size;
+
+    for (std::size_t i{ 1 }; i <= usable; ++i) {
+      auto const &[state_sequence, state] = m_states[(m_next + delta_history_size - i) % delta_history_size];
+      if (state_sequence == sequence) { return &state; }
+    }
+
+    return nullptr;
+  }
+};
+
+// Kodiert ausgehende Updates gegen den letzten von der Gegenstelle bestätigten Zustand jedes Elements.
+// Ein Element wird nur dann als Delta gesendet, wenn seine Basis noch in beiden Verläufen liegt; da die
+// Gegenstelle höchstens so viele neuere Zustände empfangen haben kann, wie gesendet wurden, genügt dafür der eigene.
+class DeltaEncoder
+{
+private:
+  Quantization const m_quantization;
+  std::uint32_t m_next_sequence{ 1 };
+  std::map<int, ElementHistory> m_sent;
+  std::map<int, std::uint32_t> m_acked;// id -> Sequenznummer der bestätigten Basis
+  // Enthaltene ids der zuletzt gesendeten Nachrichten, nach Sequenznummer im Ring. Ältere taugen ohnehin nicht
+  // mehr als Basis; die Vektoren behalten ihre Kapazität.
+  std::array<std::pair<std::uint32_t, std::vector<int>>, delta_history_size> m_unacked{};
+  std::uint32_t m_oldest_unacked{ 1 };
+
+public:
+  explicit DeltaEncoder(Quantization const quantization = {}) : m_quantization{ quantization } {}
+
+  void encode(GameUpdate &update, std::uint32_t const ack)
+  {
+    update.set_ack(ack);
+    if (update.element_size() == 0) { return; }// Nachrichten ohne Elemente erhalten keine Sequenznummer
+
+    auto const sequence = m_next_sequence++;
+    update.set_sequence(sequence);
+
+    auto &[ids_sequence, ids] = m_unacked[sequence % delta_history_size];
+    ids_sequence = sequence;
+    ids.clear();
+    for (auto &element : *update.mutable_element()) {
+      auto &history = m_sent[element.id()];
+      auto const acked = m_acked.find(element.id());
+      GameElement const *baseline = (acked == m_acked.end()) ? nullptr : history.find(acked->second);
+
+      snap_element(element, m_quantization);
+      history.push(sequence, element);
+      ids.push_back(element.id());
+
+      if (baseline != nullptr && baseline->specific_case() == element.specific_case()) {
+        encode_delta(*baseline, element);
+        element.set_baseline_age(sequence - acked->second);
+      }
+
+      pack_element(element, m_quantization);
+    }
+  }
+
+  void acknowledge(std::uint32_t const sequence)
+  {
+    auto const &[ids_sequence, ids] = m_unacked[sequence % delta_history_size];
+    if (sequence < m_oldest_unacked || ids_sequence != sequence) { return; }
+
+    for (auto const id : ids) {
+      auto &acked = m_acked[id];
+      acked = std::max(acked, sequence);
+    }
+
+    m_oldest_unacked = sequence + 1;// ältere Nachrichten gelten als verloren
+  }
+};
+
+// Rekonstruiert die vollständigen Zustände aus empfangenen Deltas und bestimmt die Sequenznummer, die bestätigt wird.
+class DeltaDecoder
+{
+private:
+  Quantization const m_quantization;
+  std::map<int, ElementHistory> m_received;
+  std::uint32_t m_ack{ 0 };
+  std::atomic<int> m_failed{ 0 };
+
+public:
+  explicit DeltaDecoder(Quantization const quantization = {}) : m_quantization{ quantization } {}
+
+  // Elemente, deren Basis nicht mehr vorliegt, werden entfernt; die Nachricht wird dann nicht bestätigt.
+  void decode(GameUpdate &update)
+  {
+    bool complete{ true };
+    auto *elements = update.mutable_element();
+
+    for (int i = elements->size() - 1; i >= 0; --i) {
+      auto *element = elements->Mutable(i);
+      auto &history = m_received[element->id()];
+
+      unpack_element(*element, m_quantization);
+      if (element->baseline_age() != 0) {
+        auto const *baseline = history.find(update.sequence() - element->baseline_age());
+        if (baseline == nullptr) {
+          elements->DeleteSubrange(i, 1);
+          complete = false;
+          ++m_failed;
+          continue;
+        }
+        decode_delta(*baseline, *element);
+      }
+
+      history.push(update.sequence(), *element);
+    }
+
+    if (complete && update.sequence() > m_ack) { m_ack = update.sequence(); }
+  }
+
+  [[nodiscard]] std::uint32_t ack() const { return m_ack; }
+  [[nodiscard]] int failed() const { return m_failed; }
+};
+
+}// namespace connection
+
+#endif
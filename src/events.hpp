@@ -0,0 +1,139 @@
+#ifndef EVENTS_CPP
+#define EVENTS_CPP
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "arkanoid.pb.h"
+#include "arkanoid_elements.hpp"
+
+namespace arkanoid {
+
+// Alle so vielen Ticks werden der eigene Schläger und die zuletzt von ihm gespielten Bälle vollständig gesendet,
+// damit sich Abweichungen, die Ereignisse nicht abdecken, wieder angleichen.
+long constexpr state_sync_interval_ticks{ 80 };
+
+// Sammelt Ereignisse der eigenen Simulation zum Senden und wendet empfangene an. Eigene Punkteänderungen werden
+// sofort angewendet; während eines Rollbacks wird nur angewendet, nicht erneut aufgezeichnet.
+class EventLog
+{
+private:
+  std::vector<GameEvent> m_pending;
+  std::uint32_t m_next_id{ 1 };
+  bool m_recording{ true };
+
+  // Bereits gezählte Punkte aus Treffern und Punkteänderungen: höchste id und die 64 davor als Bitmaske.
+  std::uint32_t m_highest_applied{ 0 };
+  std::uint64_t m_applied_window{ 0 };
+
+  GameEvent *record()
+  {
+    if (!m_recording) { return nullptr; }
+
+    auto &event = m_pending.emplace_back();
+    event.set_id(m_next_id++);
+    return &event;
+  }
+
+  [[nodiscard]] bool first_application(std::uint32_t const id)
+  {
+    if (id > m_highest_applied) {
+      auto const shift = id - m_highest_applied;
+      m_applied_window = (shift >= 64) ? 0 : (m_applied_window << shift);
+      m_applied_window |= 1U;
+      m_highest_applied = id;
+      return true;
+    }
+
+    auto const age = m_highest_applied - id;
+    if (age >= 64) { return false; }// zu alt, um es sicher zu wissen: lieber nicht doppelt zählen
+
+    auto const bit = std::uint64_t{ 1 } << age;
+    if ((m_applied_window & bit) != 0) { return false; }
+    m_applied_window |= bit;
+    return true;
+  }
+
+public:
+  void set_recording(bool const recording) { m_recording = recording; }
+
+  // Der Punkt für den Treffer wird wie bei score_delta sofort angewendet, geht aber im selben Ereignis mit.
+  void brick_hit(Brick const &brick, Paddle &paddle)
+  {
+    paddle.set_score(paddle.score() + 1);
+    if (auto *event = record()) {
+      auto *hit = event->mutable_brick_hit();
+      hit->set_id(brick.id());
+      hit->set_paddle_id(paddle.id());
+      hit->set_duration(brick.duration());
+    }
+  }
+
+  void score_delta(Paddle &paddle, int const delta)
+  {
+    if (delta == 0) { return; }
+
+    paddle.set_score(paddle.score() + delta);
+    if (auto *event = record()) {
+      event->mutable_score_delta()->set_paddle_id(paddle.id());
+      event->mutable_score_delta()->set_delta(delta);
+    }
+  }
+
+  [[nodiscard]] bool has_pending() const { return !m_pending.empty(); }
+
+  void flush(GameUpdate &update)
+  {
+    auto *events = update.mutable_event();
+    events->Reserve(events->size() + static_cast<int>(m_pending.size()));
+    for (auto &event : m_pending) { events->Add(std::move(event)); }
+    m_pending.clear();
+  }
+
+  // Die Haltbarkeit eines getroffenen Steins sinkt auf min(aktuell, duration); das ist wiederholt und in beliebiger
+  // Reihenfolge angewendet dasselbe. Mit deduplicate werden die Punkte derselben id nur einmal gezählt. Ohne, wenn der
+  // Aufrufer wie beim Rollback den Zustand vor dem Ereignis wiederherstellt und es erneut anwendet.
+  void apply(GameUpdate const &update, ElementStore const &elements, bool const deduplicate)
+  {
+    for (auto const &event : update.event()) {
+      if (event.has_brick_hit()) {
+        auto const &hit = event.brick_hit();
+        if (auto *brick = element_cast<Brick>(elements.find(hit.id())); brick != nullptr) {
+          brick->set_duration(std::min(brick->duration(), hit.duration()));
+        }
+
+        auto *paddle = element_cast<Paddle>(elements.find(hit.paddle_id()));
+        if (paddle == nullptr || (deduplicate && !first_application(event.id()))) { continue; }
+
+        paddle->set_score(paddle->score() + 1);
+      } else if (event.has_score_delta()) {
+        auto *paddle = element_cast<Paddle>(elements.find(event.score_delta().paddle_id()));
+        if (paddle == nullptr || (deduplicate && !first_application(event.id()))) { continue; }
+
+        paddle->set_score(paddle->score() + event.score_delta().delta());
+      }
+    }
+  }
+};
+
+// Ergänzt die Elemente eines Ticks um den eigenen Schläger und die Bälle, die er zuletzt gespielt hat.
+void add_state_sync(std::vector<Element *> &updated_elements, ElementStore const &elements, Paddle *own_paddle)
+{
+  if (own_paddle == nullptr) { return; }
+
+  auto add = [&updated_elements](Element *element) {
+    if (std::find(updated_elements.begin(), updated_elements.end(), element) == updated_elements.end()) {
+      updated_elements.push_back(element);
+    }
+  };
+
+  add(own_paddle);
+  elements.balls().for_each([&](Ball &ball) {
+    if (ball.last_paddle() == own_paddle) { add(&ball); }
+  });
+}
+
+}// namespace arkanoid
+
+#endif
@@ -0,0 +1,119 @@
+#ifndef FRAMING_CPP
+#define FRAMING_CPP
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "arkanoid.pb.h"
+#include "asio/buffer.hpp"
+
+namespace connection {
+
+std::size_t constexpr max_varint_length{ 5 };
+std::size_t constexpr max_frame_size{ 1 << 20 };
+std::size_t constexpr receive_buffer_size{ 1 << 14 };
+
+std::size_t write_varint(std::uint32_t value, char *out)
+{
+  std::size_t length{ 0 };
+
+  while (value >= 0x80U) {
+    out[length++] = static_cast<char>((value & 0x7FU) | 0x80U);
+    value >>= 7U;
+  }
+  out[length++] = static_cast<char>(value);
+
+  return length;
+}
+
+// Liefert 0, falls der Präfix noch nicht vollständig empfangen wurde, sonst die Anzahl der gelesenen Bytes.
+// Ungültige Präfixe (zu lang) werden mit max_varint_length + 1 gemeldet.
+[[nodiscard]] std::size_t read_varint(char const *data, std::size_t const size, std::uint32_t &value)
+{
+  value = 0;
+
+  for (std::size_t i{ 0 }; i < size; ++i) {
+    if (i >= max_varint_length) { return max_varint_length + 1; }
+
+    auto const byte = static_cast<std::uint8_t>(data[i]);
+    value |= (byte & 0x7FU) << (7U * i);
+
+    if ((byte & 0x80U) == 0) { return i + 1; }
+  }
+
+  return 0;
+}
+
+void append_frame(GameUpdate const &update, std::string &out)
+{
+  auto const size = update.ByteSizeLong();
+  auto const offset = out.size();
+
+  out.resize(offset + max_varint_length + size);
+  auto const prefix_length = write_varint(static_cast<std::uint32_t>(size), out.data() + offset);
+  update.SerializeWithCachedSizesToArray(reinterpret_cast<std::uint8_t *>(out.data() + offset + prefix_length));
+  out.resize(offset + prefix_length + size);
+}
+
+[[nodiscard]] std::string encode_frame(GameUpdate const &update)
+{
+  std::string frame;
+  append_frame(update, frame);
+  return frame;
+}
+
+class FrameReader
+{
+private:
+  std::vector<char> m_buffer;
+  std::size_t m_begin{ 0 }, m_end{ 0 };
+
+public:
+  explicit FrameReader(std::size_t const initial_size = receive_buffer_size) : m_buffer(initial_size) {}
+
+  [[nodiscard]] asio::mutable_buffer prepare()
+  {
+    if (m_begin == m_end) {
+      m_begin = 0;
+      m_end = 0;
+    } else if (m_end == m_buffer.size() && m_begin > 0) {
+      std::memmove(m_buffer.data(), m_buffer.data() + m_begin, m_end - m_begin);
+      m_end -= m_begin;
+      m_begin = 0;
+    }
+
+    if (m_end == m_buffer.size()) { m_buffer.resize(m_buffer.size() * 2); }
+
+    return asio::buffer(m_buffer.data() + m_end, m_buffer.size() - m_end);
+  }
+
+  void commit(std::size_t const bytes_transferred) { m_end += bytes_transferred; }
+
+  // Ruft für jeden vollständig empfangenen Frame callback(data, size) direkt auf dem Empfangspuffer auf.
+  // Gibt false zurück, wenn der Datenstrom nicht mehr interpretierbar ist.
+  template<typename Callback>//
+  [[nodiscard]] bool consume_frames(Callback &&callback)
+  {
+    while (m_begin < m_end) {
+      std::uint32_t frame_size{ 0 };
+      auto const prefix_length = read_varint(m_buffer.data() + m_begin, m_end - m_begin, frame_size);
+
+      if (prefix_length > max_varint_length || frame_size > max_frame_size) { return false; }
+      if (prefix_length == 0 || m_end - m_begin - prefix_length < frame_size) {
+        if (m_buffer.size() < prefix_length + frame_size) { m_buffer.resize(prefix_length + frame_size); }
+        break;
+      }
+
+      callback(m_buffer.data() + m_begin + prefix_length, static_cast<int>(frame_size));
+      m_begin += prefix_length + frame_size;
+    }
+
+    return true;
+  }
+};
+
+}// namespace connection
+
+#endif
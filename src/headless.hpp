@@ -0,0 +1,167 @@
+#ifndef HEADLESS_CPP
+#define HEADLESS_CPP
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "box2d-incl/box2d/b2_world.h"
+
+#include "allocation_counter.hpp"
+#include "arkanoid.pb.h"
+#include "arkanoid_elements.hpp"
+#include "arkanoid_game.hpp"
+#include "events.hpp"
+
+namespace arkanoid {
+
+enum class HeadlessInput { BOT, SCRIPT };
+
+// Zeit und Allokationen je Abschnitt eines Ticks, über alle gemessenen Ticks summiert.
+struct TickProfile
+{
+  enum Phase { INPUT, PHYSICS, SCAN, SEND, RULES, PHASE_COUNT };
+  static constexpr std::array<char const *, PHASE_COUNT> names{ "Eingabe", "Physik", "Änderungen", "Senden", "Regeln" };
+
+  std::array<double, PHASE_COUNT> ns{};
+  std::array<std::size_t, PHASE_COUNT> allocations{};
+  long ticks{ 0 };
+
+  void add(TickProfile const &other)
+  {
+    for (std::size_t phase{ 0 }; phase < PHASE_COUNT; ++phase) {
+      ns[phase] += other.ns[phase];
+      allocations[phase] += other.allocations[phase];
+    }
+    ticks += other.ticks;
+  }
+
+  [[nodiscard]] double total_ns() const
+  {
+    double total{ 0 };
+    for (auto const phase_ns : ns) { total += phase_ns; }
+    return total;
+  }
+
+  [[nodiscard]] std::size_t total_allocations() const
+  {
+    std::size_t total{ 0 };
+    for (auto const phase_allocations : allocations) { total += phase_allocations; }
+    return total;
+  }
+};
+
+// Eine Partie wie beim Host in run_game ohne Rollback, aber ohne Bildschirm, Verbindung und Wartezeit: dieselben
+// Elemente, dieselbe Physik und dieselben Kontaktregeln samt EventLog. Der eigene Schläger folgt einem Bot oder
+// einer festen Bahn; der gegnerische wird gesetzt, wie es sonst die Updates der Gegenstelle tun. Das Update, das
+// gesendet würde, wird gebaut und serialisiert, aber verworfen.
+class HeadlessMatch
+{
+private:
+  b2World m_world{ { 0, 0 } };
+  ElementStore m_elements;
+  ContactListener m_listener;
+  EventLog m_events;
+  std::array<b2Fixture *, 2> m_back_plates{};
+  std::array<Paddle *, 2> m_paddle_ptrs{ nullptr, nullptr };
+  std::vector<Element *> m_updated;
+  GameUpdate m_update;
+  std::string m_wire;
+  HeadlessInput m_input;
+  long m_tick{ 0 };
+  int m_winner{ -1 };
+
+  [[nodiscard]] int input_for(std::size_t const player) const
+  {
+    if (m_input == HeadlessInput::BOT) { return bot_input(m_elements, *m_paddle_ptrs[player]); }
+
+    // Feste Bahn: beide Schläger pendeln gegeneinander versetzt über das Spielfeld.
+    auto const phase = (static_cast<double>(m_tick) / 10.0) + (static_cast<double>(player) * 2.0);
+    return static_cast<int>(canvas_width / 2.0 + std::sin(phase) * 60.0);
+  }
+
+public:
+  HeadlessMatch(HeadlessInput const input, std::uint32_t const seed) : m_input{ input }
+  {
+    int const paddle_y{ playing_field_bottom - paddle_height };
+    Vector const paddle_position{ (canvas_width / 2) - (paddle_width / 2), paddle_y };
+
+    m_world.SetContactListener(&m_listener);
+    m_listener.set_event_log(&m_events);
+    m_back_plates = build_b2_world_border(&m_world);
+    generate_arkanoid_elements(paddle_position,
+      { playing_field_bottom - paddle_height },
+      { paddle_width / 2, -10 },
+      { ball_velocity_x, ball_velocity_y },
+      &m_world,
+      m_elements,
+      seed);
+    (void)find_paddle_ptrs(m_paddle_ptrs, m_back_plates, m_elements, m_listener);
+  }
+
+  HeadlessMatch(HeadlessMatch const &) = delete;
+  HeadlessMatch &operator=(HeadlessMatch const &) = delete;
+
+  // Berechnet einen Tick so schnell wie möglich. Mit profile werden Zeit und Allokationen je Abschnitt addiert.
+  void step(int const frame_rate, TickProfile *profile = nullptr)
+  {
+    auto phase_start = std::chrono::steady_clock::now();
+    auto allocations = allocation_counter::thread_allocations();
+    auto end_phase = [&](TickProfile::Phase const phase) {
+      if (profile == nullptr) { return; }
+
+      auto const now = std::chrono::steady_clock::now();
+      auto const now_allocations = allocation_counter::thread_allocations();
+      profile->ns[phase] += std::chrono::duration<double, std::nano>(now - phase_start).count();
+      profile->allocations[phase] += now_allocations - allocations;
+      phase_start = now;
+      allocations = now_allocations;
+    };
+
+    update_paddle_position(m_paddle_ptrs[0], input_for(0));
+    update_paddle_position(m_paddle_ptrs[1], input_for(1));
+    end_phase(TickProfile::INPUT);
+
+    m_world.Step(1.0F / static_cast<float>(frame_rate), 4, 2);
+    end_phase(TickProfile::PHYSICS);
+
+    m_updated.clear();
+    m_elements.for_each([this](auto &element) {
+      if (element.did_update() && std::find(m_updated.begin(), m_updated.end(), &element) == m_updated.end()) {
+        m_updated.push_back(&element);
+      }
+    });
+    if (m_tick % state_sync_interval_ticks == 0) { add_state_sync(m_updated, m_elements, m_paddle_ptrs[0]); }
+    end_phase(TickProfile::SCAN);
+
+    if (!m_updated.empty() || m_events.has_pending()) {
+      m_update.Clear();
+      m_update.set_tick(m_tick);
+      fill_game_update(&m_update, m_updated);
+      m_events.flush(m_update);
+      (void)m_update.SerializeToString(&m_wire);
+    }
+    end_phase(TickProfile::SEND);
+
+    m_elements.disable_destroyed_bricks();
+    m_winner = get_winner(m_elements, m_paddle_ptrs);
+    ++m_tick;
+    end_phase(TickProfile::RULES);
+
+    if (profile != nullptr) { ++profile->ticks; }
+  }
+
+  [[nodiscard]] bool finished() const { return m_winner >= 0; }
+  [[nodiscard]] int winner() const { return m_winner; }
+  [[nodiscard]] long tick() const { return m_tick; }
+  [[nodiscard]] ElementStore const &elements() const { return m_elements; }
+};
+
+}// namespace arkanoid
+
+#endif
@@ -0,0 +1,149 @@
+#ifndef INTERPOLATION_CPP
+#define INTERPOLATION_CPP
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <optional>
+
+#include "arkanoid.pb.h"
+#include "arkanoid_elements.hpp"
+
+namespace arkanoid {
+
+int constexpr interpolation_delay_ticks{ 3 };
+int constexpr max_extrapolation_ticks{ 8 };
+std::size_t constexpr snapshot_buffer_size{ 32 };
+double constexpr tick_offset_smoothing{ 0.05 };
+
+struct Snapshot
+{
+  std::int64_t tick{ 0 };
+  Vector position{ 0.0F, 0.0F };
+  Vector velocity{ 0.0F, 0.0F };// arkanoid-Koordinaten pro Tick
+};
+
+// Ringpuffer der zuletzt empfangenen Zustände eines Elements, aufsteigend nach Tick sortiert.
+class SnapshotBuffer
+{
+private:
+  std::array<Snapshot, snapshot_buffer_size> m_snapshots;
+  std::size_t m_begin{ 0 }, m_size{ 0 };
+
+  [[nodiscard]] Snapshot const &at(std::size_t const index) const
+  {
+    return m_snapshots[(m_begin + index) % snapshot_buffer_size];
+  }
+
+public:
+  void push(std::int64_t const tick, Vector const position)
+  {
+    if (m_size > 0 && tick <= newest().tick) { return; }// veraltet oder doppelt
+
+    Snapshot snapshot{ tick, position };
+    if (m_size > 0) {
+      auto const &previous = newest();
+      auto const ticks = static_cast<float>(tick - previous.tick);
+      snapshot.velocity = position.sub(previous.position);
+      snapshot.velocity = { snapshot.velocity.x / ticks, snapshot.velocity.y / ticks };
+    }
+
+    if (m_size == snapshot_buffer_size) {
+      m_begin = (m_begin + 1) % snapshot_buffer_size;
+      --m_size;
+    }
+    m_snapshots[(m_begin + m_size) % snapshot_buffer_size] = snapshot;
+    ++m_size;
+  }
+
+  [[nodiscard]] Snapshot const &newest() const { return at(m_size - 1); }
+
+  [[nodiscard]] bool empty() const { return m_size == 0; }
+
+  // Interpoliert zwischen den beiden umschließenden Zuständen; liegt der Tick hinter dem neuesten Zustand,
+  // wird dieser höchstens max_extrapolation_ticks weit fortgeschrieben.
+  [[nodiscard]] std::optional<Vector> sample(double const tick) const
+  {
+    if (m_size == 0) { return std::nullopt; }
+    if (tick <= static_cast<double>(at(0).tick)) { return at(0).position; }
+
+    for (std::size_t i{ 1 }; i < m_size; ++i) {
+      auto const &to = at(i);
+      if (tick > static_cast<double>(to.tick)) { continue; }
+
+      auto const &from = at(i - 1);
+      auto const ratio =
+        static_cast<float>((tick - static_cast<double>(from.tick)) / static_cast<double>(to.tick - from.tick));
+      return Vector{ from.position.x + ((to.position.x - from.position.x) * ratio),
+        from.position.y + ((to.position.y - from.position.y) * ratio) };
+    }
+
+    auto const &last = newest();
+    auto const ahead = static_cast<float>(
+      std::min(tick - static_cast<double>(last.tick), static_cast<double>(max_extrapolation_ticks)));
+    return Vector{ last.position.x + (last.velocity.x * ahead), last.position.y + (last.velocity.y * ahead) };
+  }
+};
+
+// Stellt Elemente, die von der Gegenstelle gesteuert werden, um interpolation_delay_ticks verzögert dar, statt sie
+// bei jedem empfangenen Update auf die neue Position springen zu lassen.
+class RemoteEntityInterpolator
+{
+private:
+  std::map<int, SnapshotBuffer> m_buffers;
+  std::int64_t m_local_tick{ 0 };
+  double m_tick_offset{ 0 };// geschätzter Tick der Gegenstelle minus lokaler Tick
+  bool m_has_offset{ false };
+
+public:
+  // Merkt sich die Positionen der von der Gegenstelle gesteuerten Schläger aus einem empfangenen Update.
+  void record(GameUpdate const &update)
+  {
+    auto const offset = static_cast<double>(update.tick() - m_local_tick);
+    if (!m_has_offset) {
+      m_tick_offset = offset;
+      m_has_offset = true;
+    } else {
+      // Früh ankommende Updates verschieben die Schätzung sofort, verspätete nur langsam.
+      m_tick_offset = (offset > m_tick_offset)
+                        ? offset
+                        : ((1.0 - tick_offset_smoothing) * m_tick_offset) + (tick_offset_smoothing * offset);
+    }
+
+    for (auto const &element : update.element()) {
+      if (!element.has_paddle() || !element.paddle().controlled_by_sender()) { continue; }
+
+      m_buffers[element.id()].push(
+        update.tick(), Vector{ element.element_position().x(), element.element_position().y() });
+    }
+  }
+
+  // Setzt die dargestellte Position aller interpolierten Elemente für den angegebenen lokalen Tick.
+  void apply(ElementStore const &elements, std::int64_t const local_tick)
+  {
+    m_local_tick = local_tick;
+    apply(elements);
+  }
+
+  void apply(ElementStore const &elements) const
+  {
+    if (!m_has_offset) { return; }
+
+    double const render_tick = static_cast<double>(m_local_tick) + m_tick_offset - interpolation_delay_ticks;
+
+    for (auto const &[id, buffer] : m_buffers) {
+      auto *element = elements.find(id);
+      if (element == nullptr) { continue; }
+
+      if (auto const position = buffer.sample(render_tick)) { element->set_position(*position); }
+    }
+  }
+
+  [[nodiscard]] std::int64_t local_tick() const { return m_local_tick; }
+};
+
+}// namespace arkanoid
+
+#endif
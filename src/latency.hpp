@@ -0,0 +1,161 @@
+#ifndef LATENCY_CPP
+#define LATENCY_CPP
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace connection {
+
+auto constexpr ping_interval{ std::chrono::milliseconds(250) };
+std::size_t constexpr latency_sample_count{ 128 };
+double constexpr rtt_smoothing{ 0.125 }, jitter_smoothing{ 0.25 };
+
+[[nodiscard]] std::int64_t now_microseconds()
+{
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch())
+    .count();
+}
+
+struct LatencyStats
+{
+  int samples{ 0 };
+  double rtt_ms{ 0 }, jitter_ms{ 0 }, clock_offset_ms{ 0 };
+  double rtt_p50_ms{ 0 }, rtt_p95_ms{ 0 }, rtt_p99_ms{ 0 };
+};
+
+// Schätzt aus Ping/Pong-Zeitstempeln Umlaufzeit, Jitter (nach RFC 6298) und den Versatz der Uhr der Gegenstelle.
+// Alle Zeitstempel stammen von now_microseconds() des jeweiligen Rechners.
+class LatencyEstimator
+{
+private:
+  mutable std::mutex m_mutex;
+  std::array<double, latency_sample_count> m_rtt_samples{};
+  int m_samples{ 0 };
+  double m_rtt_us{ 0 }, m_jitter_us{ 0 }, m_offset_us{ 0 };
+
+public:
+  // ping_sent_at und pong_received_at lokal, ping_received_at und pong_sent_at auf der Gegenstelle.
+  void add_sample(std::int64_t const ping_sent_at,
+    std::int64_t const ping_received_at,
+    std::int64_t const pong_sent_at,
+    std::int64_t const pong_received_at)
+  {
+    auto const rtt = static_cast<double>((pong_received_at - ping_sent_at) - (pong_sent_at - ping_received_at));
+    auto const offset =
+      static_cast<double>((ping_received_at - ping_sent_at) + (pong_sent_at - pong_received_at)) / 2.0;
+
+    if (rtt < 0) { return; }
+
+    std::lock_guard<std::mutex> lock{ m_mutex };
+
+    if (m_samples == 0) {
+      m_rtt_us = rtt;
+      m_jitter_us = rtt / 2.0;
+      m_offset_us = offset;
+    } else {
+      m_jitter_us = ((1.0 - jitter_smoothing) * m_jitter_us) + (jitter_smoothing * std::abs(m_rtt_us - rtt));
+      m_rtt_us = ((1.0 - rtt_smoothing) * m_rtt_us) + (rtt_smoothing * rtt);
+      // Proben mit kleiner Umlaufzeit sind weniger von asymmetrischen Verzögerungen verfälscht.
+      double const weight = rtt_smoothing * std::min(1.0, m_rtt_us / std::max(rtt, 1.0));
+      m_offset_us = ((1.0 - weight) * m_offset_us) + (weight * offset);
+    }
+
+    m_rtt_samples[static_cast<std::size_t>(m_samples) % latency_sample_count] = rtt;
+    ++m_samples;
+  }
+
+  [[nodiscard]] LatencyStats stats() const
+  {
+    std::lock_guard<std::mutex> lock{ m_mutex };
+    LatencyStats stats;
+
+    stats.samples = m_samples;
+    if (m_samples == 0) { return stats; }
+
+    stats.rtt_ms = m_rtt_us / 1000.0;
+    stats.jitter_ms = m_jitter_us / 1000.0;
+    stats.clock_offset_ms = m_offset_us / 1000.0;
+
+    auto const count = std::min(static_cast<std::size_t>(m_samples), latency_sample_count);
+    std::vector<double> sorted(m_rtt_samples.data(), m_rtt_samples.data() + count);
+    std::sort(sorted.begin(), sorted.end());
+    auto percentile = [&sorted](double const p) {
+      return sorted[static_cast<std::size_t>(p * static_cast<double>(sorted.size() - 1))] / 1000.0;
+    };
+
+    stats.rtt_p50_ms = percentile(0.50);
+    stats.rtt_p95_ms = percentile(0.95);
+    stats.rtt_p99_ms = percentile(0.99);
+
+    return stats;
+  }
+
+  // Rechnet einen Zeitstempel der Gegenstelle in die lokale Uhr um.
+  [[nodiscard]] std::int64_t to_local_time(std::int64_t const remote_time) const
+  {
+    std::lock_guard<std::mutex> lock{ m_mutex };
+    return remote_time - static_cast<std::int64_t>(m_offset_us);
+  }
+};
+
+// Ordnet Ticks der Gegenstelle lokalen Ticks zu. Beide Seiten zählen ab ihrem eigenen Spielbeginn; jeder Ping trägt
+// den aktuellen Tick des Senders und dessen Beginn. Mit dem geschätzten Uhrversatz ergibt sich, wann ein beliebiger
+// Tick der Gegenstelle lokal begann, und daraus der lokale Tick zu diesem Zeitpunkt. Die Anker werden mit jedem Tick
+// bzw. Ping erneuert, sodass unterschiedlich schnell laufende Spielschleifen nur wenig Fehler ansammeln.
+class TickMapping
+{
+private:
+  struct Anchor
+  {
+    std::int64_t tick{ -1 };
+    std::int64_t started_at{ 0 };// lokale Uhr
+  };
+
+  mutable std::mutex m_mutex;
+  Anchor m_local, m_remote;
+
+public:
+  // Im Spiel-Thread zu Beginn jedes Ticks.
+  void set_local_tick(std::int64_t const tick, std::int64_t const started_at)
+  {
+    std::lock_guard<std::mutex> lock{ m_mutex };
+    m_local = { tick, started_at };
+  }
+
+  // started_at bereits in die lokale Uhr umgerechnet, siehe LatencyEstimator::to_local_time.
+  void set_remote_tick(std::int64_t const tick, std::int64_t const started_at)
+  {
+    std::lock_guard<std::mutex> lock{ m_mutex };
+    m_remote = { tick, started_at };
+  }
+
+  // Für den nächsten Ping.
+  [[nodiscard]] std::pair<std::int64_t, std::int64_t> local_tick() const
+  {
+    std::lock_guard<std::mutex> lock{ m_mutex };
+    return { m_local.tick, m_local.started_at };
+  }
+
+  // Der lokale Tick, der lief, als die Gegenstelle remote_tick begann; leer, solange ein Anker fehlt.
+  [[nodiscard]] std::optional<std::int64_t> to_local_tick(std::int64_t const remote_tick, int const frame_rate) const
+  {
+    std::lock_guard<std::mutex> lock{ m_mutex };
+    if (m_local.tick < 0 || m_remote.tick < 0) { return std::nullopt; }
+
+    double const tick_us = 1'000'000.0 / frame_rate;
+    double const remote_started_at =
+      static_cast<double>(m_remote.started_at) + (static_cast<double>(remote_tick - m_remote.tick) * tick_us);
+    return m_local.tick + std::lround((remote_started_at - static_cast<double>(m_local.started_at)) / tick_us);
+  }
+};
+
+}// namespace connection
+
+#endif
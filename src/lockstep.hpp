@@ -0,0 +1,162 @@
+#ifndef LOCKSTEP_CPP
+#define LOCKSTEP_CPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+#include "box2d-incl/box2d/b2_world.h"
+
+#include "arkanoid.pb.h"
+#include "arkanoid_elements.hpp"
+#include "arkanoid_game.hpp"
+
+namespace arkanoid {
+
+// Eigene Eingaben gelten erst so viele Ticks später, damit sie die Gegenstelle rechtzeitig erreichen.
+long constexpr lockstep_input_delay_ticks{ 3 };
+
+// Die Ticks vor der ersten Eingabe: Der Schläger bleibt stehen.
+int constexpr lockstep_no_input{ std::numeric_limits<int>::min() };
+
+// Beide Seiten erzeugen die Partie mit generate_arkanoid_elements aus demselben seed und haben damit dieselben ids.
+// Spieler 0 ist der Host mit dem unteren Schläger. Beide Schläger gelten wie beim AuthoritativeMatch als gesteuert,
+// damit Treffer und Punkte auf beiden Seiten gleich gewertet werden. Gibt die Schläger nach Spieler zurück.
+std::array<Paddle *, 2> prepare_lockstep_match(ElementStore const &elements,
+  ContactListener &listener,
+  std::array<b2Fixture *, 2> const &back_plates)
+{
+  std::array<Paddle *, 2> players{ &elements.paddles()[0], &elements.paddles()[1] };
+  for (auto *paddle : players) { paddle->set_is_controlled_by_this_game_instance(true); }
+
+  listener.add_back_plate(back_plates[0], players[1]);// oben
+  listener.add_back_plate(back_plates[1], players[0]);// unten
+  return players;
+}
+
+// Ein Tick im Lockstep. Die Reihenfolge ist auf beiden Seiten dieselbe: erst Spieler 0, dann Spieler 1, dann die Welt.
+// Danach wirken die Kräfte auf die Bälle für den nächsten Tick, wie sonst über did_update; so stimmt auch eine aus
+// einem MatchSnapshot wiederhergestellte Welt, der sie ebenfalls erneut anwendet.
+void step_lockstep(b2World &world,
+  ElementStore const &elements,
+  std::array<Paddle *, 2> const &players,
+  std::array<int, 2> const &inputs,
+  float dt)
+{
+  for (std::size_t player{ 0 }; player < players.size(); ++player) {
+    if (inputs[player] != lockstep_no_input) { update_paddle_position(players[player], inputs[player]); }
+  }
+
+  world.Step(dt, 4, 2);
+  elements.balls().for_each([](Ball &ball) { ball.apply_forces(); });
+}
+
+// Eingabepuffer für den Lockstep: Ein Tick wird erst berechnet, wenn die Eingaben beider Spieler vorliegen; bis dahin
+// steht die Partie. Die eigene Eingabe wird für tick() + lockstep_input_delay_ticks eingeplant und gesendet.
+class Lockstep
+{
+private:
+  struct Input
+  {
+    std::int64_t tick{ -1 };
+    int mouse_x{ lockstep_no_input };
+  };
+
+  static std::size_t constexpr window{ 64 };
+
+  int m_local_player;
+  int m_redundancy;
+  std::array<Input, window> m_local{}, m_remote{};
+  std::int64_t m_tick{ 0 };
+  std::int64_t m_next_local_tick{ lockstep_input_delay_ticks };
+  std::size_t m_stalled_frames{ 0 };
+
+  [[nodiscard]] static Input &slot(std::array<Input, window> &inputs, std::int64_t const tick)
+  {
+    return inputs[static_cast<std::size_t>(tick) % window];
+  }
+
+  [[nodiscard]] static Input const &slot(std::array<Input, window> const &inputs, std::int64_t const tick)
+  {
+    return inputs[static_cast<std::size_t>(tick) % window];
+  }
+
+  void fill(GameUpdate &update, std::int64_t first_tick) const
+  {
+    if (first_tick < 0) { first_tick = 0; }
+
+    auto *message = update.mutable_lockstep_input();
+    message->set_first_tick(first_tick);
+    for (auto tick = first_tick; tick < m_next_local_tick; ++tick) {
+      message->add_mouse_x(slot(m_local, tick).mouse_x);
+    }
+  }
+
+public:
+  // Mit redundancy > 1 wiederholt jede Nachricht die vorigen Eingaben, für Übertragungen ohne Wiederholung.
+  explicit Lockstep(int const local_player, int const redundancy = 1)
+    : m_local_player{ local_player }, m_redundancy{ redundancy }
+  {
+    for (std::int64_t tick{ 0 }; tick < lockstep_input_delay_ticks; ++tick) {
+      slot(m_local, tick) = { tick, lockstep_no_input };
+      slot(m_remote, tick) = { tick, lockstep_no_input };
+    }
+  }
+
+  [[nodiscard]] std::int64_t tick() const { return m_tick; }
+  [[nodiscard]] std::size_t stalled_frames() const { return m_stalled_frames; }
+
+  // Plant die eigene Eingabe ein, solange sie nicht mehr als die Verzögerung vorausläuft, und schreibt sie in update.
+  // Gibt false zurück, wenn nichts einzuplanen war.
+  bool schedule_local(int const mouse_x, GameUpdate &update)
+  {
+    if (m_next_local_tick > m_tick + lockstep_input_delay_ticks) { return false; }
+
+    slot(m_local, m_next_local_tick) = { m_next_local_tick, mouse_x };
+    ++m_next_local_tick;
+    fill(update, m_next_local_tick - m_redundancy);
+    return true;
+  }
+
+  // Wenn die Partie steht, fehlt vielleicht der Gegenstelle eine eigene Eingabe: alle noch benötigten erneut senden.
+  // Ohne Redundanz, also über TCP, geht nichts verloren; dort wird nur gewartet.
+  void fill_resend(GameUpdate &update) const
+  {
+    if (m_redundancy > 1) { fill(update, m_tick - lockstep_input_delay_ticks); }
+  }
+
+  void receive(GameUpdate const &update)
+  {
+    if (!update.has_lockstep_input()) { return; }
+
+    auto const &message = update.lockstep_input();
+    for (int i{ 0 }; i < message.mouse_x_size(); ++i) {
+      auto const tick = message.first_tick() + i;
+      if (tick >= m_tick && tick < m_tick + static_cast<std::int64_t>(window)) {
+        slot(m_remote, tick) = { tick, message.mouse_x(i) };
+      }
+    }
+  }
+
+  [[nodiscard]] bool ready() const
+  {
+    return slot(m_local, m_tick).tick == m_tick && slot(m_remote, m_tick).tick == m_tick;
+  }
+
+  // Eingaben für tick() nach Spieler; nur gültig, wenn ready().
+  [[nodiscard]] std::array<int, 2> inputs() const
+  {
+    std::array<int, 2> inputs{};
+    inputs[static_cast<std::size_t>(m_local_player)] = slot(m_local, m_tick).mouse_x;
+    inputs[static_cast<std::size_t>(1 - m_local_player)] = slot(m_remote, m_tick).mouse_x;
+    return inputs;
+  }
+
+  void advance() { ++m_tick; }
+  void stall() { ++m_stalled_frames; }
+};
+
+}// namespace arkanoid
+
+#endif
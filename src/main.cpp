@@ -14,7 +14,6 @@
 
 #include <fmt/format.h>
 #include <istream>
-#include <map>
 #include <memory>
 #include <mutex>
 #include <optional>
@@ -49,17 +48,47 @@
 
 #include "box2d-incl/box2d/box2d.h"
 
+#include "allocation_counter.hpp"
 #include "arkanoid_elements.hpp"
+#include "arkanoid_game.hpp"
+#include "codec.hpp"
 #include "connection.hpp"
+#include "events.hpp"
+#include "interpolation.hpp"
+#include "lockstep.hpp"
+#include "replay.hpp"
+#include "rollback.hpp"
+#include "spectator.hpp"
+#include "state_hash.hpp"
 #include "utils.hpp"
 
-void show_connection_methods(std::function<void(bool const &, int const &)> callback)
+struct ConnectionSettings
+{
+  bool as_host{ false };
+  int port{ connection::default_port };
+  connection::Transport transport{ connection::Transport::TCP };
+  bool use_rollback{ false };
+  bool use_lockstep{ false };// nur Eingaben austauschen, beide Seiten rechnen dasselbe
+  bool via_server{ false };// Zustand kommt vom arkanoid_server, gesendet wird nur die eigene Eingabe
+  bool spectate{ false };// nur zuschauen, aus Sicht des unteren Spielers
+  bool check_sync{ arkanoid::deterministic_physics };// Prüfsummen austauschen, nur ohne Server
+  bool record_replay{ false };// in arkanoid_host.replay bzw. arkanoid_client.replay, siehe arkanoid_replay
+};
+
+void show_connection_methods(std::function<void(ConnectionSettings const &)> callback)
 {
   using namespace ftxui;
 
   auto screen = ScreenInteractive::TerminalOutput();
 
   bool is_host{ false };
+  bool use_udp{ false };
+  bool use_rollback{ false };
+  bool use_lockstep{ false };
+  bool via_server{ false };
+  bool spectate{ false };
+  bool check_sync{ arkanoid::deterministic_physics };
+  bool record_replay{ false };
   std::string port_string{ std::to_string(connection::default_port) };
 
 
@@ -72,8 +101,23 @@ void show_connection_methods(std::function<void(bool const &, int const &)> call
     is_host = false;
   });
   auto port_input = Input(&port_string, "Geben Sie den Port ein (Verbinden zu / Warten auf)");
-
-  auto children = Container::Vertical({ port_input, Container::Horizontal({ button_host, button_client }) });
+  auto udp_checkbox = Checkbox("UDP statt TCP verwenden", &use_udp);
+  auto rollback_checkbox = Checkbox("Rollback statt Interpolation verwenden", &use_rollback);
+  auto lockstep_checkbox = Checkbox("Lockstep: nur Eingaben austauschen", &use_lockstep);
+  auto server_checkbox = Checkbox("Über einen Server spielen (nur TCP)", &via_server);
+  auto spectate_checkbox = Checkbox("Beim Server nur zuschauen", &spectate);
+  auto sync_checkbox = Checkbox("Abweichungen über Prüfsummen erkennen", &check_sync);
+  auto replay_checkbox = Checkbox("Partie aufzeichnen", &record_replay);
+
+  auto children = Container::Vertical({ port_input,
+    udp_checkbox,
+    rollback_checkbox,
+    lockstep_checkbox,
+    server_checkbox,
+    spectate_checkbox,
+    sync_checkbox,
+    replay_checkbox,
+    Container::Horizontal({ button_host, button_client }) });
 
 
   auto render = Renderer(children, [&] {
@@ -89,8 +133,17 @@ void show_connection_methods(std::function<void(bool const &, int const &)> call
   screen.Loop(render);
 
 
-  int const port = connection::calculate_port_from_string(port_string);
-  callback(is_host, port);
+  ConnectionSettings settings;
+  settings.port = connection::calculate_port_from_string(port_string);
+  settings.spectate = spectate;
+  settings.via_server = via_server || spectate;
+  settings.as_host = is_host && !settings.via_server;
+  settings.transport = (use_udp && !settings.via_server) ? connection::Transport::UDP : connection::Transport::TCP;
+  settings.use_lockstep = use_lockstep && !settings.via_server;
+  settings.use_rollback = use_rollback && !settings.via_server && !settings.use_lockstep;
+  settings.check_sync = check_sync && !settings.via_server;
+  settings.record_replay = record_replay;
+  callback(settings);
 }
 
 
@@ -165,318 +218,113 @@ void connect_to_peer(connection::Connection &connection, bool const as_host, int
   }
 }
 
-void create_and_send_new_game_update(std::vector<arkanoid::Element *> const &send_elements,
-  connection::Connection &connection,
-  std::mutex &game_update_mutex)
+// Übernimmt die Elemente eines Updates der Gegenstelle: die GameElements und, falls vorhanden, den mit
+// Connection::send_state kodierten Zustand. Die Partie sendet Zustände im Format von ProtobufCodec.
+void parse_remote_update(arkanoid::ProtobufCodec &state_codec,
+  arkanoid::ElementStore &element_map,
+  GameUpdate const &update,
+  b2World &world)
 {
-  std::thread([send_elements, &connection, &game_update_mutex]() {// todo: sicherheit?
-    GameUpdate update;
-    {
-      std::lock_guard<std::mutex> game_update_lock{ game_update_mutex };
-      arkanoid::fill_game_update(&update, send_elements);
-
-      bool force_sending{ false };
-
-      for (auto *const element_ptr : send_elements) {
-        if (element_ptr->get_type() != arkanoid::PADDLE) {
-          force_sending = true;
-          break;
-        }
-      }
-
-      /*std::for_each(send_elements.begin(), send_elements.end(), [&force_sending](auto const element_ptr) {
-        if (force_sending || element_ptr->get_type() == arkanoid::PADDLE) { return; }
-        force_sending = true;
-      });*/ // todo: problem hierbei: kein break!
-
-      connection.send(update, force_sending);
-    }
-
-  })
-    .detach();
+  arkanoid::parse_game_update(element_map, update, &world);
+  if (!update.state().empty()) { (void)arkanoid::apply_update(state_codec, update.state(), element_map, &world); }
 }
 
-void generate_bricks(std::map<int, std::unique_ptr<arkanoid::Element>> &elements,
-  b2World *world,
-  std::map<b2Fixture *, arkanoid::Element *> &map)
-{
-  using namespace arkanoid;
-  std::random_device random_device;
-  std::default_random_engine random_engine{ random_device() };
-  std::uniform_int_distribution<int> uni_dist{ brick_min_duration, brick_max_duration };
-
-  int const num_bricks_x =
-    (playing_field_right - playing_field_left - brick_distance_x) / (brick_width + brick_distance_x);
-
-  int const total_brick_height = (num_bricks_y * (brick_height + brick_distance_y)) + brick_distance_y;
-  int const total_brick_width = (num_bricks_x * (brick_width + brick_distance_x)) - brick_distance_x;
-  int const top = std::round(((playing_field_bottom - playing_field_top) / 2.0F) - (total_brick_height / 2.0F));
-  int const left = std::round(((playing_field_right - playing_field_left) - total_brick_width) / 2.0F);
-
-  for (int i_x{ 0 }; i_x < num_bricks_x; ++i_x) {
-    for (int i_y{ 0 }; i_y < num_bricks_y; ++i_y) {
-
-      int const x{ playing_field_left + left + ((brick_distance_x + brick_width) * i_x) };
-      int const y{ playing_field_top + top + ((brick_distance_y + brick_height) * i_y) };
-
-      std::unique_ptr<arkanoid::Element> brick =
-        std::make_unique<arkanoid::Brick>(arkanoid::Vector{ x, y }, world, map, uni_dist(random_engine));
-      insert_element(elements, brick);
-    }
-  }
-}
-
-void generate_arkanoid_elements(arkanoid::Vector const paddle_position,
-  int const paddle_y,
-  arkanoid::Vector const ball_position_add,
-  arkanoid::Vector const ball_velocity,
-  b2World *arkanoid_world,
-  std::map<int, std::unique_ptr<arkanoid::Element>> &element_map,
-  std::map<b2Fixture *, arkanoid::Element *> &b2_element_map)
-{
-  using namespace arkanoid;
-
-  std::unique_ptr<arkanoid::Element> paddle = std::make_unique<Paddle>(paddle_position, arkanoid_world, b2_element_map);
-  std::unique_ptr<arkanoid::Element> paddle_enemy = std::make_unique<Paddle>(
-    paddle_position.sub(0, paddle_y).add(0, playing_field_top), arkanoid_world, b2_element_map);
-
-  auto *paddle_ptr = dynamic_cast<Paddle *>(paddle.get());
-  paddle_ptr->set_is_controlled_by_this_game_instance(true);
-
-  auto *paddle_enemy_ptr = dynamic_cast<Paddle *>(paddle_enemy.get());
-  paddle_enemy_ptr->set_is_controlled_by_this_game_instance(false);
-
-  std::unique_ptr<arkanoid::Element> ball =
-    std::make_unique<Ball>(paddle_position.add(ball_position_add), arkanoid_world, b2_element_map, ball_velocity);
-  std::unique_ptr<arkanoid::Element> ball_enemy = std::make_unique<Ball>(
-    paddle_position.sub(0, paddle_y).add(0, playing_field_top).add({ ball_position_add.x, -ball_position_add.y }),
-    arkanoid_world,
-    b2_element_map,
-    ball_velocity.invert());
-
-  insert_element(element_map, paddle);
-  insert_element(element_map, paddle_enemy);
-  insert_element(element_map, ball);
-  insert_element(element_map, ball_enemy);
-
-  generate_bricks(element_map, arkanoid_world, b2_element_map);
-}
-
-
-class ContactListener : public b2ContactListener
-{
-private:
-  static void BackPlateHit(arkanoid::Paddle *const paddle) { paddle->add_score(-5); }
-
-  std::map<b2Fixture *, arkanoid::Element *> &m_b2_element_map;
-  std::map<b2Fixture *, arkanoid::Paddle *> m_back_plates;
-
-  void UpdateElementsAfterContact(std::map<b2Fixture *, arkanoid::Element *>::iterator const &first_iterator,
-    std::map<b2Fixture *, arkanoid::Element *>::iterator const &second_iterator)
-  {
-    using namespace arkanoid;
-
-    auto *first_element_ptr = first_iterator->second;
-    auto *secound_element_ptr = second_iterator->second;
-
-    if (first_element_ptr->get_type() == secound_element_ptr->get_type()) { return; }
-
-    auto *brick_ptr = dynamic_multiple_cast<Brick *>(first_element_ptr, secound_element_ptr);
-    auto *ball_ptr = dynamic_multiple_cast<Ball *>(first_element_ptr, secound_element_ptr);
-    auto *paddle_ptr = dynamic_multiple_cast<Paddle *>(first_element_ptr, secound_element_ptr);
-
-
-    if (brick_ptr != nullptr && ball_ptr != nullptr) {
-      brick_ptr->hit(ball_ptr);
-      if (ball_ptr->last_paddle() != nullptr) { ball_ptr->last_paddle()->add_score(1); }
-    }
-    if (ball_ptr != nullptr && paddle_ptr != nullptr) {
-      if (paddle_ptr->is_controlled_by_this_game_instance()) {
-        ball_ptr->add_to_next_update();
-        ball_ptr->set_last_paddle(paddle_ptr);
-      }
-    }
-  }
-
-
-  void CheckIfBackPlateWasHit(b2Contact *contact)
-  {
-    arkanoid::Paddle *paddle_ptr{ nullptr };
-    arkanoid::Ball *ball_ptr{ nullptr };
-    if (m_back_plates.contains(contact->GetFixtureA()) && m_b2_element_map.contains(contact->GetFixtureB())) {
-      paddle_ptr = m_back_plates.find(contact->GetFixtureA())->second;
-      ball_ptr = dynamic_cast<arkanoid::Ball *>(m_b2_element_map.find(contact->GetFixtureB())->second);
-    } else if (m_back_plates.contains(contact->GetFixtureB()) && m_b2_element_map.contains(contact->GetFixtureA())) {
-      paddle_ptr = m_back_plates.find(contact->GetFixtureB())->second;
-      ball_ptr = dynamic_cast<arkanoid::Ball *>(m_b2_element_map.find(contact->GetFixtureA())->second);
-    }
-
-    if (paddle_ptr != nullptr && ball_ptr != nullptr && ball_ptr->last_paddle() != nullptr
-        && ball_ptr->last_paddle()->is_controlled_by_this_game_instance()) {
-      BackPlateHit(paddle_ptr);
-    }
-  }
-
-public:
-  explicit ContactListener(std::map<b2Fixture *, arkanoid::Element *> &b2_map) : m_b2_element_map{ b2_map } {};
-
-  void add_back_plate(b2Fixture *const fixture, arkanoid::Paddle *const paddle)
-  {
-    m_back_plates.insert({ fixture, paddle });
-  }
-
-
-  void PreSolve(b2Contact *contact, const b2Manifold *oldManifold) override
-  {
-    contact->SetFriction(0.0F);
-    contact->SetRestitution(1.0F);
-    contact->SetTangentSpeed(0.5F);
-  }
-
-  void EndContact(b2Contact *contact) override
-  {
-    if (m_b2_element_map.contains(contact->GetFixtureA())) {
-      auto pairA = m_b2_element_map.find(contact->GetFixtureA());
-      if (m_b2_element_map.contains(contact->GetFixtureB())) {
-        auto pairB = m_b2_element_map.find(contact->GetFixtureB());
-        UpdateElementsAfterContact(pairA, pairB);
-        return;
-      }
-    }
-
-    CheckIfBackPlateWasHit(contact);
-  }
-};
-
-std::array<b2Fixture *, 2> build_b2_world_border(b2World *world)
+// Baut das Update direkt im Spiel-Thread in einer Arena aus dem Vorrat der Verbindung; die Nachricht wird ohne Kopie
+// an die Warteschlange übergeben und die Arena nach dem Schreiben zurückgegeben.
+void create_and_send_new_game_update(std::vector<arkanoid::Element *> const &send_elements,
+  arkanoid::EventLog &events,
+  connection::Connection &connection,
+  long const tick,
+  arkanoid::DesyncDetector const *desync)
 {
-  int const playing_field_width = arkanoid::playing_field_right - arkanoid::playing_field_left;
-  int const playing_field_height = arkanoid::playing_field_bottom - arkanoid::playing_field_top;
-
-
-  auto generate = [&world](float const x, float const y, float width, float height) {
-    auto const position = arkanoid::convert_to_b2_coords(arkanoid::Vector{ x, y });
-    width *= arkanoid::b2_coord_convertion_rate;
-    height *= arkanoid::b2_coord_convertion_rate;
-
-    b2BodyDef def;
-    def.position.Set(position.x, position.y);
-    b2Body *body = world->CreateBody(&def);
-    b2PolygonShape box;
-    box.SetAsBox(width, height);
-    return body->CreateFixture(&box, 1.0f);
-  };
-
-  // links
-  generate(arkanoid::playing_field_left - 2, arkanoid::playing_field_top - 12, 1, playing_field_height + 24);
-  // rechts
-  generate(arkanoid::playing_field_right + 1, arkanoid::playing_field_top - 12, 1, playing_field_height + 24);
-  // oben
-  auto *const fix_1 =
-    generate(arkanoid::playing_field_left - 2, arkanoid::playing_field_top - 11, playing_field_width + 4, 1);
-  // unten
-  auto *const fix_2 =
-    generate(arkanoid::playing_field_left - 2, arkanoid::playing_field_bottom + 10, playing_field_width + 4, 1);
-
-  return { fix_1, fix_2 };
+  auto pooled = connection.take_update();
+  auto &update = pooled->update();
+  update.set_tick(tick);
+  if (desync != nullptr) { desync->fill(update); }
+  update.mutable_element()->Reserve(static_cast<int>(send_elements.size()));
+  arkanoid::fill_game_update(&update, send_elements);
+
+  bool const force_sending = events.has_pending()
+                             || std::any_of(send_elements.begin(), send_elements.end(), [](auto const *element_ptr) {
+                                  return element_ptr->get_type() != arkanoid::PADDLE;
+                                });
+  events.flush(update);
+
+  connection.send(std::move(pooled), force_sending);
 }
 
 void draw_information_texts(ftxui::Canvas &can,
   connection::Connection &connection,
+  arkanoid::RollbackState const *rollback,
+  arkanoid::Lockstep const *lockstep,
+  arkanoid::DesyncDetector const *desync,
+  std::size_t const frame_allocations,
   int const your_score,
   int const enemy_score)
 {
   using namespace arkanoid;
-  can.DrawText(
-    15, playing_field_bottom + 10, fmt::format("Synchronisationen versendet: {}", connection.game_updates_sent()));
+  can.DrawText(15,
+    playing_field_bottom + 10,
+    fmt::format("Synchronisationen versendet: {} ({} kB)",
+      connection.game_updates_sent(),
+      connection.bytes_sent() / 1024));
   can.DrawText(
     15, playing_field_bottom + 15, fmt::format("Synchronisationen empfangen: {}", connection.game_updates_received()));
-
-  can.DrawText(playing_field_right - 40, playing_field_bottom + 10, fmt::format("Deine Punkte: {}", your_score));
-  can.DrawText(playing_field_right - 40, playing_field_bottom + 15, fmt::format("Punkte Gegner: {}", enemy_score));
-}
-
-[[nodiscard]] bool find_paddle_ptrs(std::array<arkanoid::Paddle *, 2> &paddle_ptrs,
-  std::array<b2Fixture *, 2> const &back_plates,
-  std::map<int, std::unique_ptr<arkanoid::Element>> const &element_map,
-  ContactListener &listener)
-{
-  using namespace arkanoid;
-  if (paddle_ptrs[0] == nullptr || paddle_ptrs[1] == nullptr) {
-    auto found_iterator = std::find_if(
-      element_map.begin(), element_map.end(), [](const auto &pair) { return pair.second->get_type() == PADDLE; });
-
-    if (found_iterator != element_map.end()) {
-      std::for_each(found_iterator, element_map.end(), [&paddle_ptrs](auto const &pair) {
-        auto *element_ptr = pair.second.get();
-
-        if (element_ptr->get_type() == PADDLE) {
-          auto *paddle_ptr = dynamic_cast<Paddle *>(element_ptr);
-
-          if (paddle_ptr->is_controlled_by_this_game_instance()) {
-            paddle_ptrs[0] = paddle_ptr;
-          } else {
-            paddle_ptrs[1] = paddle_ptr;
-          }
-        }
-      });
-
-      if (paddle_ptrs[0] != nullptr && paddle_ptrs[1] != nullptr && back_plates[0] != nullptr
-          && back_plates[1] != nullptr) {
-        auto const distance_paddle_0_to_plate_0 =
-          std::abs(arkanoid::convert_to_arkanoid_coords(back_plates[0]->GetBody()->GetPosition()).y
-                   - paddle_ptrs[0]->center_position().y);
-        auto const distance_paddle_1_to_plate_0 =
-          std::abs(arkanoid::convert_to_arkanoid_coords(back_plates[0]->GetBody()->GetPosition()).y
-                   - paddle_ptrs[1]->center_position().y);
-        if (distance_paddle_0_to_plate_0 <= distance_paddle_1_to_plate_0) {
-          listener.add_back_plate(back_plates[0], paddle_ptrs[0]);
-          listener.add_back_plate(back_plates[1], paddle_ptrs[1]);
-        } else {
-          listener.add_back_plate(back_plates[0], paddle_ptrs[1]);
-          listener.add_back_plate(back_plates[1], paddle_ptrs[0]);
-        }
-      }
-    }
+  auto const latency = connection.latency();
+  can.DrawText(15,
+    playing_field_bottom + 20,
+    fmt::format("Latenz: {:.1f} ms (p95 {:.1f}, Jitter {:.1f}), Uhrversatz {:.1f} ms",
+      latency.rtt_ms,
+      latency.rtt_p95_ms,
+      latency.jitter_ms,
+      latency.clock_offset_ms));
+  can.DrawText(15,
+    playing_field_bottom + 25,
+    fmt::format("Warteschlange: {} (zusammengefasst: {}, verworfen: {})",
+      connection.send_queue_depth(),
+      connection.states_coalesced(),
+      connection.game_updates_dropped()));
+
+  if (connection.transport() == connection::Transport::UDP) {
+    can.DrawText(playing_field_right - 40,
+      playing_field_bottom + 20,
+      fmt::format("Wiederholt: {}", connection.packets_retransmitted()));
+    can.DrawText(playing_field_right - 40,
+      playing_field_bottom + 25,
+      fmt::format("Veraltet: {}", connection.stale_packets_discarded()));
   }
 
-  return paddle_ptrs[0] != nullptr;
-}
-
-void update_paddle_position(arkanoid::Paddle *paddle_ptr, int const mouse_x)
-{
-  using namespace arkanoid;
-  int new_paddle_x = mouse_x;
-  int const half_width = paddle_ptr->width() / 2;
-  std::pair<int, int> constrains{ playing_field_left + half_width, playing_field_right - half_width };
-
-  if (new_paddle_x < constrains.first) { new_paddle_x = constrains.first; }
-  if (new_paddle_x > constrains.second) { new_paddle_x = constrains.second; }// todo: auslagern
-  paddle_ptr->update_x(new_paddle_x);
-}
-
-[[nodiscard]] int get_winner(std::map<int, std::unique_ptr<arkanoid::Element>> const &elements,
-  std::array<arkanoid::Paddle *, 2> const &paddles)
-{
-  auto found = std::find_if(elements.begin(), elements.end(), [](auto const &pair) {
-    auto *const element = pair.second.get();
-
-    return element->get_type() == arkanoid::BRICK && element->exists();
-  });
+  if (rollback != nullptr) {
+    can.DrawText(15,
+      playing_field_bottom + 30,
+      fmt::format("Neu berechnete Ticks: {} (zuletzt {})",
+        rollback->ticks_resimulated(),
+        rollback->last_resimulation_depth()));
+  }
 
-  if (found == elements.end()) {
-    if (paddles[0] != nullptr && paddles[1] != nullptr) {
-      if (paddles[0]->score() > paddles[1]->score()) {
-        return 0;
-      } else if (paddles[0]->score() < paddles[1]->score()) {
-        return 1;
-      }
+  if (lockstep != nullptr) {
+    can.DrawText(15,
+      playing_field_bottom + 30,
+      fmt::format("Lockstep-Tick: {} (gewartet: {} Frames)", lockstep->tick(), lockstep->stalled_frames()));
+  }
 
-      return paddles.max_size();
-    }
+  if (desync != nullptr) {
+    can.DrawText(15,
+      playing_field_bottom + 5,
+      desync->mismatched() == 0
+        ? fmt::format("Prüfsummen gleich: {}", desync->matched())
+        : fmt::format("Abweichung ab Tick {} ({} von {} Prüfsummen)",
+          desync->first_desync_tick(),
+          desync->mismatched(),
+          desync->matched() + desync->mismatched()));
   }
 
-  return -1;
+  can.DrawText(playing_field_right - 40,
+    playing_field_bottom + 30,
+    fmt::format("Allokationen/Frame: {}", frame_allocations));
+
+  can.DrawText(playing_field_right - 40, playing_field_bottom + 10, fmt::format("Deine Punkte: {}", your_score));
+  can.DrawText(playing_field_right - 40, playing_field_bottom + 15, fmt::format("Punkte Gegner: {}", enemy_score));
 }
 
 void run_game(int const frame_rate,
@@ -485,55 +333,147 @@ void run_game(int const frame_rate,
   int &mouse_x,
   connection::Connection &connection,
   std::mutex &element_mutex,
-  std::map<int, std::unique_ptr<arkanoid::Element>> &element_map,
+  arkanoid::ElementStore &element_map,
   std::array<arkanoid::Paddle *, 2> &paddle_ptrs,
   std::array<b2Fixture *, 2> const &back_plates,
-  std::mutex &game_update_mutex,
   std::vector<arkanoid::Element *> &updated_elements,
   b2World &arkanoid_world,
-  ContactListener &listener)
+  ContactListener &listener,
+  arkanoid::RemoteEntityInterpolator &interpolator,
+  arkanoid::RollbackState *rollback,
+  arkanoid::Lockstep *lockstep,
+  std::array<arkanoid::Paddle *, 2> const &lockstep_players,
+  arkanoid::DesyncDetector *desync,
+  arkanoid::ReplayWriter *replay,
+  arkanoid::EventLog &events,
+  arkanoid::ProtobufCodec &state_codec,
+  ConnectionSettings const &settings,
+  std::function<void(GameUpdate &)> const &apply_update,
+  std::size_t &frame_allocations)
 {
   using namespace ftxui;
   using namespace arkanoid;
   auto const frame_time_budget{ std::chrono::seconds(1) / frame_rate };
   long frame{ 0 };
   int winner{ -1 };
+  int sent_mouse_x{ -1 };
+
+  // Ein Tick, wie er im Spiel und beim Neuberechnen nach einem Rollback abläuft.
+  auto simulate_tick = [&](long const tick, int const input_x) {
+    if (find_paddle_ptrs(paddle_ptrs, back_plates, element_map, listener)) {
+      update_paddle_position(paddle_ptrs[0], input_x);
+    }
+    if (rollback == nullptr) { interpolator.apply(element_map, tick); }
+
+    arkanoid_world.Step(1.0F / (frame_rate), 4, 2);
+
+    element_map.for_each([&updated_elements](auto &element) {
+      if (element.did_update()
+          && std::find(updated_elements.begin(), updated_elements.end(), &element) == updated_elements.end()) {
+        updated_elements.push_back(&element);
+      }
+    });
+
+    if (desync != nullptr) { desync->record_local(tick, state_hash(element_map)); }
+  };
 
   while (!loop.HasQuitted()) {
     const auto frame_start_time{ std::chrono::steady_clock::now() };
+    connection.set_local_tick(frame);
 
     screen.RequestAnimationFrame();// wichtig, da sonst keine aktualisierung, wenn aus fokus
     loop.RunOnce();
 
-    {
-      std::lock_guard<std::mutex> lock{ element_mutex };
+    // Gezählt wird nur der Spiel-Thread ohne die Darstellung: Empfangen, Simulieren und Senden.
+    auto const allocations_before = allocation_counter::thread_allocations();
 
-      if (find_paddle_ptrs(paddle_ptrs, back_plates, element_map, listener)) {
-        auto *paddle_ptr = paddle_ptrs[0];
-        update_paddle_position(paddle_ptr, mouse_x);
+    if (replay != nullptr) {
+      replay->set_tick(frame);
+      replay->record_input(mouse_x);
+    }
+
+    if (settings.via_server) {
+      // Der Server berechnet das Spiel; lokal folgt nur der eigene Schläger sofort der Maus.
+      {
+        std::lock_guard<std::mutex> lock{ element_mutex };
+        (void)connection.drain_received(apply_update);
+        if (find_paddle_ptrs(paddle_ptrs, back_plates, element_map, listener) && !settings.spectate) {
+          update_paddle_position(paddle_ptrs[0], mouse_x);
+        }
       }
 
-      arkanoid_world.Step(1.0F / (frame_rate), 4, 2);
+      if (!settings.spectate && mouse_x != sent_mouse_x) {
+        GameUpdate update;
+        update.set_tick(frame);
+        update.mutable_input()->set_mouse_x(mouse_x);
+        connection.send(update, true);
+        sent_mouse_x = mouse_x;
+      }
+    } else if (lockstep != nullptr) {
+      std::lock_guard<std::mutex> lock{ element_mutex };
+      (void)connection.drain_received(apply_update);
 
-      std::for_each(element_map.begin(), element_map.end(), [&updated_elements](auto const &pair) {
-        if (pair.second->did_update()) { updated_elements.push_back(pair.second.get()); }
-      });
+      // Die Partie beginnt, sobald beide Seiten sie aus dem seed des Hosts erzeugt haben.
+      if (lockstep_players[0] != nullptr) {
+        GameUpdate update;
+        (void)lockstep->schedule_local(mouse_x, update);
+
+        if (lockstep->ready()) {
+          step_lockstep(arkanoid_world, element_map, lockstep_players, lockstep->inputs(), 1.0F / (frame_rate));
+          if (desync != nullptr) { desync->record_local(lockstep->tick(), state_hash(element_map)); }
+          lockstep->advance();
+        } else {
+          lockstep->stall();
+          lockstep->fill_resend(update);
+        }
+
+        if (update.has_lockstep_input()) {
+          update.set_tick(frame);
+          if (desync != nullptr) { desync->fill_every(update, state_hash_interval_ticks); }
+          connection.send(std::move(update), true);
+        }
+      }
+    } else {
+      std::lock_guard<std::mutex> lock{ element_mutex };
+      // Alles, was seit dem letzten Tick empfangen wurde, auf einmal übernehmen.
+      (void)connection.drain_received(apply_update);
+
+      if (rollback != nullptr) {
+        // Beim Neuberechnen entstehen dieselben Ereignisse noch einmal; gesendet wurden sie schon.
+        auto const apply_remote = [&](GameUpdate const &update) {
+          events.apply(update, element_map, false);
+          parse_remote_update(state_codec, element_map, update, arkanoid_world);
+        };
+        events.set_recording(false);
+        (void)rollback->resimulate(arkanoid_world, element_map, listener, apply_remote, simulate_tick);
+        events.set_recording(true);
+        rollback->record(frame, mouse_x, arkanoid_world, element_map, apply_remote);
+      }
+
+      simulate_tick(frame, mouse_x);
+      if (frame % state_sync_interval_ticks == 0) { add_state_sync(updated_elements, element_map, paddle_ptrs[0]); }
     }
 
-    if (!updated_elements.empty()) {
-      create_and_send_new_game_update(updated_elements, connection, game_update_mutex);
+    bool const send_state_hash = desync != nullptr && lockstep == nullptr && frame % state_hash_interval_ticks == 0;
+    if (!updated_elements.empty() || events.has_pending() || send_state_hash) {
+      create_and_send_new_game_update(updated_elements, events, connection, frame, desync);
       updated_elements.clear();
     }
 
+    frame_allocations = allocation_counter::thread_allocations() - allocations_before;
+
     {
-      if (frame % frame_rate == 0) {
-        std::lock_guard<std::mutex> lock{ element_mutex };
-        winner = get_winner(element_map, paddle_ptrs);
+      std::lock_guard<std::mutex> lock{ element_mutex };
+      element_map.disable_destroyed_bricks();
+      if (replay != nullptr && replay->keyframe_due()) {
+        replay->record_keyframe(
+          arkanoid_world, element_map, paddle_ptrs[0], lockstep != nullptr ? lockstep->tick() : 0);
+      }
+      winner = get_winner(element_map, paddle_ptrs);
 
-        if (winner >= 0) {
-          screen.Exit();
-          break;
-        }
+      if (winner >= 0) {
+        screen.Exit();
+        break;
       }
     }
 
@@ -542,6 +482,11 @@ void run_game(int const frame_rate,
     const auto unused_frame_time{ frame_time_budget - (frame_end_time - frame_start_time) };
     if (unused_frame_time > std::chrono::seconds(0)) { std::this_thread::sleep_for(unused_frame_time); }
   }
+
+  // Im Lockstep gelten beide Schläger als gesteuert; für die Anzeige wieder nur der eigene.
+  if (lockstep != nullptr && paddle_ptrs[1] != nullptr) {
+    paddle_ptrs[1]->set_is_controlled_by_this_game_instance(false);
+  }
   show_winner(winner, paddle_ptrs);
 }
 
@@ -551,15 +496,26 @@ int main()
   using namespace arkanoid;
 
 
-  show_connection_methods([](bool const as_host, int const &port) {
+  show_connection_methods([](ConnectionSettings const &settings) {
+    bool const as_host{ settings.as_host };
+    bool const use_rollback{ settings.use_rollback };
+    bool const use_lockstep{ settings.use_lockstep };
+    bool const via_server{ settings.via_server };
     auto screen = ScreenInteractive::FitComponent();
     constexpr int frame_rate = 40.0;
 
     std::mutex element_mutex;
-    std::mutex game_update_mutex;
-    std::map<int, std::unique_ptr<arkanoid::Element>> element_map;
-    std::map<b2Fixture *, arkanoid::Element *> b2_element_map;
+    ElementStore element_map;
     std::vector<arkanoid::Element *> updated_elements;
+    RemoteEntityInterpolator interpolator;
+    RollbackState rollback;
+    EventLog events;
+    ProtobufCodec state_codec;
+    DesyncDetector desync;
+    ReplayWriter replay;
+    Lockstep lockstep{ as_host ? 0 : 1, settings.transport == connection::Transport::UDP ? 4 : 1 };
+    std::array<Paddle *, 2> lockstep_players{ nullptr, nullptr };
+    std::size_t frame_allocations{ 0 };
 
     int const paddle_y{ playing_field_bottom - paddle_height };
     Vector const paddle_position{ (canvas_width / 2) - (paddle_width / 2), paddle_y };
@@ -568,19 +524,90 @@ int main()
     int mouse_x{ paddle_position.x_i() };
 
     b2World arkanoid_world{ { 0, 0 } };
-    ContactListener listener{ b2_element_map };
+    ContactListener listener;
     arkanoid_world.SetContactListener(&listener);
+    if (!via_server && !use_lockstep) { listener.set_event_log(&events); }
     auto const back_plates = build_b2_world_border(&arkanoid_world);
 
 
-    connection::Connection connection;
-    connection.register_receiver(
-      [&element_map, &element_mutex, &arkanoid_world, &b2_element_map](GameUpdate const &update) {
-        std::lock_guard<std::mutex> lock{ element_mutex };
-        arkanoid::parse_game_update(element_map, update, &arkanoid_world, b2_element_map);
-      });
+    connection::Connection connection{ settings.transport, wire_quantization() };
+    if (settings.record_replay) {
+      auto const mode = settings.spectate ? ReplayMode::SPECTATOR
+                        : via_server      ? ReplayMode::SERVER
+                        : use_lockstep    ? ReplayMode::LOCKSTEP
+                        : use_rollback    ? ReplayMode::ROLLBACK
+                                          : ReplayMode::PEER;
+      if (replay.open(as_host ? "arkanoid_host.replay" : "arkanoid_client.replay", mode, frame_rate)) {
+        connection.set_observer(
+          [&replay](GameUpdate const &update, bool const sent) { replay.record_update(update, sent); });
+      }
+    }
 
-    connect_to_peer(connection, as_host, port);
+    // Erzeugt die Lockstep-Partie aus dem seed des Hosts; auf beiden Seiten mit denselben Aufrufen.
+    auto const start_lockstep = [&](std::uint32_t const brick_seed) {
+      generate_arkanoid_elements(paddle_position,
+        { playing_field_bottom - paddle_height },
+        { paddle_width / 2, -10 },
+        { ball_velocity_x, ball_velocity_y },
+        &arkanoid_world,
+        element_map,
+        brick_seed);
+      lockstep_players = prepare_lockstep_match(element_map, listener, back_plates);
+      paddle_ptrs = as_host ? lockstep_players : std::array<Paddle *, 2>{ lockstep_players[1], lockstep_players[0] };
+    };
+
+    // Wird von run_game zu Beginn jedes Ticks für die empfangenen Zustände aufgerufen.
+    auto const apply_update = [&](GameUpdate &update) {
+      if (use_lockstep) {
+        if (update.has_lockstep_start() && lockstep_players[0] == nullptr) {
+          start_lockstep(update.lockstep_start().brick_seed());
+        }
+        lockstep.receive(update);
+        desync.receive(update);
+        return;
+      }
+
+      if (via_server) {
+        if (settings.spectate) {
+          arkanoid::parse_game_update(element_map, update, &arkanoid_world);
+          return;
+        }
+
+        // Die Position des eigenen Schlägers bestimmt die lokale Eingabe, nicht der verspätete Serverzustand.
+        auto *const own_paddle = paddle_ptrs[0];
+        Vector const own_position = (own_paddle != nullptr) ? own_paddle->center_position() : Vector{ 0, 0 };
+        arkanoid::parse_game_update(element_map, update, &arkanoid_world);
+        if (own_paddle != nullptr) { own_paddle->set_position(own_position); }
+        return;
+      }
+
+      desync.receive(update);
+      // Reine Prüfsummen ändern nichts am Zustand und sollen kein Rollback auslösen.
+      if (update.element_size() == 0 && update.event_size() == 0 && update.state().empty()) { return; }
+
+      if (use_rollback) {
+        // Das Update zeigt den Zustand nach dem Tick update.tick() der Gegenstelle, also zu Beginn ihres nächsten.
+        // Über die Tick-Zuordnung der Pings wird daraus ein lokaler Tick; bis der erste Ping da ist, gilt das Update
+        // als eine halbe Umlaufzeit alt.
+        if (auto const local_tick = connection.to_local_tick(update.tick() + 1, frame_rate)) {
+          rollback.defer_at(std::move(update), *local_tick);
+        } else {
+          auto const tick_ms = 1000.0 / frame_rate;
+          rollback.defer(
+            std::move(update), static_cast<int>(std::lround(connection.latency().rtt_ms / 2.0 / tick_ms)));
+        }
+        return;
+      }
+
+      interpolator.record(update);
+      // Erst die Ereignisse, dann die Zustände: Diese sind mindestens so neu wie die Ereignisse desselben Updates.
+      events.apply(update, element_map, true);
+      parse_remote_update(state_codec, element_map, update, arkanoid_world);
+      interpolator.apply(element_map);
+    };
+
+    connect_to_peer(
+      connection, as_host, settings.spectate ? settings.port + connection::spectator_port_offset : settings.port);
     show_connecting_state(connection);
 
     if (as_host) {
@@ -588,18 +615,25 @@ int main()
       {
         std::lock_guard<std::mutex> lock{ element_mutex };
 
-        generate_arkanoid_elements(paddle_position,
-          { playing_field_bottom - paddle_height },
-          { paddle_width / 2, -10 },
-          { ball_velocity_x, ball_velocity_y },
-          &arkanoid_world,
-          element_map,
-          b2_element_map);
+        if (use_lockstep) {
+          // Im Lockstep genügt der seed: Die Gegenstelle erzeugt daraus dieselbe Partie.
+          GameUpdate update;
+          update.mutable_lockstep_start()->set_brick_seed(std::random_device{}());
+          start_lockstep(update.lockstep_start().brick_seed());
+          connection.send(update, true);
+        } else {
+          generate_arkanoid_elements(paddle_position,
+            { playing_field_bottom - paddle_height },
+            { paddle_width / 2, -10 },
+            { ball_velocity_x, ball_velocity_y },
+            &arkanoid_world,
+            element_map);
 
-        GameUpdate update;
-        arkanoid::fill_game_update(&update, map_values(element_map));
+          GameUpdate update;
+          arkanoid::fill_game_update(&update, element_map.values());
 
-        connection.send(update, true);
+          connection.send(update, true);
+        }
       }
     }
 
@@ -613,14 +647,20 @@ int main()
 
         {
           std::lock_guard<std::mutex> lock{ element_mutex };
-          std::for_each(
-            element_map.begin(), element_map.end(), [&can](auto const &pair) { draw(can, *(pair.second)); });
+          element_map.for_each([&can](auto &element) { draw(can, element); });
 
           if (paddle_ptrs[0] != nullptr) { your_score = paddle_ptrs[0]->score(); }
           if (paddle_ptrs[1] != nullptr) { enemy_score = paddle_ptrs[1]->score(); }
         }
 
-        draw_information_texts(can, connection, your_score, enemy_score);
+        draw_information_texts(can,
+          connection,
+          use_rollback ? &rollback : nullptr,
+          use_lockstep ? &lockstep : nullptr,
+          settings.check_sync ? &desync : nullptr,
+          frame_allocations,
+          your_score,
+          enemy_score);
 
         can.DrawBlockLine(
           playing_field_left, playing_field_top, playing_field_left, playing_field_bottom, ftxui::Color::GrayLight);
@@ -651,12 +691,21 @@ int main()
         element_map,
         paddle_ptrs,
         back_plates,
-        game_update_mutex,
         updated_elements,
         arkanoid_world,
-        listener);
+        listener,
+        interpolator,
+        use_rollback ? &rollback : nullptr,
+        use_lockstep ? &lockstep : nullptr,
+        lockstep_players,
+        settings.check_sync ? &desync : nullptr,
+        replay.is_open() ? &replay : nullptr,
+        events,
+        state_codec,
+        settings,
+        apply_update,
+        frame_allocations);
 
-      std::lock_guard<std::mutex> game_update_lock{ game_update_mutex };
       connection.close();
     }
   });
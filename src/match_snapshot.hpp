@@ -0,0 +1,320 @@
+#ifndef MATCH_SNAPSHOT_CPP
+#define MATCH_SNAPSHOT_CPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "box2d-incl/box2d/b2_body.h"
+#include "box2d-incl/box2d/b2_collision.h"
+#include "box2d-incl/box2d/b2_contact.h"
+#include "box2d-incl/box2d/b2_fixture.h"
+#include "box2d-incl/box2d/b2_math.h"
+#include "box2d-incl/box2d/b2_world.h"
+
+#include "arkanoid_elements.hpp"
+
+namespace arkanoid {
+
+// Der vollständige Zustand einer Partie in einem zusammenhängenden Block: alle Körper der b2World mit Lage und
+// Geschwindigkeit, die Impulse der Kontakte für den Warmstart, Haltbarkeiten, Punkte, der zuletzt spielende Schläger
+// jedes Balls und die zuletzt vergebene id. Verwiesen wird über Positionen statt Zeiger, damit der Block auch in
+// eine gleich aufgebaute Welt eines anderen Prozesses passt, etwa für Spielstände oder einen Wiedereinstieg.
+//
+// Der Warmstart geht mit: Nach dem Zurücksetzen rechnet der nächste Step wie ohne Unterbrechung. Ob sich zwei Körper
+// gerade berühren, lässt sich über die Schnittstelle von Box2D nicht setzen; dieser Zustand bleibt, wie er vor dem
+// Zurücksetzen war. Der WorldSnapshot des Rollbacks baut dafür die Kontakte neu auf, hängt aber an Zeigern.
+class MatchSnapshot
+{
+private:
+  static std::uint32_t constexpr magic{ 0x4B52414D };// "MARK"
+  static std::uint16_t constexpr version{ 1 };
+
+  struct Header
+  {
+    std::uint32_t magic;
+    std::uint16_t version;
+    std::uint16_t reserved;
+    std::int64_t tick;
+    std::int32_t current_id;
+    std::uint32_t bodies, contacts, paddles, balls, bricks;
+  };
+
+  struct BodyRecord
+  {
+    b2Vec2 position;
+    float angle;
+    b2Vec2 linear_velocity;
+    float angular_velocity;
+    std::uint16_t awake, enabled;// 16 Bit, damit der Block keine unbestimmten Füllbytes enthält
+  };
+
+  // Kontakte nach Körperpaar sortiert, damit restore sie ohne Tabelle findet. Die Spielelemente haben je eine
+  // Fixture.
+  struct ContactRecord
+  {
+    std::uint32_t body_a, body_b;
+    std::uint32_t point_count;
+    std::uint32_t keys[b2_maxManifoldPoints];
+    float normal_impulses[b2_maxManifoldPoints], tangent_impulses[b2_maxManifoldPoints];
+  };
+
+  struct PaddleRecord
+  {
+    std::int32_t score;
+  };
+
+  struct BallRecord
+  {
+    std::int32_t last_paddle_id;// -1 ohne Schläger
+  };
+
+  struct BrickRecord
+  {
+    std::int32_t duration;
+  };
+
+  std::vector<std::byte> m_blob;
+  // Nur während capture und restore: Körper nach Adresse, um Kontakte den Positionen zuzuordnen.
+  mutable std::vector<std::pair<b2Body const *, std::uint32_t>> m_body_index;
+  std::vector<ContactRecord> m_contacts;
+
+  template<typename T>//
+  [[nodiscard]] static std::size_t bytes(std::size_t const count)
+  {
+    static_assert(std::is_trivially_copyable_v<T>);
+    return sizeof(T) * count;
+  }
+
+  [[nodiscard]] static std::size_t blob_size(Header const &header)
+  {
+    return sizeof(Header) + bytes<BodyRecord>(header.bodies) + bytes<ContactRecord>(header.contacts)
+           + bytes<PaddleRecord>(header.paddles) + bytes<BallRecord>(header.balls)
+           + bytes<BrickRecord>(header.bricks);
+  }
+
+  template<typename T>//
+  static void write(std::byte *&out, T const &record)
+  {
+    std::memcpy(out, &record, sizeof(T));
+    out += sizeof(T);
+  }
+
+  template<typename T>//
+  [[nodiscard]] static T read(std::byte const *&in)
+  {
+    T record;
+    std::memcpy(&record, in, sizeof(T));
+    in += sizeof(T);
+    return record;
+  }
+
+  void index_bodies(b2World const &world) const
+  {
+    m_body_index.clear();
+    std::uint32_t index{ 0 };
+    for (auto const *body = world.GetBodyList(); body != nullptr; body = body->GetNext()) {
+      m_body_index.emplace_back(body, index++);
+    }
+    std::sort(m_body_index.begin(), m_body_index.end());
+  }
+
+  [[nodiscard]] std::uint32_t body_index(b2Body const *body) const
+  {
+    auto const found = std::lower_bound(
+      m_body_index.begin(), m_body_index.end(), std::pair<b2Body const *, std::uint32_t>{ body, 0 });
+    return found->second;
+  }
+
+  // Körperpaar eines Kontakts, kleinere Position zuerst.
+  [[nodiscard]] std::pair<std::uint32_t, std::uint32_t> body_pair(b2Contact const *contact) const
+  {
+    auto const a = body_index(contact->GetFixtureA()->GetBody());
+    auto const b = body_index(contact->GetFixtureB()->GetBody());
+    return { std::min(a, b), std::max(a, b) };
+  }
+
+  [[nodiscard]] ContactRecord contact_at(std::uint32_t const index) const
+  {
+    auto const *in = m_blob.data() + sizeof(Header) + bytes<BodyRecord>(header().bodies)
+                     + bytes<ContactRecord>(index);
+    return read<ContactRecord>(in);
+  }
+
+  [[nodiscard]] Header header() const
+  {
+    Header header{};
+    if (m_blob.size() >= sizeof(Header)) { std::memcpy(&header, m_blob.data(), sizeof(Header)); }
+    return header;
+  }
+
+public:
+  // Der Block behält seine Kapazität, sodass wiederholtes Sichern nach dem ersten Mal nicht alloziert.
+  void capture(b2World const &world, ElementStore const &elements, std::int64_t const tick)
+  {
+    Header header{ magic,
+      version,
+      0,
+      tick,
+      elements.current_id(),
+      static_cast<std::uint32_t>(world.GetBodyCount()),
+      0,// Kontakte, siehe unten
+      static_cast<std::uint32_t>(elements.paddles().size()),
+      static_cast<std::uint32_t>(elements.balls().size()),
+      static_cast<std::uint32_t>(elements.bricks().size()) };
+
+    index_bodies(world);
+    m_contacts.clear();
+    for (auto const *contact = world.GetContactList(); contact != nullptr; contact = contact->GetNext()) {
+      auto const *manifold = contact->GetManifold();
+      if (manifold->pointCount == 0) { continue; }
+
+      auto const [a, b] = body_pair(contact);
+      ContactRecord record{ a, b, static_cast<std::uint32_t>(manifold->pointCount), {}, {}, {} };
+      for (int i{ 0 }; i < manifold->pointCount; ++i) {
+        record.keys[i] = manifold->points[i].id.key;
+        record.normal_impulses[i] = manifold->points[i].normalImpulse;
+        record.tangent_impulses[i] = manifold->points[i].tangentImpulse;
+      }
+      m_contacts.push_back(record);
+    }
+    std::sort(m_contacts.begin(), m_contacts.end(), [](ContactRecord const &left, ContactRecord const &right) {
+      return std::pair{ left.body_a, left.body_b } < std::pair{ right.body_a, right.body_b };
+    });
+    header.contacts = static_cast<std::uint32_t>(m_contacts.size());
+    m_blob.resize(blob_size(header));
+
+    auto *out = m_blob.data();
+    write(out, header);
+    for (auto const *body = world.GetBodyList(); body != nullptr; body = body->GetNext()) {
+      write(out,
+        BodyRecord{ body->GetPosition(),
+          body->GetAngle(),
+          body->GetLinearVelocity(),
+          body->GetAngularVelocity(),
+          static_cast<std::uint16_t>(body->IsAwake()),
+          static_cast<std::uint16_t>(body->IsEnabled()) });
+    }
+    for (auto const &record : m_contacts) { write(out, record); }
+
+    elements.paddles().for_each([&out](Paddle &paddle) { write(out, PaddleRecord{ paddle.score() }); });
+    elements.balls().for_each([&out](Ball &ball) {
+      auto const *last_paddle = ball.last_paddle();
+      write(out, BallRecord{ last_paddle != nullptr ? last_paddle->id() : -1 });
+    });
+    elements.bricks().for_each([&out](Brick &brick) { write(out, BrickRecord{ brick.duration() }); });
+  }
+
+  // Setzt Welt und Elemente auf den gesicherten Stand. Die Welt muss gleich aufgebaut sein: dieselben Körper in
+  // derselben Reihenfolge und dieselbe Anzahl Elemente je Art. Gibt sonst false zurück, ohne etwas zu ändern.
+  // Wie beim WorldSnapshot werden nur Körper versetzt, die sich seit dem Sichern bewegt haben.
+  [[nodiscard]] bool restore(b2World &world, ElementStore &elements) const
+  {
+    auto const header = this->header();
+    if (!valid() || header.bodies != static_cast<std::uint32_t>(world.GetBodyCount())
+        || header.paddles != elements.paddles().size() || header.balls != elements.balls().size()
+        || header.bricks != elements.bricks().size()) {
+      return false;
+    }
+
+    auto const *in = m_blob.data() + sizeof(Header);
+    for (auto *body = world.GetBodyList(); body != nullptr; body = body->GetNext()) {
+      auto const state = read<BodyRecord>(in);
+
+      if (body->IsEnabled() != (state.enabled != 0)) { body->SetEnabled(state.enabled != 0); }
+      if (!(body->GetPosition() == state.position) || body->GetAngle() != state.angle) {
+        body->SetTransform(state.position, state.angle);
+      }
+      if (body->GetType() == b2_staticBody) { continue; }
+
+      body->SetAwake(state.awake != 0);
+      body->SetLinearVelocity(state.linear_velocity);
+      body->SetAngularVelocity(state.angular_velocity);
+    }
+    world.ClearForces();
+
+    // Der nächste Step übernimmt die Impulse aus den alten Punkten gleicher id. Kontakte, die es beim Sichern nicht
+    // gab, starten ohne Warmstart; fehlende legt Box2D beim nächsten Step ohne Impulse an.
+    index_bodies(world);
+    for (auto *contact = world.GetContactList(); contact != nullptr; contact = contact->GetNext()) {
+      auto const pair = body_pair(contact);
+      std::uint32_t first{ 0 }, last{ header.contacts };
+      while (first < last) {
+        auto const middle = first + ((last - first) / 2);
+        auto const record = contact_at(middle);
+        if (std::pair{ record.body_a, record.body_b } < pair) {
+          first = middle + 1;
+        } else {
+          last = middle;
+        }
+      }
+
+      auto *manifold = contact->GetManifold();
+      auto const record = (first < header.contacts) ? contact_at(first) : ContactRecord{};
+      if (first == header.contacts || std::pair{ record.body_a, record.body_b } != pair) {
+        manifold->pointCount = 0;
+        continue;
+      }
+
+      manifold->pointCount = static_cast<int>(record.point_count);
+      for (std::uint32_t i{ 0 }; i < record.point_count; ++i) {
+        manifold->points[i].id.key = record.keys[i];
+        manifold->points[i].normalImpulse = record.normal_impulses[i];
+        manifold->points[i].tangentImpulse = record.tangent_impulses[i];
+      }
+    }
+    in += bytes<ContactRecord>(header.contacts);
+
+    elements.paddles().for_each([&in](Paddle &paddle) { paddle.set_score(read<PaddleRecord>(in).score); });
+    elements.balls().for_each([&in, &elements](Ball &ball) {
+      ball.set_last_paddle(element_cast<Paddle>(elements.find(read<BallRecord>(in).last_paddle_id)));
+      ball.apply_forces();
+    });
+    elements.bricks().for_each([&in](Brick &brick) { brick.set_duration(read<BrickRecord>(in).duration); });
+
+    elements.restore_current_id(header.current_id);
+    return true;
+  }
+
+  // Übernimmt einen gespeicherten Block, etwa aus einem Spielstand. Gibt false zurück, wenn er nicht passt oder
+  // Kontakte mit mehr Punkten als ein Manifold oder unbekannten Körpern enthält.
+  [[nodiscard]] bool assign(std::span<std::byte const> const blob)
+  {
+    Header header{};
+    if (blob.size() < sizeof(Header)) { return false; }
+    std::memcpy(&header, blob.data(), sizeof(Header));
+    if (header.magic != magic || header.version != version || blob_size(header) != blob.size()) { return false; }
+
+    // restore schreibt point_count Punkte in das Manifold und sucht Kontakte über die Positionen der Körper.
+    auto const *in = blob.data() + sizeof(Header) + bytes<BodyRecord>(header.bodies);
+    for (std::uint32_t i{ 0 }; i < header.contacts; ++i) {
+      auto const record = read<ContactRecord>(in);
+      if (record.point_count > std::uint32_t{ b2_maxManifoldPoints } || record.body_a >= header.bodies
+          || record.body_b >= header.bodies) {
+        return false;
+      }
+    }
+
+    m_blob.assign(blob.begin(), blob.end());
+    return true;
+  }
+
+  [[nodiscard]] bool valid() const
+  {
+    auto const header = this->header();
+    return header.magic == magic && header.version == version && blob_size(header) == m_blob.size();
+  }
+
+  [[nodiscard]] std::span<std::byte const> data() const { return m_blob; }
+  [[nodiscard]] std::size_t size() const { return m_blob.size(); }
+  [[nodiscard]] std::int64_t tick() const { return header().tick; }
+};
+
+}// namespace arkanoid
+
+#endif
@@ -0,0 +1,106 @@
+#ifndef MPSC_QUEUE_CPP
+#define MPSC_QUEUE_CPP
+
+#include <atomic>
+#include <optional>
+#include <utility>
+
+// Lock-freie Warteschlange für beliebig viele Produzenten und genau einen Konsumenten. Der Konsument legt
+// verbrauchte Knoten in eine Freiliste, aus der die Produzenten sie wieder nehmen; nach dem Aufwärmen kostet push()
+// so keine Heap-Allokation.
+template<typename T>//
+class MpscQueue
+{
+private:
+  struct Node
+  {
+    std::atomic<Node *> next{ nullptr };
+    std::optional<T> value;
+  };
+
+  std::atomic<Node *> m_head;
+  Node *m_tail;
+  std::atomic<std::size_t> m_size{ 0 };
+  std::atomic<Node *> m_spare{ nullptr };// über next verkettet
+
+  // Hängt die Kette first..last vor die Freiliste.
+  void release_nodes(Node *first, Node *last)
+  {
+    Node *spare = m_spare.load(std::memory_order_relaxed);
+    do {
+      last->next.store(spare, std::memory_order_relaxed);
+    } while (!m_spare.compare_exchange_weak(spare, first, std::memory_order_release, std::memory_order_relaxed));
+  }
+
+  // Ein einzelner Knoten lässt sich mit mehreren Produzenten nicht ohne ABA-Problem entnehmen. Deshalb wird die
+  // ganze Liste genommen und der Rest wieder eingehängt; sie ist kaum länger als die Warteschlange je war.
+  [[nodiscard]] Node *take_node()
+  {
+    Node *node = m_spare.exchange(nullptr, std::memory_order_acquire);
+    if (node == nullptr) { return new Node; }
+
+    if (Node *rest = node->next.load(std::memory_order_relaxed)) {
+      Node *last = rest;
+      while (Node *next = last->next.load(std::memory_order_relaxed)) { last = next; }
+      release_nodes(rest, last);
+    }
+    node->next.store(nullptr, std::memory_order_relaxed);
+    return node;
+  }
+
+public:
+  MpscQueue() : m_head{ new Node }, m_tail{ m_head.load() } {}
+
+  MpscQueue(MpscQueue const &) = delete;
+  MpscQueue &operator=(MpscQueue const &) = delete;
+
+  ~MpscQueue()
+  {
+    for (Node *node : { m_tail, m_spare.load(std::memory_order_acquire) }) {
+      while (node != nullptr) {
+        Node *next = node->next.load(std::memory_order_relaxed);
+        delete node;
+        node = next;
+      }
+    }
+  }
+
+  // Gibt die Anzahl der Elemente nach dem Einfügen zurück.
+  std::size_t push(T value)
+  {
+    auto *node = take_node();
+    node->value.emplace(std::move(value));
+
+    auto const size = m_size.fetch_add(1, std::memory_order_acq_rel) + 1;
+    Node *previous = m_head.exchange(node, std::memory_order_acq_rel);
+    previous->next.store(node, std::memory_order_release);
+    m_size.notify_one();
+
+    return size;
+  }
+
+  // Darf nur vom Konsumenten aufgerufen werden.
+  [[nodiscard]] std::optional<T> pop()
+  {
+    Node *next = m_tail->next.load(std::memory_order_acquire);
+    if (next == nullptr) { return std::nullopt; }
+
+    std::optional<T> value{ std::move(next->value) };
+    next->value.reset();
+    release_nodes(m_tail, m_tail);
+    m_tail = next;
+    m_size.fetch_sub(1, std::memory_order_acq_rel);
+
+    return value;
+  }
+
+  [[nodiscard]] std::size_t size() const { return m_size.load(std::memory_order_acquire); }
+
+  [[nodiscard]] bool empty() const { return size() == 0; }
+
+  // Blockiert den Konsumenten, solange die Warteschlange leer ist. Da size() vor dem Verketten erhöht wird,
+  // kann pop() danach kurzzeitig noch leer sein.
+  void wait_while_empty() const { m_size.wait(0, std::memory_order_acquire); }
+};
+
+#endif
@@ -0,0 +1,213 @@
+#ifndef QUANTIZATION_CPP
+#define QUANTIZATION_CPP
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <string>
+
+#include "arkanoid.pb.h"
+
+namespace connection {
+
+// Wertebereich mit fester Auflösung. Ist precision eine Zweierpotenz und min ein Vielfaches davon, liegt 0 exakt
+// auf dem Raster und bleibt damit der proto3-Standardwert.
+struct QuantizedRange
+{
+  float min{ 0.0F }, max{ 0.0F }, precision{ 0.0F };
+
+  [[nodiscard]] int bits() const
+  {
+    auto const steps = static_cast<double>(max - min) / static_cast<double>(precision);
+    return static_cast<int>(std::ceil(std::log2(steps + 1.0)));
+  }
+
+  [[nodiscard]] std::uint32_t quantize(float const value) const
+  {
+    return static_cast<std::uint32_t>(std::lround((std::clamp(value, min, max) - min) / precision));
+  }
+
+  [[nodiscard]] float dequantize(std::uint32_t const value) const
+  {
+    return min + (static_cast<float>(value) * precision);
+  }
+
+  [[nodiscard]] float snap(float const value) const { return dequantize(quantize(value)); }
+};
+
+// Ohne Auflösung (Standard) werden Positionen und Geschwindigkeiten unverändert als float übertragen.
+struct Quantization
+{
+  QuantizedRange position_x, position_y, velocity;
+
+  [[nodiscard]] bool enabled() const { return position_x.precision > 0.0F; }
+};
+
+class BitWriter
+{
+private:
+  std::string &m_out;
+  std::uint64_t m_buffer{ 0 };
+  int m_bits{ 0 };
+
+public:
+  explicit BitWriter(std::string &out) : m_out{ out } {}
+
+  void write(std::uint32_t const value, int const bits)
+  {
+    m_buffer |= static_cast<std::uint64_t>(value) << m_bits;
+    m_bits += bits;
+
+    while (m_bits >= 8) {
+      m_out.push_back(static_cast<char>(m_buffer & 0xFFU));
+      m_buffer >>= 8U;
+      m_bits -= 8;
+    }
+  }
+
+  void flush()
+  {
+    if (m_bits > 0) { m_out.push_back(static_cast<char>(m_buffer & 0xFFU)); }
+    m_buffer = 0;
+    m_bits = 0;
+  }
+};
+
+class BitReader
+{
+private:
+  std::string const &m_in;
+  std::size_t m_position{ 0 };
+  std::uint64_t m_buffer{ 0 };
+  int m_bits{ 0 };
+
+public:
+  explicit BitReader(std::string const &in) : m_in{ in } {}
+
+  // Fehlende Bytes am Ende werden als 0 gelesen.
+  [[nodiscard]] std::uint32_t read(int const bits)
+  {
+    while (m_bits < bits) {
+      auto const byte = (m_position < m_in.size()) ? static_cast<std::uint8_t>(m_in[m_position++]) : 0U;
+      m_buffer |= static_cast<std::uint64_t>(byte) << m_bits;
+      m_bits += 8;
+    }
+
+    auto const value = static_cast<std::uint32_t>(m_buffer & ((std::uint64_t{ 1 } << bits) - 1));
+    m_buffer >>= bits;
+    m_bits -= bits;
+
+    return value;
+  }
+};
+
+// Rundet Position und Geschwindigkeit auf das Raster, damit Unterschiede unterhalb der Auflösung bei der
+// Delta-Kodierung als unverändert gelten und beide Seiten dieselben Zustände speichern.
+void snap_element(GameElement &element, Quantization const &quantization)
+{
+  if (!quantization.enabled()) { return; }
+
+  if (element.has_element_position()) {
+    auto *position = element.mutable_element_position();
+    position->set_x(quantization.position_x.snap(position->x()));
+    position->set_y(quantization.position_y.snap(position->y()));
+  }
+  if (element.has_ball()) {
+    auto *ball = element.mutable_ball();
+    ball->set_velocity_x(quantization.velocity.snap(ball->velocity_x()));
+    ball->set_velocity_y(quantization.velocity.snap(ball->velocity_y()));
+  }
+}
+
+enum PackedField : std::uint32_t {
+  PACKED_POSITION_X = 1U << 0U,
+  PACKED_POSITION_Y = 1U << 1U,
+  PACKED_VELOCITY_X = 1U << 2U,
+  PACKED_VELOCITY_Y = 1U << 3U
+};
+int constexpr packed_mask_bits{ 4 };
+
+// Position und Geschwindigkeit in der Reihenfolge von PackedField.
+using PackedValues = std::array<float, packed_mask_bits>;
+
+[[nodiscard]] std::array<QuantizedRange const *, packed_mask_bits> packed_ranges(Quantization const &quantization)
+{
+  return { &quantization.position_x, &quantization.position_y, &quantization.velocity, &quantization.velocity };
+}
+
+// 4 Bit Maske der von 0 verschiedenen Werte, danach diese Werte mit der Bitbreite ihres Bereichs. Gibt die Maske
+// zurück; ist sie 0, bleibt out unverändert.
+std::uint32_t pack_values(std::string &out, PackedValues const &values, Quantization const &quantization)
+{
+  std::uint32_t mask{ 0 };
+  for (std::size_t i{ 0 }; i < values.size(); ++i) {
+    if (values[i] != 0.0F) { mask |= 1U << i; }
+  }
+  if (mask == 0) { return mask; }
+
+  auto const ranges = packed_ranges(quantization);
+  out.clear();
+  BitWriter writer{ out };
+  writer.write(mask, packed_mask_bits);
+  for (std::size_t i{ 0 }; i < values.size(); ++i) {
+    if ((mask & (1U << i)) != 0) { writer.write(ranges[i]->quantize(values[i]), ranges[i]->bits()); }
+  }
+  writer.flush();
+
+  return mask;
+}
+
+// Gegenstück zu pack_values; nicht enthaltene Werte bleiben 0. Gibt die Maske zurück.
+std::uint32_t unpack_values(std::string const &in, PackedValues &values, Quantization const &quantization)
+{
+  auto const ranges = packed_ranges(quantization);
+  BitReader reader{ in };
+  auto const mask = reader.read(packed_mask_bits);
+  values.fill(0.0F);
+  for (std::size_t i{ 0 }; i < values.size(); ++i) {
+    if ((mask & (1U << i)) != 0) { values[i] = ranges[i]->dequantize(reader.read(ranges[i]->bits())); }
+  }
+
+  return mask;
+}
+
+// Verschiebt alle gesetzten Positions- und Geschwindigkeitswerte in das Feld packed, siehe pack_values.
+void pack_element(GameElement &element, Quantization const &quantization)
+{
+  if (!quantization.enabled()) { return; }
+
+  auto const &position = element.element_position();
+  auto const &ball = element.ball();
+  PackedValues const values{ position.x(), position.y(), ball.velocity_x(), ball.velocity_y() };
+  if (pack_values(*element.mutable_packed(), values, quantization) == 0) {
+    element.clear_packed();
+    return;
+  }
+
+  element.clear_element_position();
+  if (element.has_ball()) {
+    element.mutable_ball()->clear_velocity_x();
+    element.mutable_ball()->clear_velocity_y();
+    // Bei Deltas ergibt sich die Art des Elements aus der Basis.
+    if (element.baseline_age() != 0) { element.clear_ball(); }
+  }
+}
+
+void unpack_element(GameElement &element, Quantization const &quantization)
+{
+  if (!quantization.enabled() || element.packed().empty()) { return; }
+
+  PackedValues values{};
+  auto const mask = unpack_values(element.packed(), values, quantization);
+  if ((mask & PACKED_POSITION_X) != 0) { element.mutable_element_position()->set_x(values[0]); }
+  if ((mask & PACKED_POSITION_Y) != 0) { element.mutable_element_position()->set_y(values[1]); }
+  if ((mask & PACKED_VELOCITY_X) != 0) { element.mutable_ball()->set_velocity_x(values[2]); }
+  if ((mask & PACKED_VELOCITY_Y) != 0) { element.mutable_ball()->set_velocity_y(values[3]); }
+
+  element.clear_packed();
+}
+
+}// namespace connection
+
+#endif
@@ -0,0 +1,307 @@
+#ifndef RELIABLE_UDP_CPP
+#define RELIABLE_UDP_CPP
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+#include "arkanoid.pb.h"
+
+namespace connection {
+
+std::size_t constexpr max_datagram_payload{ 1200 };
+auto constexpr resend_interval{ std::chrono::milliseconds(100) };
+auto constexpr ack_interval{ std::chrono::milliseconds(50) };
+auto constexpr hello_interval{ std::chrono::milliseconds(250) };
+int constexpr max_unacknowledged_packets{ 16 };
+
+enum PacketKind : std::uint8_t { HELLO, HELLO_ACK, DATA };
+
+// Aufbau (little endian): kind u8 | sequence u16 | ack u16 | ack_bits u32 | flags u8 | [message_id u16]
+struct PacketHeader
+{
+  static std::size_t constexpr max_size{ 12 };
+  static std::uint8_t constexpr reliable_flag{ 1 };
+
+  PacketKind kind{ DATA };
+  std::uint16_t sequence{ 0 }, ack{ 0 };
+  std::uint32_t ack_bits{ 0 };
+  bool reliable{ false };
+  std::uint16_t message_id{ 0 };
+
+  std::size_t encode(std::uint8_t *out) const
+  {
+    std::size_t length{ 0 };
+    auto put = [&out, &length](std::uint32_t const value, std::size_t const bytes) {
+      for (std::size_t i{ 0 }; i < bytes; ++i) { out[length++] = static_cast<std::uint8_t>(value >> (8U * i)); }
+    };
+
+    put(kind, 1);
+    put(sequence, 2);
+    put(ack, 2);
+    put(ack_bits, 4);
+    put(reliable ? reliable_flag : 0, 1);
+    if (reliable) { put(message_id, 2); }
+
+    return length;
+  }
+
+  // Gibt die Länge des Headers zurück oder 0, falls das Paket zu kurz ist.
+  [[nodiscard]] std::size_t decode(std::uint8_t const *data, std::size_t const size)
+  {
+    std::size_t length{ 0 };
+    auto get = [&data, &length](std::size_t const bytes) {
+      std::uint32_t value{ 0 };
+      for (std::size_t i{ 0 }; i < bytes; ++i) { value |= static_cast<std::uint32_t>(data[length++]) << (8U * i); }
+      return value;
+    };
+
+    if (size < max_size - 2) { return 0; }
+
+    kind = static_cast<PacketKind>(get(1));
+    sequence = static_cast<std::uint16_t>(get(2));
+    ack = static_cast<std::uint16_t>(get(2));
+    ack_bits = get(4);
+    reliable = (get(1) & reliable_flag) != 0;
+
+    if (reliable) {
+      if (size < max_size) { return 0; }
+      message_id = static_cast<std::uint16_t>(get(2));
+    }
+
+    return length;
+  }
+};
+
+[[nodiscard]] bool sequence_greater_than(std::uint16_t const a, std::uint16_t const b)
+{
+  return ((a > b) && (a - b <= 32768)) || ((a < b) && (b - a > 32768));
+}
+
+// Zu Beginn unbekannte Elemente, Steine und geänderte Punktestände müssen ankommen; alle übrigen Zustände
+// werden beim nächsten Update ohnehin überholt. Die Eingaben des Lockstep gehen unzuverlässig, aber mehrfach.
+class DeliveryClassifier
+{
+private:
+  std::unordered_set<int> m_known_ids;
+  std::map<int, int> m_last_scores;
+
+public:
+  [[nodiscard]] bool requires_reliable_delivery(GameElement const &element)
+  {
+    bool const new_id = m_known_ids.insert(element.id()).second;
+
+    if (element.has_brick()) { return true; }
+    if (element.has_paddle()) {
+      auto const [it, inserted] = m_last_scores.insert({ element.id(), element.paddle().score() });
+      bool const score_changed = !inserted && it->second != element.paddle().score();
+      it->second = element.paddle().score();
+      return new_id || score_changed;
+    }
+
+    return new_id;
+  }
+
+  void split(GameUpdate &update, GameUpdate &reliable)
+  {
+    // Ereignisse werden nicht wiederholt gesendet wie Zustände und müssen daher immer ankommen. Ebenso der Start
+    // des Lockstep, den der Host nur einmal sendet, und die Prüfsummen, die nur alle paar Ticks mitgehen.
+    if (update.event_size() > 0) { reliable.mutable_event()->Swap(update.mutable_event()); }
+    if (update.has_lockstep_start()) { reliable.set_allocated_lockstep_start(update.release_lockstep_start()); }
+    if (update.has_state_hash()) { reliable.set_allocated_state_hash(update.release_state_hash()); }
+
+    auto *elements = update.mutable_element();
+
+    for (int i = elements->size() - 1; i >= 0; --i) {
+      if (requires_reliable_delivery(elements->Get(i))) {
+        // Liegt das Update in einer Arena, kopiert das Verschieben nur in das Ziel; Swap legte dort auch etwas an.
+        *reliable.add_element() = std::move(*elements->Mutable(i));
+        elements->DeleteSubrange(i, 1);
+      }
+    }
+  }
+};
+
+// Teilt ein Update so auf, dass jedes Teil in ein Datagramm passt. Felder außer den Elementen trägt das erste Teil.
+[[nodiscard]] std::vector<GameUpdate> split_into_datagrams(GameUpdate const &update)
+{
+  std::vector<GameUpdate> parts(1);
+  parts.front().CopyFrom(update);
+  parts.front().clear_element();
+
+  for (auto const &element : update.element()) {
+    if (parts.back().element_size() > 0
+        && parts.back().ByteSizeLong() + element.ByteSizeLong() + 4 > max_datagram_payload) {
+      parts.emplace_back();
+    }
+    *parts.back().add_element() = element;
+  }
+
+  return parts;
+}
+
+// Sequenznummern, Ack-Bitfelder und Wiederholung zuverlässiger Nachrichten für genau eine Gegenstelle.
+// Wird ausschließlich vom I/O-Thread verwendet.
+class ReliableEndpoint
+{
+public:
+  using Clock = std::chrono::steady_clock;
+
+private:
+  struct PendingMessage
+  {
+    std::string payload;
+    Clock::time_point last_sent;
+  };
+
+  static std::size_t constexpr window_size{ 1024 };
+
+  std::uint16_t m_local_sequence{ 0 }, m_remote_sequence{ 0 }, m_next_message_id{ 0 }, m_expected_message_id{ 0 };
+  std::uint32_t m_received_bits{ 0 };
+  bool m_received_any{ false };
+  int m_received_since_last_sent{ 0 };
+  Clock::time_point m_last_sent{};
+
+  std::map<std::uint16_t, PendingMessage> m_unacked;
+  std::array<std::int32_t, window_size> m_sent_message_ids{};
+  // Zuverlässige Nachrichten, die vor einer noch fehlenden angekommen sind, nach message_id.
+  std::map<std::uint16_t, std::string> m_early_messages;
+
+  std::atomic<int> m_retransmitted{ 0 }, m_stale_discarded{ 0 };
+
+  void acknowledge(std::uint16_t const sequence)
+  {
+    auto &slot = m_sent_message_ids[sequence % window_size];
+    if (slot < 0) { return; }
+
+    m_unacked.erase(static_cast<std::uint16_t>(slot));
+    slot = -1;
+  }
+
+public:
+  ReliableEndpoint()
+  {
+    m_sent_message_ids.fill(-1);
+  }
+
+  [[nodiscard]] PacketHeader next_header(PacketKind const kind = DATA)
+  {
+    PacketHeader header;
+    header.kind = kind;
+    header.sequence = m_local_sequence++;
+    header.ack = m_remote_sequence;
+    header.ack_bits = m_received_bits;
+    m_sent_message_ids[header.sequence % window_size] = -1;
+    m_last_sent = Clock::now();
+    m_received_since_last_sent = 0;
+
+    return header;
+  }
+
+  [[nodiscard]] PacketHeader next_reliable_header(std::string const &payload)
+  {
+    auto const message_id = m_next_message_id++;
+    m_unacked[message_id] = { payload, Clock::now() };
+
+    auto header = next_header();
+    header.reliable = true;
+    header.message_id = message_id;
+    m_sent_message_ids[header.sequence % window_size] = message_id;
+
+    return header;
+  }
+
+  // Verarbeitet die Acks eines empfangenen Pakets und reicht dessen Inhalt an deliver weiter: veraltete unzuverlässige
+  // Pakete und bereits empfangene zuverlässige Nachrichten werden verworfen. Zuverlässige Nachrichten kommen in der
+  // Reihenfolge an, in der sie gesendet wurden; eine zu früh empfangene wartet auf die fehlenden davor. Sonst könnte
+  // eine wiederholte ältere Nachricht einen neueren Stein oder Punktestand überschreiben.
+  template<typename Deliver>//
+  void receive(PacketHeader const &header, std::string_view const payload, Deliver &&deliver)
+  {
+    acknowledge(header.ack);
+    for (std::uint16_t i{ 0 }; i < 32; ++i) {
+      if ((header.ack_bits & (1U << i)) != 0) { acknowledge(static_cast<std::uint16_t>(header.ack - i - 1)); }
+    }
+
+    bool newest{ !m_received_any || sequence_greater_than(header.sequence, m_remote_sequence) };
+    // Reine Acks werden nicht bestätigt, sonst schicken sich beide Seiten endlos leere Pakete.
+    if (header.reliable || !payload.empty()) { ++m_received_since_last_sent; }
+
+    if (!m_received_any) {
+      m_remote_sequence = header.sequence;
+      m_received_any = true;
+    } else if (newest) {
+      std::uint16_t const shift = header.sequence - m_remote_sequence;
+      m_received_bits = (shift >= 32) ? 0 : (m_received_bits << shift);
+      if (shift <= 32) { m_received_bits |= 1U << (shift - 1); }
+      m_remote_sequence = header.sequence;
+    } else {
+      std::uint16_t const age = m_remote_sequence - header.sequence;
+      if (age >= 1 && age <= 32) { m_received_bits |= 1U << (age - 1); }
+    }
+
+    if (header.reliable) {
+      if (header.message_id != m_expected_message_id) {
+        if (sequence_greater_than(header.message_id, m_expected_message_id)) {
+          (void)m_early_messages.try_emplace(header.message_id, payload);
+        }
+        return;
+      }
+
+      deliver(payload);
+      ++m_expected_message_id;
+      for (auto next = m_early_messages.find(m_expected_message_id); next != m_early_messages.end();
+           next = m_early_messages.find(m_expected_message_id)) {
+        deliver(std::string_view{ next->second });
+        m_early_messages.erase(next);
+        ++m_expected_message_id;
+      }
+      return;
+    }
+
+    if (!newest) {
+      ++m_stale_discarded;
+      return;
+    }
+    if (!payload.empty()) { deliver(payload); }
+  }
+
+  // Ruft resend(header, payload) für alle zuverlässigen Nachrichten auf, deren Bestätigung überfällig ist.
+  template<typename Resend>//
+  void resend_due(Clock::time_point const now, Resend &&resend)
+  {
+    for (auto &[message_id, message] : m_unacked) {
+      if (now - message.last_sent < resend_interval) { continue; }
+
+      message.last_sent = now;
+      auto header = next_header();
+      header.reliable = true;
+      header.message_id = message_id;
+      m_sent_message_ids[header.sequence % window_size] = message_id;
+      ++m_retransmitted;
+
+      resend(header, message.payload);
+    }
+  }
+
+  // Acks werden spätestens nach ack_interval oder, bevor das Bitfeld überläuft, gesendet.
+  [[nodiscard]] bool ack_due(Clock::time_point const now) const
+  {
+    return m_received_since_last_sent >= max_unacknowledged_packets
+           || (m_received_since_last_sent > 0 && now - m_last_sent >= ack_interval);
+  }
+
+  [[nodiscard]] std::size_t unacked_messages() const { return m_unacked.size(); }
+  [[nodiscard]] int retransmitted() const { return m_retransmitted; }
+  [[nodiscard]] int stale_discarded() const { return m_stale_discarded; }
+};
+
+}// namespace connection
+
+#endif
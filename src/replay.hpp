@@ -0,0 +1,586 @@
+#ifndef REPLAY_CPP
+#define REPLAY_CPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fcntl.h>
+#include <iterator>
+#include <limits>
+#include <map>
+#include <optional>
+#include <span>
+#include <string>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <utility>
+#include <vector>
+
+#include "box2d-incl/box2d/b2_world.h"
+
+#include "arkanoid.pb.h"
+#include "arkanoid_elements.hpp"
+#include "arkanoid_game.hpp"
+#include "events.hpp"
+#include "interpolation.hpp"
+#include "lockstep.hpp"
+#include "match_snapshot.hpp"
+#include "state_hash.hpp"
+
+namespace arkanoid {
+
+// Alle so vielen Ticks ein Keyframe, ab dem eine Wiedergabe einsteigen kann.
+long constexpr replay_keyframe_interval_ticks{ 200 };
+
+// Aufbau einer Aufzeichnung: ein ReplayFileHeader, dann Einträge aus ReplayRecordHeader und Nutzdaten, jeweils auf
+// 8 Bytes aufgefüllt. header.length zählt nur vollständig geschriebene Einträge; bricht das Spiel ab, bleibt die
+// Datei bis dorthin lesbar.
+enum class ReplayMode : std::uint16_t { PEER, ROLLBACK, LOCKSTEP, SERVER, SPECTATOR };
+
+enum class ReplayRecord : std::uint16_t {
+  INPUT,// eigene Mausposition des Ticks
+  SENT,// serialisiertes GameUpdate
+  RECEIVED,// serialisiertes GameUpdate, in der Reihenfolge der Anwendung
+  KEYFRAME,// ReplayKeyframe und MatchSnapshot nach dem Tick
+};
+
+struct ReplayFileHeader
+{
+  static std::uint32_t constexpr magic_value{ 0x524B5241 };// "ARKR"
+  static std::uint16_t constexpr version_value{ 2 };
+
+  std::uint32_t magic;
+  std::uint16_t version;
+  ReplayMode mode;
+  std::uint32_t frame_rate;
+  std::uint32_t reserved;
+  std::uint64_t length;
+};
+
+struct ReplayRecordHeader
+{
+  std::uint32_t size;// Nutzdaten ohne Auffüllung
+  ReplayRecord kind;
+  std::uint16_t reserved;
+  std::int64_t tick;
+};
+
+struct ReplayKeyframe
+{
+  std::uint64_t state_hash;
+  std::int32_t own_paddle_id;// -1, solange der eigene Schläger nicht feststeht
+  std::uint32_t lockstep_tick;// im Lockstep der nächste zu berechnende Tick, sonst 0
+};
+
+[[nodiscard]] std::size_t replay_padded(std::size_t const size)
+{
+  return (size + 7U) & ~std::size_t{ 7U };
+}
+
+// Schreibt eine Partie in eine Datei, die im Speicher eingeblendet ist: Ein Eintrag kostet ein memcpy bzw. das
+// Serialisieren direkt in die Datei, ohne Systemaufruf. Reicht der Platz nicht, wird die Datei verdoppelt.
+// Alle Methoden im Spiel-Thread aufrufen.
+class ReplayWriter
+{
+private:
+  static std::size_t constexpr initial_capacity{ std::size_t{ 4 } << 20U };
+
+  int m_file{ -1 };
+  std::byte *m_data{ nullptr };
+  std::size_t m_capacity{ 0 };
+  std::size_t m_length{ 0 };
+  std::int64_t m_tick{ 0 };
+  std::int64_t m_last_keyframe_tick{ -1 };
+  std::size_t m_records{ 0 };
+  MatchSnapshot m_snapshot;
+
+  [[nodiscard]] bool map(std::size_t const capacity)
+  {
+    if (m_data != nullptr) { munmap(m_data, m_capacity); }
+    m_data = nullptr;
+    if (ftruncate(m_file, static_cast<off_t>(capacity)) != 0) { return false; }
+
+    void *data = mmap(nullptr, capacity, PROT_READ | PROT_WRITE, MAP_SHARED, m_file, 0);
+    if (data == MAP_FAILED) { return false; }
+
+    m_data = static_cast<std::byte *>(data);
+    m_capacity = capacity;
+    return true;
+  }
+
+  // Platz für einen Eintrag; nullptr, wenn die Datei nicht wachsen konnte. Die Aufzeichnung endet dann.
+  [[nodiscard]] std::byte *reserve(std::size_t const size)
+  {
+    if (m_data == nullptr) { return nullptr; }
+
+    auto const needed = m_length + sizeof(ReplayRecordHeader) + replay_padded(size);
+    if (needed > m_capacity && !map(std::max(needed, m_capacity * 2))) {
+      close();
+      return nullptr;
+    }
+    return m_data + m_length;
+  }
+
+  void commit(ReplayRecord const kind, std::size_t const size)
+  {
+    ReplayRecordHeader const header{ static_cast<std::uint32_t>(size), kind, 0, m_tick };
+    std::memcpy(m_data + m_length, &header, sizeof(header));
+    auto const padded = replay_padded(size);
+    std::memset(m_data + m_length + sizeof(header) + size, 0, padded - size);
+
+    m_length += sizeof(header) + padded;
+    ++m_records;
+    std::memcpy(m_data + offsetof(ReplayFileHeader, length), &m_length, sizeof(std::uint64_t));
+  }
+
+  void append(ReplayRecord const kind, std::span<std::byte const> const payload)
+  {
+    auto *out = reserve(payload.size());
+    if (out == nullptr) { return; }
+
+    std::memcpy(out + sizeof(ReplayRecordHeader), payload.data(), payload.size());
+    commit(kind, payload.size());
+  }
+
+public:
+  ReplayWriter() = default;
+  ReplayWriter(ReplayWriter const &) = delete;
+  ReplayWriter &operator=(ReplayWriter const &) = delete;
+  ~ReplayWriter() { close(); }
+
+  // Legt die Datei neu an. Gibt false zurück, wenn sie nicht angelegt oder eingeblendet werden konnte.
+  [[nodiscard]] bool open(std::string const &path, ReplayMode const mode, int const frame_rate)
+  {
+    close();
+    m_file = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (m_file < 0 || !map(initial_capacity)) {
+      close();
+      return false;
+    }
+
+    ReplayFileHeader const header{ ReplayFileHeader::magic_value,
+      ReplayFileHeader::version_value,
+      mode,
+      static_cast<std::uint32_t>(frame_rate),
+      0,
+      sizeof(ReplayFileHeader) };
+    std::memcpy(m_data, &header, sizeof(header));
+    m_length = sizeof(header);
+    return true;
+  }
+
+  // Kürzt die Datei auf die geschriebenen Einträge.
+  void close()
+  {
+    if (m_data != nullptr) {
+      munmap(m_data, m_capacity);
+      // Scheitert das Kürzen, bleibt die Datei länger; header.length gilt trotzdem.
+      [[maybe_unused]] auto const truncated = ftruncate(m_file, static_cast<off_t>(m_length));
+    }
+    if (m_file >= 0) { ::close(m_file); }
+    m_data = nullptr;
+    m_file = -1;
+    m_capacity = 0;
+  }
+
+  [[nodiscard]] bool is_open() const { return m_data != nullptr; }
+
+  // Alle folgenden Einträge gehören zu diesem Tick.
+  void set_tick(std::int64_t const tick) { m_tick = tick; }
+
+  void record_input(int const mouse_x)
+  {
+    std::int32_t const value{ mouse_x };
+    append(ReplayRecord::INPUT, std::as_bytes(std::span{ &value, 1 }));
+  }
+
+  void record_update(GameUpdate const &update, bool const sent)
+  {
+    auto const size = update.ByteSizeLong();
+    auto *out = reserve(size);
+    if (out == nullptr) { return; }
+
+    (void)update.SerializeWithCachedSizesToArray(reinterpret_cast<std::uint8_t *>(out + sizeof(ReplayRecordHeader)));
+    commit(sent ? ReplayRecord::SENT : ReplayRecord::RECEIVED, size);
+  }
+
+  // Der erste Keyframe, sobald es Elemente gibt, danach alle replay_keyframe_interval_ticks.
+  [[nodiscard]] bool keyframe_due() const
+  {
+    return is_open() && (m_last_keyframe_tick < 0 || m_tick - m_last_keyframe_tick >= replay_keyframe_interval_ticks);
+  }
+
+  void record_keyframe(b2World const &world,
+    ElementStore const &elements,
+    Paddle const *own_paddle,
+    std::int64_t const lockstep_tick = 0)
+  {
+    if (elements.size() == 0) { return; }
+
+    m_snapshot.capture(world, elements, m_tick);
+    ReplayKeyframe const keyframe{ state_hash(elements),
+      own_paddle != nullptr ? own_paddle->id() : -1,
+      static_cast<std::uint32_t>(lockstep_tick) };
+
+    auto *out = reserve(sizeof(keyframe) + m_snapshot.size());
+    if (out == nullptr) { return; }
+
+    std::memcpy(out + sizeof(ReplayRecordHeader), &keyframe, sizeof(keyframe));
+    std::memcpy(out + sizeof(ReplayRecordHeader) + sizeof(keyframe), m_snapshot.data().data(), m_snapshot.size());
+    commit(ReplayRecord::KEYFRAME, sizeof(keyframe) + m_snapshot.size());
+    m_last_keyframe_tick = m_tick;
+  }
+
+  [[nodiscard]] std::size_t records() const { return m_records; }
+  [[nodiscard]] std::size_t bytes() const { return m_length; }
+};
+
+// Blendet eine Aufzeichnung nur lesend ein und führt ein Verzeichnis der Keyframes, um beliebige Ticks anzuspringen.
+class ReplayReader
+{
+public:
+  struct Entry
+  {
+    ReplayRecord kind;
+    std::int64_t tick;
+    std::span<std::byte const> payload;
+    std::size_t next;// Position des folgenden Eintrags
+  };
+
+private:
+  int m_file{ -1 };
+  std::byte const *m_data{ nullptr };
+  std::size_t m_size{ 0 };
+  ReplayFileHeader m_header{};
+  std::vector<std::pair<std::int64_t, std::size_t>> m_keyframes;// Tick, Position
+
+public:
+  ReplayReader() = default;
+  ReplayReader(ReplayReader const &) = delete;
+  ReplayReader &operator=(ReplayReader const &) = delete;
+  ~ReplayReader()
+  {
+    if (m_data != nullptr) { munmap(const_cast<std::byte *>(m_data), m_size); }
+    if (m_file >= 0) { ::close(m_file); }
+  }
+
+  // Gibt false zurück, wenn die Datei fehlt oder keine Aufzeichnung ist.
+  [[nodiscard]] bool open(std::string const &path)
+  {
+    m_file = ::open(path.c_str(), O_RDONLY);
+    struct stat status
+    {
+    };
+    if (m_file < 0 || fstat(m_file, &status) != 0 || static_cast<std::size_t>(status.st_size) < sizeof(m_header)) {
+      return false;
+    }
+
+    m_size = static_cast<std::size_t>(status.st_size);
+    void *data = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, m_file, 0);
+    if (data == MAP_FAILED) { return false; }
+    m_data = static_cast<std::byte const *>(data);
+
+    std::memcpy(&m_header, m_data, sizeof(m_header));
+    if (m_header.magic != ReplayFileHeader::magic_value || m_header.version != ReplayFileHeader::version_value
+        || m_header.length > m_size) {
+      return false;
+    }
+
+    for (auto position = begin(); auto const entry = read(position);) {
+      if (entry->kind == ReplayRecord::KEYFRAME) { m_keyframes.emplace_back(entry->tick, position); }
+      position = entry->next;
+    }
+    return true;
+  }
+
+  [[nodiscard]] ReplayFileHeader const &header() const { return m_header; }
+  [[nodiscard]] std::size_t begin() const { return sizeof(ReplayFileHeader); }
+  [[nodiscard]] std::vector<std::pair<std::int64_t, std::size_t>> const &keyframes() const { return m_keyframes; }
+
+  // Der Eintrag an position; leer am Ende oder bei einem unvollständigen Eintrag.
+  [[nodiscard]] std::optional<Entry> read(std::size_t const position) const
+  {
+    if (position + sizeof(ReplayRecordHeader) > m_header.length) { return std::nullopt; }
+
+    ReplayRecordHeader header{};
+    std::memcpy(&header, m_data + position, sizeof(header));
+    auto const next = position + sizeof(header) + replay_padded(header.size);
+    if (next > m_header.length) { return std::nullopt; }
+
+    return Entry{ header.kind, header.tick, { m_data + position + sizeof(header), header.size }, next };
+  }
+
+  // Zerlegt einen KEYFRAME-Eintrag; gibt false zurück, wenn der Block nicht zu einem MatchSnapshot passt.
+  [[nodiscard]] static bool read_keyframe(Entry const &entry, ReplayKeyframe &keyframe, MatchSnapshot &snapshot)
+  {
+    if (entry.kind != ReplayRecord::KEYFRAME || entry.payload.size() < sizeof(ReplayKeyframe)) { return false; }
+
+    std::memcpy(&keyframe, entry.payload.data(), sizeof(keyframe));
+    return snapshot.assign(entry.payload.subspan(sizeof(keyframe)));
+  }
+
+  // Position des letzten Keyframes bis einschließlich tick, sonst des ersten.
+  [[nodiscard]] std::optional<std::size_t> seek(std::int64_t const tick) const
+  {
+    if (m_keyframes.empty()) { return std::nullopt; }
+
+    auto const after = std::upper_bound(m_keyframes.begin(),
+      m_keyframes.end(),
+      tick,
+      [](std::int64_t const value, auto const &keyframe) { return value < keyframe.first; });
+    return (after == m_keyframes.begin()) ? m_keyframes.front().second : std::prev(after)->second;
+  }
+};
+
+// Berechnet eine Aufzeichnung ohne Bildschirm und Verbindung neu, wie run_game die Partie berechnet hat: ab einem
+// Keyframe mit den aufgezeichneten eigenen Eingaben und empfangenen Updates, so schnell es geht. An jedem weiteren
+// Keyframe wird die Prüfsumme verglichen und bei einer Abweichung vom Keyframe aus weitergerechnet, sodass jeder
+// Abschnitt für sich geprüft wird. Neu berechnet wird jeder Modus außer Rollback: Dort hängt das Ergebnis von
+// Vorhersagen und dem Zeitpunkt der Korrekturen ab, die nicht aufgezeichnet werden; die Keyframes werden nur geladen
+// und als ungeprüft gezählt. Im Lockstep stammen die Eingaben der Gegenstelle aus den empfangenen, die eigenen aus
+// den gesendeten lockstep_input-Nachrichten, denn nur dort steht der Tick, für den sie eingeplant wurden. Der Zustand
+// des RemoteEntityInterpolator fehlt im Keyframe und baut sich nach dem Einstieg aus den folgenden Updates neu auf.
+class ReplaySession
+{
+private:
+  ReplayMode m_mode;
+  float m_dt;
+  b2World m_world{ { 0, 0 } };
+  ElementStore m_elements;
+  ContactListener m_listener;
+  std::array<b2Fixture *, 2> m_back_plates{};
+  std::array<Paddle *, 2> m_paddle_ptrs{ nullptr, nullptr };
+  EventLog m_events;
+  RemoteEntityInterpolator m_interpolator;
+  MatchSnapshot m_snapshot;
+  GameUpdate m_update;// wiederverwendet für empfangene Updates und verworfene eigene Ereignisse
+
+  std::array<Paddle *, 2> m_lockstep_players{ nullptr, nullptr };
+  std::size_t m_local_player{ 0 };
+  std::int64_t m_lockstep_tick{ 0 };
+  std::array<std::map<std::int64_t, int>, 2> m_lockstep_inputs;// nach Spieler, dann Lockstep-Tick
+
+  long m_ticks{ 0 };
+  std::size_t m_matched{ 0 }, m_mismatched{ 0 }, m_unchecked{ 0 };
+  std::int64_t m_first_mismatch_tick{ -1 };
+
+  [[nodiscard]] bool restore(ReplayReader::Entry const &entry)
+  {
+    ReplayKeyframe keyframe{};
+    if (!ReplayReader::read_keyframe(entry, keyframe, m_snapshot) || !m_snapshot.restore(m_world, m_elements)) {
+      return false;
+    }
+
+    m_elements.paddles().for_each([&keyframe](Paddle &paddle) {
+      paddle.set_is_controlled_by_this_game_instance(paddle.id() == keyframe.own_paddle_id);
+    });
+    m_paddle_ptrs = { nullptr, nullptr };
+
+    if (m_mode == ReplayMode::LOCKSTEP) {
+      m_lockstep_players = prepare_lockstep_match(m_elements, m_listener, m_back_plates);
+      m_local_player = m_lockstep_players[0]->id() == keyframe.own_paddle_id ? 0 : 1;
+      m_lockstep_tick = keyframe.lockstep_tick;
+    }
+    return true;
+  }
+
+  void check(ReplayReader::Entry const &entry)
+  {
+    ReplayKeyframe keyframe{};
+    if (ReplayReader::read_keyframe(entry, keyframe, m_snapshot) && keyframe.state_hash == state_hash(m_elements)
+        && (m_mode != ReplayMode::LOCKSTEP || keyframe.lockstep_tick == m_lockstep_tick)) {
+      ++m_matched;
+    } else {
+      ++m_mismatched;
+      if (m_first_mismatch_tick < 0) { m_first_mismatch_tick = entry.tick; }
+      (void)restore(entry);
+    }
+
+    // Eingaben für schon berechnete Lockstep-Ticks werden nicht mehr gebraucht.
+    for (auto &inputs : m_lockstep_inputs) { inputs.erase(inputs.begin(), inputs.lower_bound(m_lockstep_tick)); }
+  }
+
+  // Übernimmt die Eingaben einer gesendeten oder empfangenen lockstep_input-Nachricht für player.
+  void add_lockstep_inputs(GameUpdate const &update, std::size_t const player)
+  {
+    if (!update.has_lockstep_input()) { return; }
+
+    auto const &message = update.lockstep_input();
+    for (int i{ 0 }; i < message.mouse_x_size(); ++i) {
+      auto const tick = message.first_tick() + i;
+      if (tick >= m_lockstep_tick) { m_lockstep_inputs[player][tick] = message.mouse_x(i); }
+    }
+  }
+
+  // Die eigenen Eingaben für die Ticks ab dem Keyframe wurden schon vor ihm gesendet, manche der Gegenstelle auch
+  // schon empfangen.
+  void read_lockstep_inputs(ReplayReader const &reader, std::size_t const until)
+  {
+    for (auto entry = reader.read(reader.begin()); entry && entry->next <= until; entry = reader.read(entry->next)) {
+      if ((entry->kind == ReplayRecord::SENT || entry->kind == ReplayRecord::RECEIVED)
+          && m_update.ParseFromArray(entry->payload.data(), static_cast<int>(entry->payload.size()))) {
+        add_lockstep_inputs(m_update, entry->kind == ReplayRecord::SENT ? m_local_player : 1 - m_local_player);
+      }
+    }
+  }
+
+  // Ein Tick, sobald die Eingaben beider Spieler vorliegen, wie mit Lockstep::ready() in run_game.
+  bool step_lockstep_tick()
+  {
+    auto const first = m_lockstep_inputs[0].find(m_lockstep_tick);
+    auto const second = m_lockstep_inputs[1].find(m_lockstep_tick);
+    if (first == m_lockstep_inputs[0].end() || second == m_lockstep_inputs[1].end()) { return false; }
+
+    step_lockstep(m_world, m_elements, m_lockstep_players, { first->second, second->second }, m_dt);
+    ++m_lockstep_tick;
+    return true;
+  }
+
+public:
+  explicit ReplaySession(ReplayMode const mode, int const frame_rate)
+    : m_mode{ mode }, m_dt{ 1.0F / static_cast<float>(frame_rate) }
+  {
+    m_world.SetContactListener(&m_listener);
+    if (mode == ReplayMode::PEER) { m_listener.set_event_log(&m_events); }
+    if (mode == ReplayMode::LOCKSTEP) {
+      // Wie in Lockstep: Für die ersten Ticks gibt es keine Eingaben.
+      for (auto &inputs : m_lockstep_inputs) {
+        for (std::int64_t tick{ 0 }; tick < lockstep_input_delay_ticks; ++tick) { inputs[tick] = lockstep_no_input; }
+      }
+    }
+    m_back_plates = build_b2_world_border(&m_world);
+
+    // Dieselben Körper in derselben Reihenfolge wie beim Host und beim Client; den Rest setzt der Keyframe.
+    int const paddle_y{ playing_field_bottom - paddle_height };
+    Vector const paddle_position{ (canvas_width / 2) - (paddle_width / 2), paddle_y };
+    generate_arkanoid_elements(paddle_position,
+      { playing_field_bottom - paddle_height },
+      { paddle_width / 2, -10 },
+      { ball_velocity_x, ball_velocity_y },
+      &m_world,
+      m_elements,
+      0);
+  }
+
+  ReplaySession(ReplaySession const &) = delete;
+  ReplaySession &operator=(ReplaySession const &) = delete;
+
+  [[nodiscard]] bool resimulates() const { return m_mode != ReplayMode::ROLLBACK; }
+
+  // Wie apply_update in main().
+  void receive(GameUpdate const &update)
+  {
+    if (m_mode == ReplayMode::LOCKSTEP) {
+      add_lockstep_inputs(update, 1 - m_local_player);
+      return;
+    }
+    if (m_mode == ReplayMode::SERVER || m_mode == ReplayMode::SPECTATOR) {
+      auto *const own_paddle = (m_mode == ReplayMode::SERVER) ? m_paddle_ptrs[0] : nullptr;
+      Vector const own_position = (own_paddle != nullptr) ? own_paddle->center_position() : Vector{ 0, 0 };
+      parse_game_update(m_elements, update, &m_world);
+      if (own_paddle != nullptr) { own_paddle->set_position(own_position); }
+      return;
+    }
+
+    if (update.element_size() == 0 && update.event_size() == 0) { return; }
+    m_interpolator.record(update);
+    m_events.apply(update, m_elements, true);
+    parse_game_update(m_elements, update, &m_world);
+    m_interpolator.apply(m_elements);
+  }
+
+  // Wie ein Frame in run_game ohne Rollback; über den Server folgt nur der eigene Schläger der Eingabe, im Lockstep
+  // gelten die eingeplanten Eingaben statt mouse_x.
+  void simulate(std::int64_t const tick, int const mouse_x)
+  {
+    bool const found =
+      m_mode != ReplayMode::LOCKSTEP && find_paddle_ptrs(m_paddle_ptrs, m_back_plates, m_elements, m_listener);
+
+    if (m_mode == ReplayMode::PEER) {
+      if (found) { update_paddle_position(m_paddle_ptrs[0], mouse_x); }
+      m_interpolator.apply(m_elements, tick);
+      m_world.Step(m_dt, 4, 2);
+      m_elements.for_each([](auto &element) { (void)element.did_update(); });
+
+      // Eigene Ereignisse wären gesendet worden; gebraucht wird nur ihre Wirkung auf die eigene Partie.
+      m_events.flush(m_update);
+      m_update.Clear();
+    } else if (m_mode == ReplayMode::SERVER && found) {
+      update_paddle_position(m_paddle_ptrs[0], mouse_x);
+    } else if (m_mode == ReplayMode::LOCKSTEP) {
+      (void)step_lockstep_tick();
+    }
+
+    m_elements.disable_destroyed_bricks();
+    ++m_ticks;
+  }
+
+  // Spielt ab dem Keyframe an position bis einschließlich Tick until. Gibt false zurück, wenn der Keyframe nicht
+  // geladen werden kann.
+  [[nodiscard]] bool play(ReplayReader const &reader,
+    std::size_t const position,
+    std::int64_t const until = std::numeric_limits<std::int64_t>::max())
+  {
+    auto const start = reader.read(position);
+    if (!start || !restore(*start)) { return false; }
+    if (m_mode == ReplayMode::LOCKSTEP) { read_lockstep_inputs(reader, position); }
+
+    std::optional<std::pair<std::int64_t, int>> input;// Tick und Eingabe, noch nicht berechnet
+    auto finish_tick = [this, &input]() {
+      if (input && resimulates()) { simulate(input->first, input->second); }
+      input.reset();
+    };
+
+    for (auto entry = reader.read(start->next); entry; entry = reader.read(entry->next)) {
+      if (entry->tick > until) { break; }
+      bool const same_frame = entry->kind == ReplayRecord::INPUT || entry->kind == ReplayRecord::RECEIVED;
+      if (input && (entry->tick != input->first || !same_frame)) { finish_tick(); }
+
+      switch (entry->kind) {
+      case ReplayRecord::INPUT: {
+        std::int32_t mouse_x{ 0 };
+        std::memcpy(&mouse_x, entry->payload.data(), std::min(entry->payload.size(), sizeof(mouse_x)));
+        input = { entry->tick, mouse_x };
+        break;
+      }
+      case ReplayRecord::RECEIVED:
+        if (resimulates() && m_update.ParseFromArray(entry->payload.data(), static_cast<int>(entry->payload.size()))) {
+          receive(m_update);
+        }
+        break;
+      case ReplayRecord::SENT:
+        if (m_mode == ReplayMode::LOCKSTEP
+            && m_update.ParseFromArray(entry->payload.data(), static_cast<int>(entry->payload.size()))) {
+          add_lockstep_inputs(m_update, m_local_player);
+        }
+        break;
+      case ReplayRecord::KEYFRAME:
+        if (resimulates()) {
+          check(*entry);
+        } else {
+          // Nur laden: Mit dem Keyframe selbst verglichen stimmte er immer.
+          (void)restore(*entry);
+          ++m_unchecked;
+        }
+        break;
+      }
+    }
+    finish_tick();
+    return true;
+  }
+
+  [[nodiscard]] long ticks() const { return m_ticks; }
+  [[nodiscard]] std::size_t matched() const { return m_matched; }
+  [[nodiscard]] std::size_t mismatched() const { return m_mismatched; }
+  [[nodiscard]] std::size_t unchecked() const { return m_unchecked; }
+  [[nodiscard]] std::int64_t first_mismatch_tick() const { return m_first_mismatch_tick; }
+  [[nodiscard]] ElementStore const &elements() const { return m_elements; }
+  [[nodiscard]] b2World const &world() const { return m_world; }
+};
+
+}// namespace arkanoid
+
+#endif
@@ -0,0 +1,308 @@
+#ifndef ROLLBACK_CPP
+#define ROLLBACK_CPP
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "box2d-incl/box2d/b2_body.h"
+#include "box2d-incl/box2d/b2_collision.h"
+#include "box2d-incl/box2d/b2_contact.h"
+#include "box2d-incl/box2d/b2_fixture.h"
+#include "box2d-incl/box2d/b2_world_callbacks.h"
+#include "box2d-incl/box2d/b2_math.h"
+#include "box2d-incl/box2d/b2_world.h"
+
+#include "arkanoid.pb.h"
+#include "arkanoid_elements.hpp"
+
+namespace arkanoid {
+
+std::size_t constexpr rollback_history_ticks{ 32 };
+
+// Zustand aller Körper der b2World, der berührenden Kontakte und der Spielwerte, die nicht in Box2D liegen.
+//
+// Box2D bietet keinen Weg, einen Kontakt anzulegen oder zu setzen, ob er berührt. Die Kontakte vom Zeitpunkt des
+// Zurücksetzens überleben SetTransform aber samt Berührung und Impulsen; der erste Step meldete dann EndContact, also
+// Treffer und Punkte, für Berührungen, die es im gesicherten Tick nicht gab. Deshalb baut restore() die Kontaktliste
+// neu auf, und restore_contacts() stellt vor dem ersten Step die Impulse für den Warmstart wieder her und meldet
+// dem Listener genau die Wechsel, die dieser Step ohne Zurücksetzen gemeldet hätte.
+class WorldSnapshot
+{
+private:
+  struct BodyState
+  {
+    b2Body *body{ nullptr };
+    b2Vec2 position{ 0.0F, 0.0F };
+    float angle{ 0.0F };
+    b2Vec2 linear_velocity{ 0.0F, 0.0F };
+    float angular_velocity{ 0.0F };
+    bool awake{ false }, enabled{ false };
+  };
+
+  struct ElementState
+  {
+    Element *element{ nullptr };
+    int value{ 0 };// Haltbarkeit eines Steins bzw. Punkte eines Schlägers
+    Paddle *last_paddle{ nullptr };
+  };
+
+  // Nur berührende Kontakte tragen Zustand; die übrigen haben keine Punkte und damit keine Impulse.
+  struct ContactState
+  {
+    b2Fixture *fixture_a{ nullptr }, *fixture_b{ nullptr };
+    b2Manifold manifold{};
+  };
+
+  std::vector<BodyState> m_bodies;
+  std::vector<ElementState> m_elements;
+  std::vector<ContactState> m_contacts;
+
+  [[nodiscard]] static bool same_pair(ContactState const &state, b2Contact const *contact)
+  {
+    auto const *a = contact->GetFixtureA();
+    auto const *b = contact->GetFixtureB();
+    return (state.fixture_a == a && state.fixture_b == b) || (state.fixture_a == b && state.fixture_b == a);
+  }
+
+public:
+  // Die Vektoren behalten ihre Kapazität, sodass wiederholtes Sichern nach dem ersten Mal nicht alloziert.
+  void capture(b2World &world, ElementStore const &elements)
+  {
+    m_bodies.clear();
+    m_elements.clear();
+    m_contacts.clear();
+
+    for (auto *body = world.GetBodyList(); body != nullptr; body = body->GetNext()) {
+      m_bodies.push_back({ body,
+        body->GetPosition(),
+        body->GetAngle(),
+        body->GetLinearVelocity(),
+        body->GetAngularVelocity(),
+        body->IsAwake(),
+        body->IsEnabled() });
+    }
+
+    for (auto *contact = world.GetContactList(); contact != nullptr; contact = contact->GetNext()) {
+      if (contact->IsTouching()) {
+        m_contacts.push_back({ contact->GetFixtureA(), contact->GetFixtureB(), *contact->GetManifold() });
+      }
+    }
+
+    elements.for_each(overloaded{ [this](Brick &brick) { m_elements.push_back({ &brick, brick.duration() }); },
+      [this](Paddle &paddle) { m_elements.push_back({ &paddle, paddle.score() }); },
+      [this](Ball &ball) { m_elements.push_back({ &ball, 0, ball.last_paddle() }); } });
+  }
+
+  // Setzt Körper und Spielwerte zurück und verwirft alle Kontakte; unbewegte Steine kosten nichts. Vor dem nächsten
+  // Step muss restore_contacts() folgen, dazwischen dürfen Updates angewendet werden. Der Listener ist der der Welt;
+  // solange die Kontakte abgebaut werden, meldet Box2D ihm nichts.
+  void restore(b2World &world, b2ContactListener &listener) const
+  {
+    world.SetContactListener(nullptr);
+
+    // Jeder Kontakt hängt an einem dynamischen Körper; ausgeschaltet verliert der alle Kontakte und Proxies.
+    for (auto const &state : m_bodies) {
+      if (state.body->GetType() == b2_dynamicBody) { state.body->SetEnabled(false); }
+    }
+
+    for (auto const &state : m_bodies) {
+      auto *body = state.body;
+
+      if (!(body->GetPosition() == state.position) || body->GetAngle() != state.angle) {
+        body->SetTransform(state.position, state.angle);
+      }
+      if (body->IsEnabled() != state.enabled) { body->SetEnabled(state.enabled); }
+      if (body->GetType() == b2_staticBody) { continue; }
+
+      body->SetAwake(state.awake);
+      body->SetLinearVelocity(state.linear_velocity);
+      body->SetAngularVelocity(state.angular_velocity);
+    }
+
+    world.SetContactListener(&listener);
+    world.ClearForces();
+
+    for (auto const &state : m_elements) {
+      if (state.element->get_type() == BRICK) {
+        element_cast<Brick>(state.element)->set_duration(state.value);
+      } else if (state.element->get_type() == PADDLE) {
+        element_cast<Paddle>(state.element)->set_score(state.value);
+      } else if (state.element->get_type() == BALL) {
+        auto *ball = element_cast<Ball>(state.element);
+        ball->set_last_paddle(state.last_paddle);
+        ball->apply_forces();
+      }
+    }
+  }
+
+  // Legt die Kontakte mit einem Step ohne Zeit neu an, der nichts bewegt, und übernimmt die gesicherten Impulse wie
+  // Box2D selbst über die ids der Punkte. Dann meldet es, was der nächste Step gegenüber dem gesicherten Tick
+  // gemeldet hätte: BeginContact für neue Berührungen, EndContact für beendete. Endet eine Berührung, weil sich die
+  // Körper seither weit entfernt haben, gibt es keinen Kontakt mehr; Listener::EndContact nimmt deshalb die
+  // beiden Fixtures.
+  template<typename Listener>// b2ContactListener mit EndContact(b2Fixture *, b2Fixture *)
+  void restore_contacts(b2World &world, Listener &listener) const
+  {
+    world.SetContactListener(nullptr);
+    bool const auto_clear_forces = world.GetAutoClearForces();
+    world.SetAutoClearForces(false);// die Kräfte der Bälle gelten für den nächsten Step
+    world.Step(0.0F, 0, 0);
+    world.SetAutoClearForces(auto_clear_forces);
+    world.SetContactListener(&listener);
+
+    for (auto *contact = world.GetContactList(); contact != nullptr; contact = contact->GetNext()) {
+      if (!contact->IsTouching()) { continue; }
+
+      auto const found = std::find_if(m_contacts.begin(), m_contacts.end(), [contact](ContactState const &state) {
+        return same_pair(state, contact);
+      });
+      if (found == m_contacts.end()) {
+        listener.BeginContact(contact);
+        continue;
+      }
+
+      auto *manifold = contact->GetManifold();
+      for (int i{ 0 }; i < manifold->pointCount; ++i) {
+        auto &point = manifold->points[i];
+        for (int j{ 0 }; j < found->manifold.pointCount; ++j) {
+          if (found->manifold.points[j].id.key == point.id.key) {
+            point.normalImpulse = found->manifold.points[j].normalImpulse;
+            point.tangentImpulse = found->manifold.points[j].tangentImpulse;
+            break;
+          }
+        }
+      }
+    }
+
+    for (auto const &state : m_contacts) {
+      bool touching{ false };
+      for (auto *contact = world.GetContactList(); contact != nullptr && !touching; contact = contact->GetNext()) {
+        touching = contact->IsTouching() && same_pair(state, contact);
+      }
+      if (!touching) { listener.EndContact(state.fixture_a, state.fixture_b); }
+    }
+  }
+};
+
+// Merkt sich für die letzten rollback_history_ticks Ticks die eigene Eingabe und den Zustand zu Tickbeginn. Trifft
+// ein Update der Gegenstelle ein, das einen vergangenen Tick beschreibt, wird die Welt auf diesen Tick
+// zurückgesetzt, das Update angewendet und bis zur Gegenwart mit den gespeicherten Eingaben neu berechnet.
+// Bis auf die Zähler müssen alle Methoden unter demselben Mutex wie die Elemente aufgerufen werden.
+class RollbackState
+{
+private:
+  struct HistoryEntry
+  {
+    std::int64_t tick{ -1 };
+    int mouse_x{ 0 };
+    WorldSnapshot snapshot;
+    std::vector<GameUpdate> updates;// zu Beginn dieses Ticks angewendet, nach dem Sichern
+  };
+
+  std::array<HistoryEntry, rollback_history_ticks> m_history;
+  std::vector<std::pair<std::int64_t, GameUpdate>> m_pending;
+  std::vector<GameUpdate> m_present;// für den nächsten Tick, angewendet von record()
+  std::int64_t m_newest_tick{ -1 };
+  std::size_t m_size{ 0 };
+  std::atomic<long> m_ticks_resimulated{ 0 };
+  std::atomic<int> m_last_resimulation_depth{ 0 };
+
+  [[nodiscard]] HistoryEntry &at(std::int64_t const tick)
+  {
+    return m_history[static_cast<std::size_t>(tick) % rollback_history_ticks];
+  }
+
+  [[nodiscard]] std::int64_t oldest_tick() const { return m_newest_tick - static_cast<std::int64_t>(m_size) + 1; }
+
+public:
+  // Zu Beginn jedes Ticks, bevor die Eingabe angewendet wird. Updates für diesen Tick, die resimulate() zurückhielt,
+  // werden erst nach dem Sichern mit apply angewendet und im Verlauf abgelegt. So wendet sie auch jede spätere
+  // Neuberechnung über diesen Tick wieder an, statt den Zustand ohne sie neu zu sichern.
+  template<typename Apply>//
+  void record(std::int64_t const tick, int const mouse_x, b2World &world, ElementStore const &elements, Apply &&apply)
+  {
+    auto &entry = at(tick);
+    entry.tick = tick;
+    entry.mouse_x = mouse_x;
+    entry.updates.clear();
+    entry.snapshot.capture(world, elements);
+
+    for (auto &update : m_present) {
+      apply(update);
+      entry.updates.push_back(std::move(update));
+    }
+    m_present.clear();
+
+    m_newest_tick = tick;
+    m_size = std::min(m_size + 1, rollback_history_ticks);
+  }
+
+  // Das Update beschreibt den Zustand zu Beginn des lokalen Ticks tick; angewendet wird es beim nächsten
+  // resimulate(), für die Gegenwart beim folgenden record(). Ticks nach dem nächsten gelten als Gegenwart.
+  void defer_at(GameUpdate update, std::int64_t const tick)
+  {
+    m_pending.emplace_back(std::min(tick, m_newest_tick + 1), std::move(update));
+  }
+
+  // Das Update beschreibt den Zustand von vor ticks_back Ticks.
+  void defer(GameUpdate update, int const ticks_back)
+  {
+    defer_at(std::move(update), m_newest_tick + 1 - std::max(ticks_back, 0));
+  }
+
+  // Wendet alle zurückgestellten Updates für vergangene Ticks an und gibt die Anzahl der neu berechneten Ticks zurück.
+  // Die für die Gegenwart behält es für record().
+  // apply(GameUpdate const &) übernimmt ein Update, step(tick, mouse_x) berechnet einen Tick genau wie im Spiel.
+  // listener ist der Kontakt-Listener der Welt, siehe WorldSnapshot::restore_contacts.
+  template<typename Listener, typename Apply, typename Step>//
+  int resimulate(b2World &world, ElementStore const &elements, Listener &listener, Apply &&apply, Step &&step)
+  {
+    m_last_resimulation_depth = 0;
+    if (m_pending.empty()) { return 0; }
+
+    auto const describes_present = [this](std::int64_t const tick) { return m_size == 0 || tick > m_newest_tick; };
+
+    std::int64_t from{ m_newest_tick + 1 };
+    for (auto &[tick, update] : m_pending) {
+      if (describes_present(tick)) { continue; }
+
+      tick = std::max(tick, oldest_tick());
+      from = std::min(from, tick);
+      at(tick).updates.push_back(std::move(update));
+    }
+
+    if (from <= m_newest_tick) {
+      at(from).snapshot.restore(world, listener);
+
+      for (auto tick = from; tick <= m_newest_tick; ++tick) {
+        auto &entry = at(tick);
+        if (tick > from) { entry.snapshot.capture(world, elements); }
+
+        for (auto const &update : entry.updates) { apply(update); }
+        if (tick == from) { entry.snapshot.restore_contacts(world, listener); }
+        step(tick, entry.mouse_x);
+      }
+
+      m_last_resimulation_depth = static_cast<int>(m_newest_tick - from + 1);
+      m_ticks_resimulated += m_last_resimulation_depth;
+    }
+
+    for (auto &[tick, update] : m_pending) {
+      if (describes_present(tick)) { m_present.push_back(std::move(update)); }
+    }
+    m_pending.clear();
+
+    return m_last_resimulation_depth;
+  }
+
+  [[nodiscard]] long ticks_resimulated() const { return m_ticks_resimulated; }
+  [[nodiscard]] int last_resimulation_depth() const { return m_last_resimulation_depth; }
+};
+
+}// namespace arkanoid
+
+#endif
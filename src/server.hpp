@@ -0,0 +1,490 @@
+#ifndef SERVER_CPP
+#define SERVER_CPP
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <latch>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "asio/as_tuple.hpp"
+#include "asio/awaitable.hpp"
+#include "asio/co_spawn.hpp"
+#include "asio/detached.hpp"
+#include "asio/executor_work_guard.hpp"
+#include "asio/io_context.hpp"
+#include "asio/ip/tcp.hpp"
+#include "asio/post.hpp"
+#include "asio/steady_timer.hpp"
+#include "asio/thread_pool.hpp"
+#include "asio/use_awaitable.hpp"
+#include "asio/write.hpp"
+
+#include "arkanoid.pb.h"
+#include "authoritative_match.hpp"
+#include "connection.hpp"
+#include "delta.hpp"
+#include "framing.hpp"
+#include "quantization.hpp"
+#include "spectator.hpp"
+#include "update_arena.hpp"
+
+namespace connection {
+
+// Verbindung des Servers zu einem Spieler. Alle Methoden außer den Eingabe-Abfragen laufen auf dem I/O-Thread.
+class ServerSession : public std::enable_shared_from_this<ServerSession>
+{
+private:
+  asio::ip::tcp::socket m_socket;
+  asio::steady_timer m_write_signal;
+  std::vector<GameUpdate> m_outgoing;
+  std::vector<std::string> m_frames;
+  std::vector<asio::const_buffer> m_buffers;
+  DeltaEncoder m_encoder;
+  DeltaDecoder m_decoder;
+  std::atomic<int> m_mouse_x{ 0 };
+  std::atomic<bool> m_has_input{ false }, m_open{ true };
+  std::atomic<std::size_t> m_updates_dropped{ 0 };
+  bool m_closing{ false };// nach close_after_sending(); nur auf dem I/O-Thread
+
+  void handle_update(GameUpdate &update)
+  {
+    m_encoder.acknowledge(update.ack());
+    m_decoder.decode(update);
+
+    if (update.has_input()) {
+      m_mouse_x = update.input().mouse_x();
+      m_has_input = true;
+    }
+
+    if (update.has_ping()) {
+      GameUpdate reply;
+      auto *pong = reply.mutable_pong();
+      pong->set_ping_sent_at(update.ping().sent_at());
+      pong->set_ping_received_at(now_microseconds());
+      pong->set_sent_at(now_microseconds());
+      send(std::move(reply));
+    }
+  }
+
+  awaitable<void> read_loop()
+  {
+    auto const self = shared_from_this();
+    FrameReader reader;
+    GameUpdate update;
+
+    while (true) {
+      auto const [ec, bytes_transferred] =
+        co_await m_socket.async_read_some(reader.prepare(), asio::as_tuple(use_awaitable));
+
+      if (ec) { break; }
+
+      reader.commit(bytes_transferred);
+      bool const valid = reader.consume_frames([this, &update](char const *data, int const size) {
+        if (update.ParseFromArray(data, size)) { handle_update(update); }
+      });
+
+      if (!valid) { break; }
+    }
+
+    close();
+  }
+
+  awaitable<void> write_loop()
+  {
+    auto const self = shared_from_this();
+    std::vector<GameUpdate> pending;
+
+    while (m_open) {
+      if (m_outgoing.empty()) {
+        if (m_closing) { break; }
+        co_await m_write_signal.async_wait(asio::as_tuple(use_awaitable));
+        continue;
+      }
+
+      pending.swap(m_outgoing);// pending ist leer; so behalten beide ihre Kapazität
+      (void)coalesce_game_updates(pending);
+
+      if (m_frames.size() < pending.size()) { m_frames.resize(pending.size()); }
+      m_buffers.clear();
+      for (std::size_t i{ 0 }; i < pending.size(); ++i) {
+        m_encoder.encode(pending[i], m_decoder.ack());
+        m_frames[i].clear();
+        append_frame(pending[i], m_frames[i]);
+        m_buffers.push_back(asio::buffer(m_frames[i]));
+      }
+      pending.clear();
+
+      auto const [ec, t] = co_await asio::async_write(m_socket, m_buffers, asio::as_tuple(use_awaitable));
+      if (ec) { close(); }
+    }
+
+    if (m_open) { co_await linger_and_close(m_socket, m_write_signal); }
+    close();
+  }
+
+public:
+  ServerSession(asio::ip::tcp::socket socket, Quantization const quantization)
+    : m_socket{ std::move(socket) }, m_write_signal{ m_socket.get_executor() }, m_encoder{ quantization },
+      m_decoder{ quantization }
+  {
+    m_write_signal.expires_at(asio::steady_timer::time_point::max());
+  }
+
+  void start()
+  {
+    asio::co_spawn(m_socket.get_executor(), read_loop(), asio::detached);
+    asio::co_spawn(m_socket.get_executor(), write_loop(), asio::detached);
+  }
+
+  // Ist der Spieler mit dem Lesen im Rückstand, werden überholte Zustände beim Schreiben zusammengefasst, bei voller
+  // Warteschlange schon hier. Bleibt sie auch danach voll, wird das Update wie bei Connection verworfen und gezählt.
+  void send(GameUpdate update)
+  {
+    if (!m_open || m_closing) { return; }
+
+    if (m_outgoing.size() >= max_send_queue_depth) { (void)coalesce_game_updates(m_outgoing); }
+    if (m_outgoing.size() >= max_send_queue_depth) {
+      ++m_updates_dropped;
+      return;
+    }
+
+    m_outgoing.push_back(std::move(update));
+    m_write_signal.cancel();
+  }
+
+  // Schreibt noch alles, was bereits mit send() eingereiht wurde, und trennt dann, siehe linger_and_close.
+  void close_after_sending()
+  {
+    m_closing = true;
+    m_write_signal.cancel();
+  }
+
+  void close()
+  {
+    asio::error_code ec;
+    m_open = false;
+    m_socket.close(ec);
+    m_write_signal.cancel();
+  }
+
+  [[nodiscard]] bool is_open() const { return m_open; }
+  [[nodiscard]] bool has_input() const { return m_has_input; }
+  [[nodiscard]] std::size_t updates_dropped() const { return m_updates_dropped; }
+  [[nodiscard]] int mouse_x() const { return m_mouse_x; }
+};
+
+struct ServerStats
+{
+  std::size_t matches{ 0 }, players{ 0 }, spectators{ 0 }, threads{ 0 };
+  std::size_t spectator_frames_skipped{ 0 };// seit dem Start, bei langsamen Zuschauern
+  std::size_t player_updates_dropped{ 0 };// seit dem Start, bei Spielern, die nicht mehr lesen
+  double tick_p50_ms{ 0 }, tick_p95_ms{ 0 }, tick_p99_ms{ 0 }, frame_p99_ms{ 0 };
+  double utilization{ 0 };// Anteil der Thread-Zeit, der für Ticks gebraucht wurde
+  double matches_per_core{ 0 };// Partien, die ein Kern bei der gemessenen Tick-Dauer schaffen würde
+};
+
+// Nimmt Spieler an, bildet aus je zwei wartenden Spielern eine Partie und berechnet alle Partien auf einem
+// Thread-Pool. Spieler senden nur ihre Eingabe und erhalten den Zustand. Zuschauer auf dem zweiten Port werden der
+// ältesten Partie mit Spielern zugeteilt und sehen sie aus Sicht von Spieler 0.
+class MatchServer
+{
+private:
+  struct MatchSlot
+  {
+    std::unique_ptr<arkanoid::AuthoritativeMatch> match;
+    std::array<std::shared_ptr<ServerSession>, 2> players;// nullptr = Bot
+    std::vector<std::shared_ptr<SpectatorSession>> spectators;
+    UpdateArena snapshot_arena;
+    bool started{ false };
+    double step_ms{ 0 };
+  };
+
+  int const m_frame_rate;
+  std::size_t const m_threads;
+  Quantization const m_quantization;
+
+  asio::io_context m_io_context{ 1 };
+  asio::executor_work_guard<asio::io_context::executor_type> m_work_guard{ m_io_context.get_executor() };
+  asio::ip::tcp::acceptor m_acceptor{ m_io_context };
+  asio::ip::tcp::acceptor m_spectator_acceptor{ m_io_context };
+
+  std::mutex m_lobby_mutex;
+  std::vector<std::shared_ptr<ServerSession>> m_lobby;
+  std::vector<std::shared_ptr<SpectatorSession>> m_spectator_lobby;
+  std::size_t m_spectator_frames_skipped{ 0 };// von bereits getrennten Zuschauern
+  std::size_t m_player_updates_dropped{ 0 };// von bereits beendeten Partien
+  std::vector<std::unique_ptr<MatchSlot>> m_matches;// nur vom Tick-Thread verwendet
+  std::size_t m_bot_matches{ 0 };
+
+  asio::thread_pool m_pool;
+  std::thread m_io_thread;
+
+  template<typename Session>//
+  awaitable<void> accept_loop(asio::ip::tcp::acceptor &acceptor, std::vector<std::shared_ptr<Session>> &lobby)
+  {
+    while (acceptor.is_open()) {
+      auto [ec, socket] = co_await acceptor.async_accept(asio::as_tuple(use_awaitable));
+      if (ec) { continue; }
+
+      socket.set_option(asio::ip::tcp::no_delay(true), ec);
+      std::shared_ptr<Session> session;
+      if constexpr (std::is_same_v<Session, ServerSession>) {
+        session = std::make_shared<ServerSession>(std::move(socket), m_quantization);
+      } else {
+        session = std::make_shared<Session>(std::move(socket));
+      }
+      session->start();
+
+      std::lock_guard<std::mutex> lock{ m_lobby_mutex };
+      lobby.push_back(std::move(session));
+    }
+  }
+
+  static void listen(asio::ip::tcp::acceptor &acceptor, int const port)
+  {
+    asio::ip::tcp::endpoint const endpoint{ asio::ip::tcp::v4(), static_cast<asio::ip::port_type>(port) };
+    acceptor.open(endpoint.protocol());
+    acceptor.set_option(asio::ip::tcp::acceptor::reuse_address(true));
+    acceptor.bind(endpoint);
+    acceptor.listen();
+  }
+
+  // Läuft auf dem Tick-Thread, da hier Lobby und Partienliste geändert werden.
+  void create_matches()
+  {
+    std::lock_guard<std::mutex> lock{ m_lobby_mutex };
+    std::erase_if(m_lobby, [](auto const &session) { return !session->is_open(); });
+
+    while (m_lobby.size() >= 2) {
+      auto slot = std::make_unique<MatchSlot>();
+      slot->match = std::make_unique<arkanoid::AuthoritativeMatch>();
+      slot->players = { m_lobby[0], m_lobby[1] };
+      m_lobby.erase(m_lobby.begin(), m_lobby.begin() + 2);
+      m_matches.push_back(std::move(slot));
+    }
+
+    auto const running_bots = static_cast<std::size_t>(std::count_if(m_matches.begin(),
+      m_matches.end(),
+      [](auto const &slot) { return slot->players[0] == nullptr && slot->players[1] == nullptr; }));
+    for (auto i = running_bots; i < m_bot_matches; ++i) {
+      auto slot = std::make_unique<MatchSlot>();
+      slot->match = std::make_unique<arkanoid::AuthoritativeMatch>();
+      m_matches.push_back(std::move(slot));
+    }
+
+    for (auto &slot : m_matches) {
+      std::erase_if(slot->spectators, [this](auto const &spectator) {
+        if (spectator->is_open()) { return false; }
+        m_spectator_frames_skipped += spectator->frames_skipped();
+        return true;
+      });
+    }
+
+    if (m_matches.empty()) { return; }
+    auto watched = std::find_if(
+      m_matches.begin(), m_matches.end(), [](auto const &slot) { return slot->players[0] != nullptr; });
+    auto &spectators = (watched != m_matches.end() ? *watched : m_matches.front())->spectators;
+    for (auto &spectator : m_spectator_lobby) {
+      if (spectator->is_open()) { spectators.push_back(std::move(spectator)); }
+    }
+    m_spectator_lobby.clear();
+  }
+
+  // Läuft auf dem Thread-Pool.
+  void step(MatchSlot &slot)
+  {
+    auto const start = std::chrono::steady_clock::now();
+    auto &match = *slot.match;
+
+    for (int player{ 0 }; player < 2; ++player) {
+      auto const &session = slot.players[static_cast<std::size_t>(player)];
+      if (session == nullptr) {
+        match.set_input(player, match.bot_input(player));
+      } else if (session->has_input()) {
+        match.set_input(player, session->mouse_x());
+      }
+    }
+
+    match.step(m_frame_rate);
+
+    for (int player{ 0 }; player < 2; ++player) {
+      auto const &session = slot.players[static_cast<std::size_t>(player)];
+      if (session == nullptr || (slot.started && match.updated_elements().empty())) { continue; }
+
+      GameUpdate update;
+      match.fill_update(update, player, !slot.started);
+      asio::post(m_io_context, [session, update = std::move(update)]() mutable { session->send(std::move(update)); });
+    }
+    slot.started = true;
+
+    // Einmal kodiert, egal wie viele Zuschauer; jeder Zuschauer hält nur eine Referenz auf den Frame.
+    if (!slot.spectators.empty()) {
+      auto &snapshot = slot.snapshot_arena.create();
+      match.fill_update(snapshot, 0, true);
+      auto frame = encode_snapshot(snapshot, m_quantization);
+      asio::post(m_io_context, [spectators = slot.spectators, frame = std::move(frame)]() {
+        for (auto const &spectator : spectators) { spectator->publish(frame); }
+      });
+    }
+
+    slot.step_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+  }
+
+  void remove_finished_matches()
+  {
+    std::erase_if(m_matches, [this](auto const &slot) {
+      bool const disconnected = std::any_of(slot->players.begin(), slot->players.end(), [](auto const &session) {
+        return session != nullptr && !session->is_open();
+      });
+      if (!slot->match->finished() && !disconnected) { return false; }
+
+      // Die verbliebenen Spieler und Zuschauer erhalten noch den letzten Zustand und werden dann getrennt. step()
+      // hat ihn bereits vorher auf denselben Thread gelegt, daher ist er eingereiht, wenn das Schließen beginnt.
+      for (auto const &session : slot->players) {
+        if (session != nullptr) {
+          m_player_updates_dropped += session->updates_dropped();
+          asio::post(m_io_context, [session]() { session->close_after_sending(); });
+        }
+      }
+      for (auto const &spectator : slot->spectators) {
+        m_spectator_frames_skipped += spectator->frames_skipped();
+        asio::post(m_io_context, [spectator]() { spectator->close_after_sending(); });
+      }
+      return true;
+    });
+  }
+
+public:
+  MatchServer(int const port, std::size_t const threads, int const frame_rate, Quantization const quantization)
+    : m_frame_rate{ frame_rate }, m_threads{ threads }, m_quantization{ quantization }, m_pool{ threads },
+      m_io_thread{ [this]() { m_io_context.run(); } }
+  {
+    listen(m_acceptor, port);
+    listen(m_spectator_acceptor, port + spectator_port_offset);
+
+    asio::co_spawn(m_io_context, accept_loop(m_acceptor, m_lobby), asio::detached);
+    asio::co_spawn(m_io_context, accept_loop(m_spectator_acceptor, m_spectator_lobby), asio::detached);
+  }
+
+  MatchServer(MatchServer const &) = delete;
+  MatchServer &operator=(MatchServer const &) = delete;
+
+  ~MatchServer()
+  {
+    asio::post(m_io_context, [this]() {
+      asio::error_code ec;
+      m_acceptor.close(ec);
+      m_spectator_acceptor.close(ec);
+    });
+    m_pool.join();
+    m_work_guard.reset();
+    m_io_context.stop();
+    m_io_thread.join();
+  }
+
+  // Bot-Partien ohne Verbindung, um die Last eines vollen Servers zu messen. Beendete werden ersetzt.
+  void set_bot_matches(std::size_t const count) { m_bot_matches = count; }
+
+  // Berechnet Ticks im Takt von frame_rate, bis duration abgelaufen ist (0 = unbegrenzt), und übergibt alle
+  // report_interval die Statistik an report.
+  template<typename Report>//
+  void run(std::chrono::seconds const duration, std::chrono::seconds const report_interval, Report &&report)
+  {
+    auto const tick_budget = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+      std::chrono::duration<double>(1.0 / m_frame_rate));
+    auto const start = std::chrono::steady_clock::now();
+    auto next_tick = start;
+    auto next_report = start + report_interval;
+
+    std::vector<double> step_ms, frame_ms;
+
+    while (duration.count() == 0 || std::chrono::steady_clock::now() - start < duration) {
+      create_matches();
+
+      auto const frame_start = std::chrono::steady_clock::now();
+      std::latch done{ static_cast<std::ptrdiff_t>(m_matches.size()) };
+      for (auto &slot : m_matches) {
+        asio::post(m_pool, [this, &slot, &done]() {
+          step(*slot);
+          done.count_down();
+        });
+      }
+      done.wait();
+      frame_ms.push_back(
+        std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - frame_start).count());
+
+      for (auto const &slot : m_matches) { step_ms.push_back(slot->step_ms); }
+      remove_finished_matches();
+
+      auto const now = std::chrono::steady_clock::now();
+      if (now >= next_report) {
+        report(collect_stats(step_ms, frame_ms, now - (next_report - report_interval)));
+        step_ms.clear();
+        frame_ms.clear();
+        next_report += report_interval;
+      }
+
+      next_tick += tick_budget;
+      if (next_tick > now) {
+        std::this_thread::sleep_until(next_tick);
+      } else {
+        next_tick = now;// im Rückstand: nicht versuchen, verpasste Ticks nachzuholen
+      }
+    }
+  }
+
+private:
+  [[nodiscard]] ServerStats collect_stats(std::vector<double> &step_ms,
+    std::vector<double> &frame_ms,
+    std::chrono::steady_clock::duration const elapsed) const
+  {
+    ServerStats stats;
+    stats.matches = m_matches.size();
+    stats.players = static_cast<std::size_t>(std::count_if(m_matches.begin(), m_matches.end(), [](auto const &slot) {
+      return slot->players[0] != nullptr;
+    })) * 2;
+    stats.threads = m_threads;
+    stats.spectator_frames_skipped = m_spectator_frames_skipped;
+    stats.player_updates_dropped = m_player_updates_dropped;
+    for (auto const &slot : m_matches) {
+      for (auto const &session : slot->players) {
+        if (session != nullptr) { stats.player_updates_dropped += session->updates_dropped(); }
+      }
+      stats.spectators += slot->spectators.size();
+      for (auto const &spectator : slot->spectators) { stats.spectator_frames_skipped += spectator->frames_skipped(); }
+    }
+    if (step_ms.empty()) { return stats; }
+
+    auto percentile = [](std::vector<double> &values, double const p) {
+      auto const index = static_cast<std::size_t>(p * static_cast<double>(values.size() - 1));
+      std::nth_element(values.begin(), values.begin() + static_cast<std::ptrdiff_t>(index), values.end());
+      return values[index];
+    };
+    stats.tick_p50_ms = percentile(step_ms, 0.50);
+    stats.tick_p95_ms = percentile(step_ms, 0.95);
+    stats.tick_p99_ms = percentile(step_ms, 0.99);
+    stats.frame_p99_ms = percentile(frame_ms, 0.99);
+
+    double total_ms{ 0 };
+    for (auto const ms : step_ms) { total_ms += ms; }
+    double const elapsed_ms = std::chrono::duration<double, std::milli>(elapsed).count();
+    stats.utilization = total_ms / (elapsed_ms * static_cast<double>(m_threads));
+    stats.matches_per_core = (1000.0 / m_frame_rate) / (total_ms / static_cast<double>(step_ms.size()));
+
+    return stats;
+  }
+};
+
+}// namespace connection
+
+#endif
@@ -0,0 +1,160 @@
+#ifndef SPECTATOR_CPP
+#define SPECTATOR_CPP
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "asio/as_tuple.hpp"
+#include "asio/awaitable.hpp"
+#include "asio/buffer.hpp"
+#include "asio/co_spawn.hpp"
+#include "asio/detached.hpp"
+#include "asio/ip/tcp.hpp"
+#include "asio/steady_timer.hpp"
+#include "asio/use_awaitable.hpp"
+#include "asio/write.hpp"
+
+#include "arkanoid.pb.h"
+#include "framing.hpp"
+#include "quantization.hpp"
+
+namespace connection {
+
+// Zuschauer verbinden sich auf dem Port des Servers plus diesem Versatz.
+int constexpr spectator_port_offset{ 1 };
+auto constexpr close_timeout{ std::chrono::seconds(2) };
+
+// Schluss einer Sitzung, nachdem ihre Schreibschleife alles geschrieben hat: Die Senderichtung wird beendet, damit
+// die Gegenstelle nach den letzten Daten das Ende liest. Getrennt wird erst, wenn die Leseschleife das Schließen der
+// Gegenstelle bemerkt und dabei signal abbricht, spätestens nach close_timeout. Sofort geschlossen verwürfe der
+// Socket ungelesene Eingaben mit einem Reset, und mit ihm gingen noch nicht gelesene Daten bei der Gegenstelle
+// verloren.
+asio::awaitable<void> linger_and_close(asio::ip::tcp::socket &socket, asio::steady_timer &signal)
+{
+  asio::error_code ec;
+  socket.shutdown(asio::ip::tcp::socket::shutdown_send, ec);
+  signal.expires_after(close_timeout);
+  (void)co_await signal.async_wait(asio::as_tuple(asio::use_awaitable));
+}
+
+// Fertig kodierter Frame, den sich alle Zuschauer einer Partie teilen. Wird nach dem Erzeugen nicht mehr verändert.
+using SharedFrame = std::shared_ptr<std::string const>;
+
+// Kodiert einen vollständigen Zustand einmal für alle Zuschauer. Zuschauer bestätigen nichts, daher gibt es keine
+// Deltas; Positionen und Geschwindigkeiten werden trotzdem gepackt.
+[[nodiscard]] SharedFrame encode_snapshot(GameUpdate &snapshot, Quantization const &quantization)
+{
+  for (auto &element : *snapshot.mutable_element()) {
+    snap_element(element, quantization);
+    pack_element(element, quantization);
+  }
+
+  auto frame = std::make_shared<std::string>();
+  append_frame(snapshot, *frame);
+  return frame;
+}
+
+// Verbindung zu einem Zuschauer. Es wird immer nur der neueste Zustand gesendet: Trifft ein neuer ein, während der
+// vorige noch geschrieben wird, ersetzt er den wartenden, statt sich anzustellen. Läuft auf dem I/O-Thread.
+class SpectatorSession : public std::enable_shared_from_this<SpectatorSession>
+{
+private:
+  asio::ip::tcp::socket m_socket;
+  asio::steady_timer m_write_signal;
+  SharedFrame m_pending;
+  std::atomic<bool> m_open{ true };
+  bool m_closing{ false };// nach close_after_sending(); nur auf dem I/O-Thread
+  std::atomic<std::size_t> m_frames_sent{ 0 }, m_frames_skipped{ 0 };
+
+  // Zuschauer senden nichts; gelesen wird nur, um das Schließen der Verbindung zu bemerken.
+  asio::awaitable<void> read_loop()
+  {
+    auto const self = shared_from_this();
+    std::array<char, 64> discard{};
+
+    while (true) {
+      auto const [ec, t] =
+        co_await m_socket.async_read_some(asio::buffer(discard), asio::as_tuple(asio::use_awaitable));
+      if (ec) { break; }
+    }
+
+    close();
+  }
+
+  asio::awaitable<void> write_loop()
+  {
+    auto const self = shared_from_this();
+
+    while (m_open) {
+      if (m_pending == nullptr) {
+        if (m_closing) { break; }
+        co_await m_write_signal.async_wait(asio::as_tuple(asio::use_awaitable));
+        continue;
+      }
+
+      // Der Frame bleibt über die eigene Referenz gültig, auch wenn inzwischen ein neuerer eintrifft.
+      auto const frame = std::move(m_pending);
+      m_pending = nullptr;
+
+      auto const [ec, t] =
+        co_await asio::async_write(m_socket, asio::buffer(*frame), asio::as_tuple(asio::use_awaitable));
+      if (ec) {
+        close();
+      } else {
+        ++m_frames_sent;
+      }
+    }
+
+    if (m_open) { co_await linger_and_close(m_socket, m_write_signal); }
+    close();
+  }
+
+public:
+  explicit SpectatorSession(asio::ip::tcp::socket socket)
+    : m_socket{ std::move(socket) }, m_write_signal{ m_socket.get_executor() }
+  {
+    m_write_signal.expires_at(asio::steady_timer::time_point::max());
+  }
+
+  void start()
+  {
+    asio::co_spawn(m_socket.get_executor(), read_loop(), asio::detached);
+    asio::co_spawn(m_socket.get_executor(), write_loop(), asio::detached);
+  }
+
+  void publish(SharedFrame frame)
+  {
+    if (!m_open || m_closing) { return; }
+
+    if (m_pending != nullptr) { ++m_frames_skipped; }
+    m_pending = std::move(frame);
+    m_write_signal.cancel();
+  }
+
+  // Schreibt noch den wartenden Frame und trennt dann, siehe linger_and_close.
+  void close_after_sending()
+  {
+    m_closing = true;
+    m_write_signal.cancel();
+  }
+
+  void close()
+  {
+    asio::error_code ec;
+    m_open = false;
+    m_socket.close(ec);
+    m_write_signal.cancel();
+  }
+
+  [[nodiscard]] bool is_open() const { return m_open; }
+  [[nodiscard]] std::size_t frames_sent() const { return m_frames_sent; }
+  [[nodiscard]] std::size_t frames_skipped() const { return m_frames_skipped; }
+};
+
+}// namespace connection
+
+#endif
@@ -0,0 +1,151 @@
+#ifndef STATE_HASH_CPP
+#define STATE_HASH_CPP
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+#include "arkanoid.pb.h"
+#include "arkanoid_elements.hpp"
+
+namespace arkanoid {
+
+// Mit FEATURE_DETERMINISTIC_PHYSICS gebaut, rechnen beide Seiten bitgleich; dann werden Prüfsummen standardmäßig
+// ausgetauscht.
+#ifdef ARKANOID_DETERMINISTIC_PHYSICS
+bool constexpr deterministic_physics{ true };
+#else
+bool constexpr deterministic_physics{ false };
+#endif
+
+// Prüfsummen gehen mit jedem Update mit; ist so lange nichts zu senden, wird eine allein verschickt.
+long constexpr state_hash_interval_ticks{ 8 };
+
+[[nodiscard]] std::uint64_t hash_combine(std::uint64_t const seed, std::uint64_t const value)
+{
+  return hash_mix(seed ^ hash_mix(value));
+}
+
+[[nodiscard]] std::uint64_t hash_combine(std::uint64_t const seed, Vector const vector)
+{
+  auto const bits = (std::uint64_t{ std::bit_cast<std::uint32_t>(vector.x) } << 32U)
+                    | std::bit_cast<std::uint32_t>(vector.y);
+  return hash_combine(seed, bits);
+}
+
+// Prüfsumme des Zustands nach einem Tick: Position und Geschwindigkeit der Bälle samt zuletzt spielendem Schläger,
+// Position und Punkte der Schläger sowie die Haltbarkeit aller Steine. Die Steine führt der ElementStore bei jeder
+// Änderung nach, je Tick kosten nur die wenigen beweglichen Elemente. Die Elemente gehen unabhängig von ihrer
+// Reihenfolge ein; wer einen Schläger steuert, unterscheidet sich zwischen den Seiten und zählt nicht.
+[[nodiscard]] std::uint64_t state_hash(ElementStore const &elements)
+{
+  std::uint64_t moving{ 0 };
+
+  elements.paddles().for_each([&moving](Paddle &paddle) {
+    auto hash = hash_combine(static_cast<std::uint64_t>(paddle.id()), paddle.center_position());
+    moving ^= hash_combine(hash, static_cast<std::uint64_t>(paddle.score()));
+  });
+  elements.balls().for_each([&moving](Ball &ball) {
+    auto hash = hash_combine(static_cast<std::uint64_t>(ball.id()), ball.center_position());
+    hash = hash_combine(hash, ball.velocity());
+    auto const *last_paddle = ball.last_paddle();
+    moving ^= hash_combine(hash, static_cast<std::uint64_t>(last_paddle != nullptr ? last_paddle->id() : -1));
+  });
+
+  return hash_combine(moving, elements.bricks_hash());
+}
+
+// Vergleicht die eigenen Prüfsummen mit denen der Gegenstelle für denselben Tick. Beide Seiten liegen in kleinen
+// Ringpuffern, bis die andere Seite den Tick erreicht hat; was bis dahin überschrieben wird, bleibt ungeprüft.
+// Nach einem Rollback gilt die zuletzt berechnete Prüfsumme eines Ticks, sofern er noch nicht verglichen wurde.
+class DesyncDetector
+{
+private:
+  struct Entry
+  {
+    std::int64_t tick{ -1 };
+    std::uint64_t hash{ 0 };
+  };
+
+  static std::size_t constexpr history{ 128 };
+
+  std::array<Entry, history> m_local{}, m_remote{};
+  Entry m_last_local;
+  std::int64_t m_last_filled_tick{ -1 };
+  std::size_t m_matched{ 0 }, m_mismatched{ 0 };
+  std::int64_t m_first_desync_tick{ -1 };
+
+  [[nodiscard]] static Entry &slot(std::array<Entry, history> &entries, std::int64_t const tick)
+  {
+    return entries[static_cast<std::size_t>(tick) % history];
+  }
+
+  void compare(std::int64_t const tick)
+  {
+    auto const &local = slot(m_local, tick);
+    auto &remote = slot(m_remote, tick);
+    if (local.tick != tick || remote.tick != tick) { return; }
+
+    if (local.hash == remote.hash) {
+      ++m_matched;
+    } else {
+      ++m_mismatched;
+      if (m_first_desync_tick < 0) { m_first_desync_tick = tick; }
+    }
+    remote.tick = -1;// jeden Tick nur einmal werten
+  }
+
+public:
+  void record_local(std::int64_t const tick, std::uint64_t const hash)
+  {
+    if (tick < 0) { return; }
+
+    m_last_local = { tick, hash };
+    slot(m_local, tick) = m_last_local;
+    compare(tick);
+  }
+
+  void record_remote(std::int64_t const tick, std::uint64_t const hash)
+  {
+    if (tick < 0) { return; }
+
+    slot(m_remote, tick) = { tick, hash };
+    compare(tick);
+  }
+
+  // Hängt die zuletzt berechnete eigene Prüfsumme an ein ausgehendes Update.
+  void fill(GameUpdate &update) const
+  {
+    if (m_last_local.tick < 0) { return; }
+
+    update.mutable_state_hash()->set_tick(m_last_local.tick);
+    update.mutable_state_hash()->set_value(m_last_local.hash);
+  }
+
+  // Wie fill, aber erst, wenn seit der zuletzt angehängten Prüfsumme interval_ticks Ticks berechnet wurden. Für
+  // Nachrichten, die ohnehin jeden Tick gehen, wie im Lockstep; verglichen wird trotzdem, denn die eigenen
+  // Prüfsummen liegen für jeden Tick vor.
+  void fill_every(GameUpdate &update, long const interval_ticks)
+  {
+    if (m_last_local.tick < 0 || (m_last_filled_tick >= 0 && m_last_local.tick < m_last_filled_tick + interval_ticks)) {
+      return;
+    }
+
+    fill(update);
+    m_last_filled_tick = m_last_local.tick;
+  }
+
+  void receive(GameUpdate const &update)
+  {
+    if (update.has_state_hash()) { record_remote(update.state_hash().tick(), update.state_hash().value()); }
+  }
+
+  [[nodiscard]] std::size_t matched() const { return m_matched; }
+  [[nodiscard]] std::size_t mismatched() const { return m_mismatched; }
+  [[nodiscard]] std::int64_t first_desync_tick() const { return m_first_desync_tick; }
+};
+
+}// namespace arkanoid
+
+#endif
@@ -0,0 +1,111 @@
+#ifndef UPDATE_ARENA_CPP
+#define UPDATE_ARENA_CPP
+
+#include <google/protobuf/arena.h>
+#include <memory>
+#include <vector>
+
+#include "arkanoid.pb.h"
+#include "mpsc_queue.hpp"
+
+namespace connection {
+
+std::size_t constexpr default_update_arena_size{ 1 << 15 };
+
+// Erzeugt GameUpdates samt aller Elemente auf einer Arena, deren Anfangsblock über alle Frames wiederverwendet
+// wird. Solange ein Update in den Block passt, kostet es keine Heap-Allokation. Das zuletzt erzeugte Update bleibt
+// bis zum nächsten create() gültig und darf den Thread nicht verlassen.
+class UpdateArena
+{
+private:
+  std::vector<char> m_block;
+  std::unique_ptr<google::protobuf::Arena> m_arena;
+  GameUpdate *m_update{ nullptr };
+
+  void reset_arena()
+  {
+    google::protobuf::ArenaOptions options;
+    options.initial_block = m_block.data();
+    options.initial_block_size = m_block.size();
+    m_arena = std::make_unique<google::protobuf::Arena>(options);
+  }
+
+public:
+  explicit UpdateArena(std::size_t const size = default_update_arena_size) : m_block(size) { reset_arena(); }
+
+  UpdateArena(UpdateArena const &) = delete;
+  UpdateArena &operator=(UpdateArena const &) = delete;
+
+  [[nodiscard]] GameUpdate &create()
+  {
+    // Reicht der Block nicht, wird er einmalig vergrößert; Reset() gäbe sonst in jedem Frame Blöcke frei.
+    if (auto const used = m_arena->SpaceAllocated(); used > m_block.size()) {
+      m_arena.reset();// vor dem Block freigeben, die Arena verwaltet ihn noch
+      m_block.resize(2 * used);
+      reset_arena();
+    } else {
+      m_arena->Reset();
+    }
+
+    m_update = google::protobuf::Arena::CreateMessage<GameUpdate>(m_arena.get());
+    return *m_update;
+  }
+
+  // Das zuletzt mit create() erzeugte Update.
+  [[nodiscard]] GameUpdate &update() const { return *m_update; }
+
+  [[nodiscard]] std::size_t block_size() const { return m_block.size(); }
+};
+
+class UpdatePool;
+
+// Gibt eine UpdateArena beim Zerstören an ihren Vorrat zurück, statt sie freizugeben.
+struct ReturnToPool
+{
+  UpdatePool *pool{ nullptr };
+
+  void operator()(UpdateArena *arena) const;
+};
+
+using PooledUpdate = std::unique_ptr<UpdateArena, ReturnToPool>;
+
+// Vorrat an UpdateArenas für Updates, die den Thread wechseln: Ein Thread entnimmt eine und füllt ihr Update, der
+// Empfänger gibt sie nach dem Verarbeiten samt Block zurück. Nach dem Aufwärmen alloziert keiner von beiden. Der
+// Empfänger darf nur ändern, was schon angelegt ist: Eine Arena gibt jedem weiteren Thread einen eigenen Block vom
+// Heap, und create() hielte ihn für einen Überlauf. Der Vorrat muss alle entnommenen Updates überdauern.
+class UpdatePool
+{
+private:
+  MpscQueue<std::unique_ptr<UpdateArena>> m_spare;
+  std::size_t const m_capacity, m_arena_size;
+
+public:
+  explicit UpdatePool(std::size_t const capacity, std::size_t const arena_size = default_update_arena_size)
+    : m_capacity{ capacity }, m_arena_size{ arena_size }
+  {}
+
+  UpdatePool(UpdatePool const &) = delete;
+  UpdatePool &operator=(UpdatePool const &) = delete;
+
+  // Darf nur aus einem Thread aufgerufen werden. Das Update ist bereits mit create() angelegt und kehrt zurück,
+  // sobald der PooledUpdate zerstört wird, in welchem Thread auch immer.
+  [[nodiscard]] PooledUpdate take()
+  {
+    auto spare = m_spare.pop();
+    auto arena = spare ? std::move(*spare) : std::make_unique<UpdateArena>(m_arena_size);
+    (void)arena->create();
+    return PooledUpdate{ arena.release(), ReturnToPool{ this } };
+  }
+
+  // Aus jedem Thread. Was über die Kapazität hinausgeht, wird freigegeben.
+  void give_back(std::unique_ptr<UpdateArena> arena)
+  {
+    if (m_spare.size() < m_capacity) { (void)m_spare.push(std::move(arena)); }
+  }
+};
+
+void ReturnToPool::operator()(UpdateArena *arena) const { pool->give_back(std::unique_ptr<UpdateArena>{ arena }); }
+
+}// namespace connection
+
+#endif
@@ -0,0 +1,129 @@
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <fmt/format.h>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#include "arkanoid.pb.h"
+
+#include "batch.hpp"
+
+namespace {
+
+struct Options
+{
+  std::size_t matches{ 1000 };
+  std::size_t threads{ std::max(std::thread::hardware_concurrency(), 1U) };
+  std::uint32_t seed{ 0 };
+  int frame_rate{ 60 };
+  long max_ticks{ 60L * 60 * 3 };// drei Minuten Spielzeit
+};
+
+[[nodiscard]] Options parse_options(int const argc, char const *const *argv)
+{
+  Options options;
+
+  for (int i{ 1 }; i < argc; ++i) {
+    std::string const argument{ argv[i] };
+    auto next = [&]() {
+      if (i + 1 >= argc) { throw std::invalid_argument{ "Wert fehlt für " + argument }; }
+      return std::stoll(argv[++i]);
+    };
+
+    if (argument == "--matches") {
+      options.matches = static_cast<std::size_t>(next());
+    } else if (argument == "--threads") {
+      options.threads = static_cast<std::size_t>(next());
+    } else if (argument == "--seed") {
+      options.seed = static_cast<std::uint32_t>(next());
+    } else if (argument == "--frame-rate") {
+      options.frame_rate = static_cast<int>(next());
+    } else if (argument == "--max-ticks") {
+      options.max_ticks = static_cast<long>(next());
+    } else {
+      throw std::invalid_argument{ "Unbekannte Option " + argument };
+    }
+  }
+
+  if (options.matches == 0) { throw std::invalid_argument{ "--matches muss größer als 0 sein" }; }
+  if (options.threads == 0) { throw std::invalid_argument{ "--threads muss größer als 0 sein" }; }
+  if (options.frame_rate <= 0) { throw std::invalid_argument{ "--frame-rate muss größer als 0 sein" }; }
+  if (options.max_ticks <= 0) { throw std::invalid_argument{ "--max-ticks muss größer als 0 sein" }; }
+  return options;
+}
+
+[[nodiscard]] double percent(std::size_t const part, std::size_t const whole)
+{
+  return whole > 0 ? 100.0 * static_cast<double>(part) / static_cast<double>(whole) : 0.0;
+}
+
+}// namespace
+
+// Verwendung: arkanoid_batch [--matches N] [--threads T] [--seed S] [--frame-rate F] [--max-ticks M]
+// Spielt N Partien zwischen zwei Bots auf allen Kernen und gibt die Ausgänge und den Durchsatz aus. Die Prüfsumme
+// hängt nur von seed und Argumenten ab, für Regressionsprüfungen nach Änderungen an Physik oder Regeln.
+int main(int argc, char const *argv[])
+{
+  Options options;
+  try {
+    options = parse_options(argc, argv);
+  } catch (std::exception const &e) {
+    fmt::print(stderr, "Ungültige Argumente: {}\n", e.what());
+    fmt::print(stderr,
+      "Verwendung: {} [--matches N] [--threads T] [--seed S] [--frame-rate F] [--max-ticks M]\n",
+      argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  arkanoid::BatchRunner runner{ options.threads };
+  runner.run(options.matches, options.seed, options.frame_rate, options.max_ticks);
+  auto const summary = runner.summary();
+  auto const seconds = runner.seconds();
+  auto const matches = static_cast<double>(summary.matches);
+
+  fmt::print("{} Partien, seeds {} bis {}, höchstens {} Ticks bei {} Ticks/s\n",
+    summary.matches,
+    options.seed,
+    options.seed + static_cast<std::uint32_t>(summary.matches - 1),
+    options.max_ticks,
+    options.frame_rate);
+  char const *const outcome_names[3]{ "unten gewinnt", "oben gewinnt", "unentschieden" };
+  for (std::size_t outcome{ 0 }; outcome < 3; ++outcome) {
+    fmt::print("  {:<16} {:>7} ({:>5.1f}%)\n",
+      outcome_names[outcome],
+      summary.outcomes[outcome],
+      percent(summary.outcomes[outcome], summary.matches));
+  }
+  fmt::print("  alle Steine weg  {:>7} ({:>5.1f}%), sonst nach Punkten\n",
+    summary.finished,
+    percent(summary.finished, summary.matches));
+  fmt::print("  im Mittel {:.0f} Ticks, Punkte {:.2f}:{:.2f}, {:.1f} Steine übrig\n",
+    static_cast<double>(summary.ticks) / matches,
+    static_cast<double>(summary.scores[0]) / matches,
+    static_cast<double>(summary.scores[1]) / matches,
+    static_cast<double>(summary.bricks_left) / matches);
+  fmt::print("  Prüfsumme {:016x}\n", summary.checksum);
+
+  auto const &scheduler = runner.scheduler();
+  auto const threads = static_cast<double>(scheduler.threads());
+  double const matches_per_second = seconds > 0.0 ? matches / seconds : 0.0;
+  fmt::print("{:.3f} s auf {} Threads: {:.1f} Partien/s, {:.2f} Partien/s je Kern, {:.0f} Ticks/s\n",
+    seconds,
+    scheduler.threads(),
+    matches_per_second,
+    matches_per_second / threads,
+    seconds > 0.0 ? static_cast<double>(summary.ticks) / seconds : 0.0);
+  for (std::size_t thread{ 0 }; thread < scheduler.threads(); ++thread) {
+    fmt::print("  Thread {:>3}: {:>6} Partien, davon {:>5} gestohlen, {:>5.1f}% ausgelastet\n",
+      thread,
+      scheduler.executed(thread),
+      scheduler.stolen(thread),
+      seconds > 0.0 ? scheduler.busy_ms(thread) / (seconds * 10.0) : 0.0);
+  }
+
+  google::protobuf::ShutdownProtobufLibrary();
+
+  return EXIT_SUCCESS;
+}
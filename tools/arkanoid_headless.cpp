@@ -0,0 +1,123 @@
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fmt/format.h>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#include "arkanoid.pb.h"
+
+#include "headless.hpp"
+
+namespace {
+
+struct Options
+{
+  long ticks{ 100000 };
+  arkanoid::HeadlessInput input{ arkanoid::HeadlessInput::BOT };
+  std::uint32_t seed{ 0 };
+  int frame_rate{ 60 };
+};
+
+[[nodiscard]] Options parse_options(int const argc, char const *const *argv)
+{
+  Options options;
+
+  for (int i{ 1 }; i < argc; ++i) {
+    std::string const argument{ argv[i] };
+    auto next = [&]() {
+      if (i + 1 >= argc) { throw std::invalid_argument{ "Wert fehlt für " + argument }; }
+      return std::stoll(argv[++i]);
+    };
+
+    if (argument == "--ticks") {
+      options.ticks = static_cast<long>(next());
+    } else if (argument == "--seed") {
+      options.seed = static_cast<std::uint32_t>(next());
+    } else if (argument == "--frame-rate") {
+      options.frame_rate = static_cast<int>(next());
+    } else if (argument == "--script") {
+      options.input = arkanoid::HeadlessInput::SCRIPT;
+    } else if (argument == "--bot") {
+      options.input = arkanoid::HeadlessInput::BOT;
+    } else {
+      throw std::invalid_argument{ "Unbekannte Option " + argument };
+    }
+  }
+
+  if (options.ticks <= 0) { throw std::invalid_argument{ "--ticks muss größer als 0 sein" }; }
+  if (options.frame_rate <= 0) { throw std::invalid_argument{ "--frame-rate muss größer als 0 sein" }; }
+  return options;
+}
+
+[[nodiscard]] std::unique_ptr<arkanoid::HeadlessMatch> new_match(Options const &options, std::uint32_t const seed)
+{
+  return std::make_unique<arkanoid::HeadlessMatch>(options.input, seed);
+}
+
+}// namespace
+
+// Verwendung: arkanoid_headless [--ticks N] [--bot|--script] [--seed S] [--frame-rate F]
+// Lässt Partien ohne Bildschirm und ohne Wartezeit laufen und misst, wie viele Ticks pro Sekunde die Spiellogik
+// schafft, wie sich die Zeit auf die Abschnitte eines Ticks verteilt und wie viele Allokationen dabei anfallen.
+// Ist eine Partie entschieden, beginnt die nächste mit dem folgenden seed.
+int main(int argc, char const *argv[])
+{
+  Options options;
+  try {
+    options = parse_options(argc, argv);
+  } catch (std::exception const &e) {
+    fmt::print(stderr, "Ungültige Argumente: {}\n", e.what());
+    fmt::print(stderr, "Verwendung: {} [--ticks N] [--bot|--script] [--seed S] [--frame-rate F]\n", argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  auto seed = options.seed;
+  auto match = new_match(options, seed);
+  arkanoid::TickProfile profile;
+  long matches{ 0 };
+  std::array<long, 2> wins{};
+
+  auto const start = std::chrono::steady_clock::now();
+  for (long tick{ 0 }; tick < options.ticks; ++tick) {
+    match->step(options.frame_rate, &profile);
+    if (match->finished()) {
+      ++matches;
+      ++wins[static_cast<std::size_t>(match->winner())];
+      match = new_match(options, ++seed);
+    }
+  }
+  auto const seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  double const ticks_per_second = seconds > 0.0 ? static_cast<double>(profile.ticks) / seconds : 0.0;
+  fmt::print("{} Ticks in {:.3f} s: {:.0f} Ticks/s, {:.0f}x Echtzeit bei {} Ticks/s\n",
+    profile.ticks,
+    seconds,
+    ticks_per_second,
+    ticks_per_second / options.frame_rate,
+    options.frame_rate);
+  fmt::print("{} Partien beendet ({}:{}), laufende Partie bei Tick {}\n", matches, wins[0], wins[1], match->tick());
+
+  auto const ticks = static_cast<double>(profile.ticks);
+  auto const total_ns = profile.total_ns();
+  fmt::print("  {:<12} {:>10} {:>7} {:>14}\n", "Abschnitt", "ns/Tick", "Anteil", "Allok./Tick");
+  for (std::size_t phase{ 0 }; phase < arkanoid::TickProfile::PHASE_COUNT; ++phase) {
+    fmt::print("  {:<12} {:>10.0f} {:>6.1f}% {:>14.2f}\n",
+      arkanoid::TickProfile::names[phase],
+      profile.ns[phase] / ticks,
+      total_ns > 0.0 ? 100.0 * profile.ns[phase] / total_ns : 0.0,
+      static_cast<double>(profile.allocations[phase]) / ticks);
+  }
+  fmt::print("  {:<12} {:>10.0f} {:>6.1f}% {:>14.2f}\n",
+    "gesamt",
+    total_ns / ticks,
+    100.0,
+    static_cast<double>(profile.total_allocations()) / ticks);
+
+  match.reset();
+  google::protobuf::ShutdownProtobufLibrary();
+
+  return EXIT_SUCCESS;
+}
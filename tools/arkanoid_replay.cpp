@@ -0,0 +1,152 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fmt/format.h>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+#include "arkanoid.pb.h"
+
+#include "replay.hpp"
+
+namespace {
+
+struct Options
+{
+  std::string path;
+  std::int64_t from{ 0 };
+  std::int64_t until{ std::numeric_limits<std::int64_t>::max() };
+  bool list{ false };
+};
+
+[[nodiscard]] Options parse_options(int const argc, char const *const *argv)
+{
+  Options options;
+
+  for (int i{ 1 }; i < argc; ++i) {
+    std::string const argument{ argv[i] };
+    auto next = [&]() {
+      if (i + 1 >= argc) { throw std::invalid_argument{ "Wert fehlt für " + argument }; }
+      return std::stoll(argv[++i]);
+    };
+
+    if (argument == "--from") {
+      options.from = next();
+    } else if (argument == "--until") {
+      options.until = next();
+    } else if (argument == "--list") {
+      options.list = true;
+    } else {
+      options.path = argument;
+    }
+  }
+
+  if (options.path.empty()) { throw std::invalid_argument{ "Datei fehlt" }; }
+  return options;
+}
+
+[[nodiscard]] char const *mode_name(arkanoid::ReplayMode const mode)
+{
+  switch (mode) {
+  case arkanoid::ReplayMode::PEER:
+    return "direkt";
+  case arkanoid::ReplayMode::ROLLBACK:
+    return "Rollback";
+  case arkanoid::ReplayMode::LOCKSTEP:
+    return "Lockstep";
+  case arkanoid::ReplayMode::SERVER:
+    return "Server";
+  case arkanoid::ReplayMode::SPECTATOR:
+    break;
+  }
+  return "Zuschauer";
+}
+
+// Anzahl und Größe der Einträge je Art.
+void list_records(arkanoid::ReplayReader const &reader)
+{
+  std::size_t counts[4]{}, bytes[4]{};
+  std::int64_t last_tick{ 0 };
+  for (auto entry = reader.read(reader.begin()); entry; entry = reader.read(entry->next)) {
+    auto const kind = static_cast<std::size_t>(entry->kind);
+    if (kind >= 4) { continue; }
+    ++counts[kind];
+    bytes[kind] += entry->payload.size();
+    last_tick = entry->tick;
+  }
+
+  char const *const names[4]{ "Eingaben", "gesendet", "empfangen", "Keyframes" };
+  for (std::size_t kind{ 0 }; kind < 4; ++kind) {
+    fmt::print("  {:<10} {:>7} Einträge, {:>9} Bytes\n", names[kind], counts[kind], bytes[kind]);
+  }
+  fmt::print("  bis Tick {}\n", last_tick);
+}
+
+}// namespace
+
+// Verwendung: arkanoid_replay <datei> [--from TICK] [--until TICK] [--list]
+// Berechnet eine mit "Partie aufzeichnen" erstellte Aufzeichnung ohne Bildschirm neu und vergleicht sie mit den
+// Keyframes. Gibt EXIT_FAILURE zurück, wenn ein Keyframe abweicht, für Regressionsprüfungen.
+int main(int argc, char const *argv[])
+{
+  Options options;
+  try {
+    options = parse_options(argc, argv);
+  } catch (std::exception const &e) {
+    fmt::print(stderr, "Ungültige Argumente: {}\n", e.what());
+    fmt::print(stderr, "Verwendung: {} <datei> [--from TICK] [--until TICK] [--list]\n", argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  arkanoid::ReplayReader reader;
+  if (!reader.open(options.path)) {
+    fmt::print(stderr, "{} ist keine lesbare Aufzeichnung\n", options.path);
+    return EXIT_FAILURE;
+  }
+
+  auto const &header = reader.header();
+  fmt::print("{}: {} Bytes, Modus {}, {} Ticks/s, {} Keyframes\n",
+    options.path,
+    header.length,
+    mode_name(header.mode),
+    header.frame_rate,
+    reader.keyframes().size());
+  if (options.list) { list_records(reader); }
+
+  auto const position = reader.seek(options.from);
+  if (!position) {
+    fmt::print(stderr, "Keine Keyframes, ab denen neu berechnet werden kann\n");
+    return EXIT_FAILURE;
+  }
+
+  arkanoid::ReplaySession session{ header.mode, static_cast<int>(header.frame_rate) };
+  auto const start = std::chrono::steady_clock::now();
+  if (!session.play(reader, *position, options.until)) {
+    fmt::print(stderr, "Keyframe passt nicht zur Partie\n");
+    return EXIT_FAILURE;
+  }
+  auto const seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  if (session.resimulates()) {
+    double const ticks_per_second = seconds > 0.0 ? static_cast<double>(session.ticks()) / seconds : 0.0;
+    fmt::print("{} Ticks in {:.3f} s: {:.0f} Ticks/s, {:.0f}x Echtzeit\n",
+      session.ticks(),
+      seconds,
+      ticks_per_second,
+      ticks_per_second / header.frame_rate);
+  } else {
+    fmt::print("Im Modus {} werden die Keyframes nur geladen, nicht geprüft\n", mode_name(header.mode));
+  }
+
+  fmt::print("Keyframes: {} gleich, {} abweichend, {} ungeprüft",
+    session.matched(),
+    session.mismatched(),
+    session.unchecked());
+  if (session.mismatched() > 0) { fmt::print(", erste Abweichung bei Tick {}", session.first_mismatch_tick()); }
+  fmt::print("\n");
+
+  google::protobuf::ShutdownProtobufLibrary();
+
+  return session.mismatched() == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
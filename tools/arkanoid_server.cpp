@@ -0,0 +1,97 @@
+#include <chrono>
+#include <cstdlib>
+#include <fmt/format.h>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#include "arkanoid.pb.h"
+
+#include "arkanoid_elements.hpp"
+#include "connection.hpp"
+#include "server.hpp"
+
+namespace {
+
+int constexpr frame_rate{ 40 };
+
+struct Options
+{
+  int port{ connection::default_port };
+  std::size_t bots{ 0 };
+  std::size_t threads{ std::max(1U, std::thread::hardware_concurrency()) };
+  long seconds{ 0 };
+};
+
+[[nodiscard]] Options parse_options(int const argc, char const *const *argv)
+{
+  Options options;
+
+  for (int i{ 1 }; i < argc; ++i) {
+    std::string const argument{ argv[i] };
+    auto next = [&]() {
+      if (i + 1 >= argc) { throw std::invalid_argument{ "Wert fehlt für " + argument }; }
+      return std::stol(argv[++i]);
+    };
+
+    if (argument == "--bots") {
+      options.bots = static_cast<std::size_t>(next());
+    } else if (argument == "--threads") {
+      options.threads = static_cast<std::size_t>(next());
+    } else if (argument == "--seconds") {
+      options.seconds = next();
+    } else {
+      options.port = std::stoi(argument);
+    }
+  }
+
+  return options;
+}
+
+}// namespace
+
+// Verwendung: arkanoid_server [port] [--bots N] [--threads N] [--seconds N]
+int main(int argc, char const *argv[])
+{
+  Options options;
+  try {
+    options = parse_options(argc, argv);
+  } catch (std::exception const &e) {
+    fmt::print(stderr, "Ungültige Argumente: {}\n", e.what());
+    fmt::print(stderr, "Verwendung: {} [port] [--bots N] [--threads N] [--seconds N]\n", argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  {
+    connection::MatchServer server{ options.port, options.threads, frame_rate, arkanoid::wire_quantization() };
+    server.set_bot_matches(options.bots);
+
+    fmt::print("Server auf Port {} (Zuschauer {}) mit {} Threads, {} Bot-Partien\n",
+      options.port,
+      options.port + connection::spectator_port_offset,
+      options.threads,
+      options.bots);
+    auto const report = [](connection::ServerStats const &s) {
+      fmt::print("{:>5} Partien ({:>4} Spieler, {} verworfen, {:>4} Zuschauer, {} übersprungen): Tick p50 {:.3f} ms, "
+                 "p95 {:.3f} ms, p99 {:.3f} ms, Frame p99 {:.2f} ms, Auslastung {:.1f}% von {} Threads, "
+                 "Kapazität {:.0f} Partien/Kern\n",
+        s.matches,
+        s.players,
+        s.player_updates_dropped,
+        s.spectators,
+        s.spectator_frames_skipped,
+        s.tick_p50_ms,
+        s.tick_p95_ms,
+        s.tick_p99_ms,
+        s.frame_p99_ms,
+        s.utilization * 100.0,
+        s.threads,
+        s.matches_per_core);
+    };
+    server.run(std::chrono::seconds{ options.seconds }, std::chrono::seconds{ 5 }, report);
+  }
+
+  google::protobuf::ShutdownProtobufLibrary();
+
+  return EXIT_SUCCESS;
+}